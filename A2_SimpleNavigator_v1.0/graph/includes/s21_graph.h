@@ -9,6 +9,7 @@
 #include <regex>
 
 #include "../../utils/includes/utils.hpp"
+#include "../../utils/includes/graphFileParser.hpp"
 
 namespace fs = std::filesystem;
 
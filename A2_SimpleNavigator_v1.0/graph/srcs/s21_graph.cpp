@@ -110,44 +110,10 @@ bool Graph::LoadGraphFromFile(std::string filename){
         return false;
     }
 
-    std::ifstream file_stream;
-    file_stream.open(filename, std::ios_base::in);
-    if (!file_stream.is_open()){
-        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
-                        "Cannot open file " + filename);
-        return false;
-    }
-
-    int size;
-    file_stream >> size;
-    if (size <= 0){
-        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
-                        "Graph size must be positive");
+    if (!ParseGraphFile(filename, graph_)){
+        graph_.clear();
         return false;
     }
-
-    graph_.reserve(size);
-    for (int i = 0; i < size; i++){
-        elem_of_graph_type row;
-        row.reserve(size);
-        for (int j = 0; j < size; j++){
-            int val;
-            if (!(file_stream >> val)){
-                PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
-                                "Invalid file line");
-                graph_.clear();
-                return false;
-            }
-            if (val < 0){
-                PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
-                                "Vertex value must be non-negative");
-                graph_.clear();
-                return false;
-            }
-            row.push_back(val);
-        }
-        graph_.push_back(std::move(row));
-    }
     is_directed_ = IsDirected_();
     is_connected_ = IsConnected_();
 
@@ -1,9 +1,11 @@
 #pragma once
 
+#include <filesystem>
 #include <fstream>
 #include <gtest/gtest.h>
 
 #include "../../../graph/includes/s21_graph.h"
+#include "../../../utils/includes/graphFileParser.hpp"
 
 #define TEST_SUITE_NAME GRAPH_TESTS
 
@@ -38,4 +38,21 @@ TEST(TEST_SUITE_NAME, LOAD_INVALID_FILES){
     ASSERT_FALSE(graph.LoadGraphFromFile(invalid_graphs_dir + "05"));
 }
 
+TEST(TEST_SUITE_NAME, LOAD_EXTRA_ELEMENTS_IN_SEVERAL_CHUNKS){
+    const std::string file_name = std::filesystem::temp_directory_path() /
+                                    "s21_graph_extra_elements";
+    s21::matrix_type graph;
+
+    // Extra elements fill chunks which start past the declared ones
+    {
+        std::ofstream file_stream(file_name);
+
+        file_stream << "2\n";
+        for (int i = 0; i < 200000; i++) file_stream << "1 2 3 4 5 6 7 8\n";
+    }
+    ASSERT_FALSE(s21::ParseGraphFile(file_name, graph, 4));
+    ASSERT_TRUE(graph.empty());
+    std::filesystem::remove(file_name);
+}
+
 }
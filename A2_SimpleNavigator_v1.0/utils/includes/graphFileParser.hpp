@@ -0,0 +1,29 @@
+#ifndef GRAPH_FILE_PARSER_HPP
+#define GRAPH_FILE_PARSER_HPP
+
+#include <string>
+#include <thread>
+
+#include "utils.hpp"
+
+namespace s21{
+
+// Smaller chunks of a graph file aren't worth a thread
+const std::size_t GRAPH_FILE_MIN_CHUNK_SIZE = std::size_t(1) << 20;
+
+/**
+ * Loading adjacency matrix of non-negative integers from [filename] in
+ * the adjacency matrix format into [graph]. The file is mapped and split
+ * into line-aligned chunks: the first pass counts elements of every chunk,
+ * the second one parses them with std::from_chars right into their rows.
+ * Both passes run one chunk per thread, up to [threads_count] threads
+ * @return true if successful loading
+ * @return false printing the error with its line and column otherwise
+ */
+bool ParseGraphFile(const std::string& filename, matrix_type& graph,
+                    std::size_t threads_count =
+                        std::thread::hardware_concurrency());
+
+}
+
+#endif
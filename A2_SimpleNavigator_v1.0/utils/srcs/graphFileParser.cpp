@@ -0,0 +1,314 @@
+#include "../includes/graphFileParser.hpp"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <cstdint>
+
+namespace s21{
+
+namespace {
+
+// Elements between line starts [begin, end)
+struct Chunk{
+    const char* begin;
+    const char* end;
+    // Index of the first element of the chunk in the matrix
+    std::size_t first_element;
+    std::size_t elements;
+    // First error in the chunk, nullptr if there is no one
+    const char* error_position;
+    std::string error;
+};
+
+// Read-only mapping of a whole file
+class MappedFile{
+public:
+    explicit MappedFile(const std::string& filename){
+        struct stat file_stat;
+
+        descriptor_ = ::open(filename.c_str(), O_RDONLY);
+        if (descriptor_ < 0 || ::fstat(descriptor_, &file_stat) ||
+                file_stat.st_size <= 0){
+            return;
+        }
+
+        void* mapping = ::mmap(nullptr, file_stat.st_size, PROT_READ,
+                                MAP_PRIVATE, descriptor_, 0);
+
+        if (mapping == MAP_FAILED) return;
+        begin_ = static_cast<const char*>(mapping);
+        end_ = begin_ + file_stat.st_size;
+    }
+    MappedFile(const MappedFile&) = delete;
+    ~MappedFile(){
+        if (begin_) ::munmap(const_cast<char*>(begin_), end_ - begin_);
+        if (descriptor_ >= 0) ::close(descriptor_);
+    }
+
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool IsOpen() const{ return begin_ != nullptr; }
+    const char* Begin() const{ return begin_; }
+    const char* End() const{ return end_; }
+
+private:
+    int descriptor_ = -1;
+    const char* begin_ = nullptr;
+    const char* end_ = nullptr;
+};
+
+/**
+ * @return true if [c] is a space or any other ASCII control character
+ */
+bool IsSpace(char c){
+    return static_cast<unsigned char>(c) <= ' ';
+}
+
+/**
+ * @return "[filename]:[line]:[column]: [msg]" for [position] of [file]
+ */
+std::string ErrorAt(const std::string& filename, const MappedFile& file,
+                    const char* position, const std::string& msg){
+    const std::size_t line = std::count(file.Begin(), position, '\n') + 1;
+    const char* line_begin = position;
+
+    while (line_begin != file.Begin() && line_begin[-1] != '\n'){
+        --line_begin;
+    }
+    return filename + ":" + std::to_string(line) + ":" +
+            std::to_string(position - line_begin + 1) + ": " + msg;
+}
+
+/**
+ * Splitting [begin, end) into up to [chunks_count] line-aligned chunks
+ */
+std::vector<Chunk> SplitChunks(const char* begin, const char* end,
+                                std::size_t chunks_count){
+    const std::size_t size = end - begin;
+    const char* first = begin;
+    std::vector<Chunk> chunks;
+
+    for (std::size_t chunk_i = 1; chunk_i <= chunks_count; chunk_i++){
+        const char* last = begin + size * chunk_i / chunks_count;
+
+        // Moving the border to the next line start
+        if (last < first) last = first;
+        if (last != end){
+            const void* line_end = std::memchr(last, '\n', end - last);
+
+            last = line_end ? static_cast<const char*>(line_end) + 1 : end;
+        }
+        if (last == first) continue;
+        chunks.push_back(Chunk{first, last, 0, 0, nullptr, std::string()});
+        first = last;
+    }
+    if (chunks.empty()){
+        chunks.push_back(Chunk{end, end, 0, 0, nullptr, std::string()});
+    }
+    return chunks;
+}
+
+void CountChunk(Chunk& chunk){
+    const std::size_t size = chunk.end - chunk.begin;
+    const char* data = chunk.begin;
+    std::size_t elements = 0;
+    // The character before a chunk is a line end or the header end
+    bool is_previous_space = true;
+    std::size_t i = 0;
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    // 8 characters at once: 0x80 marks non-space bytes, an element starts
+    // at a marked byte which follows an unmarked one
+    constexpr std::uint64_t ONES = 0x0101010101010101ULL;
+    constexpr std::uint64_t HIGH_BITS = ONES * 0x80;
+    constexpr std::uint64_t LOW_BITS = ONES * 0x7F;
+    std::uint64_t previous = 0;
+
+    for (; i + sizeof(std::uint64_t) <= size; i += sizeof(std::uint64_t)){
+        std::uint64_t word;
+
+        std::memcpy(&word, data + i, sizeof(word));
+
+        const std::uint64_t marks = (((word & LOW_BITS) + ONES * (0x7F - ' '))
+                                    | word) & HIGH_BITS;
+
+        elements += __builtin_popcountll(marks & ~((marks << 8) | previous));
+        previous = marks >> 56;
+    }
+    is_previous_space = !previous;
+#endif
+    for (; i < size; i++){
+        const bool is_space = IsSpace(data[i]);
+
+        elements += is_previous_space && !is_space;
+        is_previous_space = is_space;
+    }
+    chunk.elements = elements;
+}
+
+/**
+ * Parsing elements of [chunk] into rows of [graph]
+ */
+void ParseChunk(Chunk& chunk, matrix_type& graph){
+    const std::size_t size = graph.size();
+    std::size_t element = chunk.first_element;
+    std::size_t row = element / size;
+    std::size_t column = element % size;
+    const char* position = chunk.begin;
+    auto set_error = [&chunk](const char* error_position,
+                                const std::string& error){
+        chunk.error_position = error_position;
+        chunk.error = error;
+    };
+
+    while (true){
+        while (position != chunk.end && IsSpace(*position)) ++position;
+        if (position == chunk.end) return;
+        if (element >= size * size){
+            set_error(position, "Expected only " +
+                                std::to_string(size * size) + " elements");
+            return;
+        }
+
+        // Streams accept explicit plus sign, std::from_chars doesn't
+        const char* number = position;
+        if (*number == '+' && number + 1 != chunk.end && number[1] != '-'){
+            ++number;
+        }
+
+        int value;
+        const std::from_chars_result result = std::from_chars(
+            number, chunk.end, value
+        );
+
+        if (result.ec == std::errc::result_out_of_range){
+            set_error(position, "Number is out of range");
+            return;
+        }
+        if (result.ec != std::errc() || (result.ptr != chunk.end &&
+                                        !IsSpace(*result.ptr))){
+            set_error(position, "Invalid file line");
+            return;
+        }
+        if (value < 0){
+            set_error(position, "Vertex value must be non-negative");
+            return;
+        }
+
+        graph[row][column] = value;
+        position = result.ptr;
+        element++;
+        if (++column == size){
+            column = 0;
+            row++;
+        }
+    }
+}
+
+/**
+ * Calling [process] for every chunk of [chunks], one thread per chunk
+ */
+template < class Function >
+void ForEachChunk(std::vector<Chunk>& chunks, Function process){
+    std::vector<std::thread> threads;
+    std::size_t chunk_i = 1;
+
+    try{
+        for (; chunk_i < chunks.size(); chunk_i++){
+            threads.emplace_back(process, std::ref(chunks[chunk_i]));
+        }
+    } catch(const std::exception& e){
+        std::string error = "Threads problems: ";
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__, error + e.what());
+    }
+    // Chunks left without a thread are processed here
+    process(chunks.front());
+    for (; chunk_i < chunks.size(); chunk_i++) process(chunks[chunk_i]);
+    for (std::thread& thread : threads) thread.join();
+}
+
+}
+
+bool ParseGraphFile(const std::string& filename, matrix_type& graph,
+                    std::size_t threads_count){
+    const MappedFile file(filename);
+
+    if (!file.IsOpen()){
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
+                        "Cannot open file " + filename);
+        return false;
+    }
+
+    // Header
+    const char* position = file.Begin();
+    long long size = 0;
+
+    while (position != file.End() && IsSpace(*position)) ++position;
+
+    const std::from_chars_result header = std::from_chars(
+        position, file.End(), size
+    );
+
+    if (header.ec != std::errc() || (header.ptr != file.End() &&
+                                    !IsSpace(*header.ptr))){
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
+                    ErrorAt(filename, file, position, "Invalid graph size"));
+        return false;
+    }
+    if (size <= 0){
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
+                        "Graph size must be positive");
+        return false;
+    }
+
+    // Elements
+    const std::size_t max_chunks = (file.End() - header.ptr) /
+                                    GRAPH_FILE_MIN_CHUNK_SIZE + 1;
+    std::vector<Chunk> chunks = SplitChunks(
+        header.ptr, file.End(),
+        std::clamp<std::size_t>(threads_count, 1, max_chunks)
+    );
+    const std::size_t expected = size * size;
+    std::size_t found = 0;
+
+    ForEachChunk(chunks, CountChunk);
+    for (Chunk& chunk : chunks){
+        chunk.first_element = found;
+        found += chunk.elements;
+    }
+    // Extra elements are reported by ParseChunk at their position
+    if (found < expected){
+        const char* last = file.End();
+
+        // Pointing right after the last element
+        while (last != header.ptr && IsSpace(last[-1])) --last;
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__, ErrorAt(
+            filename, file, last, "Expected " + std::to_string(expected) +
+                                    " elements, found " + std::to_string(found)
+        ));
+        return false;
+    }
+
+    matrix_type result(size, row_matrix_type(size));
+
+    ForEachChunk(chunks, [&result](Chunk& chunk){
+        ParseChunk(chunk, result);
+    });
+    for (const Chunk& chunk : chunks){
+        if (chunk.error_position){
+            PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__, ErrorAt(
+                filename, file, chunk.error_position, chunk.error
+            ));
+            return false;
+        }
+    }
+    graph = std::move(result);
+    return true;
+}
+
+}
@@ -2,9 +2,9 @@
 #define ACO_MULTI_H
 
 #include <mutex>
-#include <thread>
 
 #include "aco_abs.h"
+#include "../../../utils/includes/thread_pool.h"
 
 namespace s21{
 
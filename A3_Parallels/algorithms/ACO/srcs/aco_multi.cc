@@ -3,27 +3,19 @@
 
 namespace s21{
 
-void AcoMulti::AlgoBody_(std::vector<Ant>& ants){    
-    std::vector<std::thread> threads;
-    threads.reserve(ants.size());
-    
-    // All ant do steps 'till they are in the end
-    for (Ant& ant : ants){
-        threads.push_back(
-            std::thread(
-                [this, &ant](){
-                    while (!ant.IsEnd()){
-                        this->MakeStep_(ant);
-                    }
+void AcoMulti::AlgoBody_(std::vector<Ant>& ants){
+    // All ant do steps 'till they are in the end, ants are shared
+    // between threads of the pool
+    ThreadPool::Instance().ParallelFor(
+        0, ants.size(),
+        [this, &ants](size_t ant_begin, size_t ant_end){
+            for (size_t ant_i = ant_begin; ant_i < ant_end; ant_i++){
+                while (!ants[ant_i].IsEnd()){
+                    this->MakeStep_(ants[ant_i]);
                 }
-            )
-        );
-    }
-
-    // Wait ants finish their work
-    for (std::thread& thread : threads){
-        thread.join();
-    }
+            }
+        }
+    );
 }
 
 void AcoMulti::UpdateAntsCount_(){
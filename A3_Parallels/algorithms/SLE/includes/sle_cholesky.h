@@ -0,0 +1,175 @@
+#ifndef SLE_CHOLESKY_H
+#define SLE_CHOLESKY_H
+
+#include <algorithm>
+#include <cstddef>
+#include <atomic>
+#include <vector>
+#include <limits>
+#include <cmath>
+
+#include "sle_simd.h"
+#include "sle_gemm.h"
+#include "../../../utils/includes/utils.h"
+#include "../../../utils/includes/thread_pool.h"
+#include "../../../utils/includes/task_graph.h"
+#include "../../../matrix/includes/matrix.h"
+#include "../../../matrix/includes/matrix_storage.h"
+#include "../../../matrix/includes/sle.h"
+
+namespace s21{
+
+/**
+ * Tiled Cholesky factorisation A = L L^T of a symmetric positive-definite
+ * matrix. Only tiles of the lower triangle are kept, one after another,
+ * so the factor takes half of the memory of the matrix. Every step is
+ * split into tasks of a TaskGraph, as TiledLu does:
+ *  - POTRF: factorising the diagonal tile;
+ *  - TRSM: solving the tiles below it by the diagonal one;
+ *  - SYRK and GEMM: updating trailing tiles by the GEMM kernel.
+ * Tasks on the next [lookahead] tiles columns go before other updates.
+ * No pivoting is needed, so a non-positive pivot means the matrix isn't
+ * positive definite, which makes the factorisation its cheapest test
+ */
+class TiledCholesky{
+public:
+    using elements_type     = double;
+    using matrix_type       = Matrix<elements_type>;
+    using sle_type          = Sle<elements_type>;
+    using vector_type       = std::vector<elements_type>;
+    using size_type         = std::size_t;
+    using result_roots_type = SleResult;
+
+    static constexpr size_type DEFAULT_TILE_SIZE = 128;
+    static constexpr size_type DEFAULT_LOOKAHEAD = 1;
+
+    /**
+     * Factorisation by tasks of [pool] on tiles of [tile_size] elements
+     * with [lookahead] tiles columns prioritised
+     */
+    explicit TiledCholesky(size_type tile_size = DEFAULT_TILE_SIZE,
+                            size_type lookahead = DEFAULT_LOOKAHEAD,
+                            ThreadPool& pool = ThreadPool::Instance());
+
+    /**
+     * Factorising square [matrix], only its lower triangle is read
+     * @return false if [matrix] isn't square or positive definite
+     */
+    bool Factorize(const matrix_type& matrix);
+
+    /**
+     * Factorising coefficients of [sle], its right-hand side is ignored
+     * @return false if the coefficient matrix isn't square or positive
+     * definite
+     */
+    bool Factorize(const sle_type& sle);
+
+    bool IsFactorized() const;
+
+    /**
+     * @return count of unknowns of the factorised system
+     */
+    size_type Size() const;
+
+    /**
+     * @return element of L with [row][column] coordinates
+     */
+    elements_type At(size_type row, size_type column) const;
+
+    /**
+     * Solving the system for right-hand side [rhs] by L y = b, L^T x = y
+     * @return roots, empty if nothing is factorised or [rhs] size differs
+     */
+    result_roots_type Solve(const vector_type& rhs) const;
+
+private:
+    using tiles_type = std::vector<elements_type,
+                                    AlignedAllocator<elements_type>>;
+
+    // Priorities of the tasks ready together
+    static constexpr TaskGraph::priority_type POTRF_PRIORITY = 2;
+    static constexpr TaskGraph::priority_type LOOKAHEAD_PRIORITY = 1;
+    static constexpr TaskGraph::priority_type UPDATE_PRIORITY = 0;
+    static constexpr TaskGraph::task_id_type NO_TASK =
+                        std::numeric_limits<TaskGraph::task_id_type>::max();
+
+    size_type tile_size_;
+    size_type lookahead_;
+    ThreadPool& pool_;
+    sle::dot_kernel_type dot_;
+    sle::axpy_kernel_type axpy_;
+    size_type size_;
+    size_type tiles_count_;
+    // Tiles (i, j), j <= i, by rows of tiles, tile_size_ rows each
+    tiles_type tiles_;
+    bool is_factorized_;
+
+    elements_type* Tile_(size_type tile_row, size_type tile_column);
+    const elements_type* Tile_(size_type tile_row,
+                                size_type tile_column) const;
+
+    /**
+     * @return count of rows of the [tile_i] tiles row
+     */
+    size_type TileRows_(size_type tile_i) const;
+
+    /**
+     * Copying the lower triangle of [size]x[size] block of [data] whose
+     * rows are [leading_dimension] elements apart into tiles and
+     * factorising it
+     */
+    bool Factorize_(const elements_type* data, size_type size,
+                    size_type leading_dimension);
+
+    /**
+     * Factorising the [step] diagonal tile in place
+     * @return false if a pivot isn't positive
+     */
+    bool FactorizeDiagonal_(size_type step);
+
+    /**
+     * Replacing tile ([tile_row], [step]) with itself times L_kk^-T
+     */
+    void SolveTile_(size_type tile_row, size_type step);
+};
+
+/**
+ * Solving systems with symmetric positive-definite coefficient matrices
+ * by TiledCholesky: half of the work and memory of LU
+ */
+class SleCholesky{
+public:
+    using matrix_type       = Sle<double>;
+    using result_roots_type = SleResult;
+
+    // Relative difference between a_ij and a_ji taken as symmetry
+    static constexpr double SYMMETRY_TOLERANCE = 1e-12;
+
+    /**
+     * Solver of [matrix] with tiles of [tile_size], [matrix] must outlive
+     * the solver
+     */
+    explicit SleCholesky(const matrix_type& matrix,
+                        size_t tile_size = TiledCholesky::DEFAULT_TILE_SIZE);
+
+    /**
+     * Cheap check of [matrix] coefficients before trying Cholesky: square,
+     * symmetric and with positive diagonal. Positive definiteness itself
+     * is found out by the factorisation
+     */
+    static bool IsSpdCandidate(const matrix_type& matrix);
+
+    /**
+     * @return roots, empty if the coefficient matrix isn't symmetric
+     * positive definite
+     */
+    result_roots_type Solve();
+
+private:
+    const matrix_type& matrix_;
+    TiledCholesky cholesky_;
+};
+
+}
+
+#endif
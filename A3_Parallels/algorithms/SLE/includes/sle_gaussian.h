@@ -2,11 +2,17 @@
 #define ACO
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <thread>
-#include <mutex>
 
+#include "sle_lu.h"
+#include "sle_tiled.h"
+#include "sle_simd.h"
+#include "sle_gaussian_fixed.h"
 #include "../../../utils/includes/utils.h"
+#include "../../../utils/includes/barrier.h"
+#include "../../../utils/includes/thread_pool.h"
 #include "../../../matrix/includes/sle.h"
 
 namespace s21{
@@ -28,7 +34,17 @@ public:
     using reverse_const_iterator_type
                             = typename matrix_type::reverse_const_iterator_type;
 
-    SleGaussianParent(matrix_type_reference matrix);
+    // Columns of U solved at once by back substitution
+    static constexpr row_size_type BACK_SUBSTITUTION_BLOCK = 64;
+    // Right-hand side rows updated by a thread at once
+    static constexpr row_size_type BACK_SUBSTITUTION_ROWS_BLOCK = 256;
+
+    /**
+     * Solver of a copy of [matrix]. Back substitution runs on up to
+     * [threads_count] threads of the shared pool
+     */
+    SleGaussianParent(matrix_type_reference matrix,
+                        size_t threads_count = 1);
     ~SleGaussianParent() = default;
 
     result_roots_type GaussianElimination();
@@ -40,6 +56,8 @@ protected:
     result_roots_type roots_;
     column_size_type equations_count_;
     column_size_type roots_count_;
+    size_t threads_count_;
+    sle::dot_kernel_type dot_;
 
     /**
      * Swapping [swapped_i] row with next row which doesn't have a value
@@ -49,8 +67,25 @@ protected:
      */
     bool SwapRow_(row_size_type swapped_i);
 
+    /**
+     * Forward elimination: reducing [matrix_] to the row echelon form
+     */
+    virtual void Eliminate_();
+
     virtual void ReduceRows_(row_size_type current_i) = 0;
 
+    /**
+     * Subtracting [current_i] row from [row_i] row, so that [current_i]
+     * factor of [row_i] row becomes zero
+     */
+    void ReduceRow_(row_size_type row_i, row_size_type current_i);
+
+    /**
+     * Zeroing factors below the diagonal left by an LU factorisation of
+     * the augmented matrix, which gives the row echelon form
+     */
+    void ClearLower_();
+
     void DetermineResult_();
 
     /**
@@ -60,9 +95,33 @@ protected:
      */
     bool DetermineSingular_();
 
+    /**
+     * Back substitution by blocks of BACK_SUBSTITUTION_BLOCK unknowns from
+     * the last one: the roots of a block are solved by its diagonal
+     * block, then the block columns times them are subtracted from the
+     * right-hand sides of all rows above by up to threads_count_ threads
+     * of the shared pool.
+     * Roots are written in place into the right-hand sides copy. Rows
+     * below the last unknown must hold with the roots of the leading ones
+     */
     void DetermineRoots_();
 
-    double DetermineRoot_(reverse_const_iterator_type& row_rev_it);
+    /**
+     * Solving roots [block_begin, block_end) by the diagonal block of
+     * rows with these numbers, unknowns of row i are [offset] + i
+     */
+    void SolveDiagonalBlock_(row_size_type block_begin,
+                            row_size_type block_end,
+                            column_size_type offset);
+
+    /**
+     * Subtracting factors of unknowns [block_begin, block_end) + [offset]
+     * times their roots from the right-hand sides of rows above
+     * [block_begin]
+     */
+    void UpdateRightSides_(row_size_type block_begin,
+                            row_size_type block_end,
+                            column_size_type offset);
 
     bool IsOneEquationSingular_();
 
@@ -79,21 +138,91 @@ private:
 
 class SleGaussianParellel : public SleGaussianParent{
 public:
-    using mutex_type            = std::recursive_mutex;
+    /**
+     * Elimination by up to [threads_count] workers. Every worker owns
+     * blocks of OWNED_ROWS_BLOCK rows dealt round-robin and reduces them by
+     * SIMD AXPY without locks, workers meet at a barrier once per pivot.
+     * The barrier needs every worker running at once, which ThreadPool
+     * tasks don't guarantee: a task queued behind a waiting one would never
+     * arrive. So workers are threads of their own, no more of them than
+     * ThreadPool::Instance() threads, which sleep meanwhile. If a worker
+     * can't be created, the system is eliminated by one thread
+     */
+    SleGaussianParellel(matrix_type_reference matrix,
+                        size_t threads_count =
+                            std::thread::hardware_concurrency());
+
+private:
+    static constexpr row_size_type OWNED_ROWS_BLOCK = 8;
+    // Smaller systems are eliminated by one thread: a barrier per pivot
+    // costs more than their row updates
+    static constexpr row_size_type MIN_PARALLEL_EQUATIONS = 128;
+
+    // Workers are released when all of them are created or cancelled if
+    // creating one fails
+    enum class StartState{
+        WAITING,
+        STARTED,
+        CANCELLED
+    };
 
-    SleGaussianParellel(matrix_type_reference matrix);
+    sle::axpy_kernel_type axpy_;
+    // Set by the barrier completion: no pivot for the current step
+    bool is_step_skipped_;
+
+    void Eliminate_();
+
+    void ReduceRows_(row_size_type current_i);
+
+    /**
+     * Worker body: reducing rows of [worker_i] blocks below every pivot
+     * of [steps_count] steps
+     */
+    void Worker_(size_t worker_i, size_t workers_count,
+                row_size_type steps_count, Barrier& barrier);
+
+    /**
+     * Subtracting [current_i] row from [row_i] row by axpy_
+     */
+    void ReduceRowSimd_(row_size_type row_i, row_size_type current_i);
+};
+
+class SleGaussianBlocked : public SleGaussianParent{
+public:
+    /**
+     * Elimination of square systems by BlockedLu with [threads_count]
+     * threads: partial pivoting and GEMM-based trailing updates. Other
+     * systems are eliminated as by SleGaussianUsual
+     */
+    SleGaussianBlocked(matrix_type_reference matrix,
+                        size_t threads_count =
+                            std::thread::hardware_concurrency());
 
 private:
-    mutex_type lock_;
+    BlockedLu lu_;
+
+    void Eliminate_();
 
     void ReduceRows_(row_size_type current_i);
+};
 
-    void ParallelReducing_(row_size_type row_i, row_size_type current_i);
+class SleGaussianTiled : public SleGaussianParent{
+public:
+    /**
+     * Elimination of square systems by TiledLu on tiles of [tile_size]:
+     * tasks of the factorisation are run as soon as their tiles are
+     * ready instead of meeting after every panel. Other systems are
+     * eliminated as by SleGaussianUsual
+     */
+    SleGaussianTiled(matrix_type_reference matrix,
+                    size_t tile_size = TiledLu::DEFAULT_TILE_SIZE);
+
+private:
+    TiledLu lu_;
 
-    void ParallelReduceRow_(row_size_type row_i,
-                        column_size_type column_i,
-                        row_size_type current_i,
-                        double multiplier);
+    void Eliminate_();
+
+    void ReduceRows_(row_size_type current_i);
 };
 
 }
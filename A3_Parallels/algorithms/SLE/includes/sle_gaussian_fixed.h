@@ -0,0 +1,62 @@
+#ifndef SLE_GAUSSIAN_FIXED_H
+#define SLE_GAUSSIAN_FIXED_H
+
+#include <cstddef>
+#include <utility>
+#include <array>
+
+#include "../../../matrix/includes/matrix_fixed.h"
+
+namespace s21{
+
+// Pivots not greater than it by absolute value are treated as zero
+constexpr double FIXED_PIVOT_EPSILON = 1e-10;
+
+template < class T, std::size_t Equations >
+struct FixedSleResult{
+    // false if the system is singular
+    bool is_solved;
+    std::array<T, Equations> equation_roots;
+};
+
+/**
+ * Gaussian elimination with partial pivoting for a system of
+ * [Equations] equations given as Matrix<T, Equations, Equations + 1>.
+ * Row updates are unrolled at compile time, the whole solution can be
+ * calculated in a constant expression
+ */
+template < class T, std::size_t Equations >
+struct FixedGaussian{
+    using system_type   = Matrix<T, Equations, Equations + 1>;
+    using result_type   = FixedSleResult<T, Equations>;
+    using columns_type  = std::make_index_sequence<Equations + 1>;
+
+    static constexpr result_type Solve(system_type system);
+
+private:
+    static constexpr T Abs_(T value);
+
+    static constexpr void SwapRows_(system_type& system, std::size_t first,
+                                    std::size_t second);
+
+    /**
+     * row[column] -= [multiplier] * pivot_row[column] for every column
+     */
+    template < std::size_t... Columns >
+    static constexpr void ReduceRow_(system_type& system, std::size_t row,
+                                    std::size_t pivot_row, T multiplier,
+                                    std::index_sequence<Columns...>);
+};
+
+/**
+ * @return roots of [system] found by FixedGaussian
+ */
+template < class T, std::size_t Equations >
+constexpr FixedSleResult<T, Equations> SolveGaussianFixed(
+                        const Matrix<T, Equations, Equations + 1>& system);
+
+}
+
+#include "../srcs/sle_gaussian_fixed_impl.h"
+
+#endif
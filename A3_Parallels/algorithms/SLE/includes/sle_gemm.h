@@ -0,0 +1,51 @@
+#ifndef SLE_GEMM_H
+#define SLE_GEMM_H
+
+#include <cstddef>
+
+namespace s21::sle{
+
+// Rows and columns of the result calculated by one micro kernel call
+constexpr std::size_t GEMM_MICRO_ROWS = 8;
+constexpr std::size_t GEMM_MICRO_COLUMNS = 8;
+
+/**
+ * Tile sizes of GemmSubtract: the packed [rows_block]x[inner_block] block
+ * of the first matrix is meant to stay in L2 cache and the packed
+ * [inner_block]x[columns_block] block of the second one in L3
+ */
+struct GemmBlocking{
+    std::size_t rows_block = 128;
+    std::size_t inner_block = 256;
+    std::size_t columns_block = 2048;
+};
+
+/**
+ * c -= a * b for [rows]x[inner] matrix [a], [inner]x[columns] matrix [b]
+ * and [rows]x[columns] matrix [c], all row-major with leading dimensions
+ * [lda], [ldb] and [ldc]. Operands are packed into tiles multiplied by an
+ * FMA micro kernel of the widest supported instruction set. Rows blocks
+ * are split between up to [threads_count] threads of the shared pool
+ */
+void GemmSubtract(std::size_t rows, std::size_t columns, std::size_t inner,
+                const double* a, std::size_t lda,
+                const double* b, std::size_t ldb,
+                double* c, std::size_t ldc,
+                std::size_t threads_count = 1,
+                const GemmBlocking& blocking = GemmBlocking());
+
+/**
+ * c -= a * b^T for [columns]x[inner] matrix [b], the rest is as for
+ * GemmSubtract
+ */
+void GemmSubtractTransposed(std::size_t rows, std::size_t columns,
+                            std::size_t inner,
+                            const double* a, std::size_t lda,
+                            const double* b, std::size_t ldb,
+                            double* c, std::size_t ldc,
+                            std::size_t threads_count = 1,
+                            const GemmBlocking& blocking = GemmBlocking());
+
+}
+
+#endif
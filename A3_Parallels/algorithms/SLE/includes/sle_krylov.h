@@ -0,0 +1,179 @@
+#ifndef SLE_KRYLOV_H
+#define SLE_KRYLOV_H
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+#include <cmath>
+
+#include "../../../utils/includes/utils.h"
+#include "../../../utils/includes/thread_pool.h"
+#include "../../../matrix/includes/sparse_matrix.h"
+
+namespace s21{
+
+enum class KrylovPreconditioner{
+    NONE,
+    // Inverse of the diagonal
+    JACOBI,
+    // Incomplete LU with the sparsity pattern of the matrix
+    ILU0
+};
+
+struct KrylovOptions{
+    // Relative residual ||b - Ax|| / ||b|| to stop at
+    double tolerance = 1e-10;
+    size_t max_iterations = 1000;
+    // Size of the GMRES basis before a restart
+    size_t restart = 30;
+    KrylovPreconditioner preconditioner = KrylovPreconditioner::JACOBI;
+};
+
+/**
+ * Iterative solvers of sparse systems: conjugate gradient for symmetric
+ * positive-definite matrices, BiCGSTAB and restarted GMRES for general
+ * ones. Memory is O(nonzeros + n) and every iteration costs one or two
+ * products by the matrix, which are split between threads of the pool
+ * along with the vector operations. BiCGSTAB and GMRES are
+ * preconditioned from the right, so their residuals are the ones of the
+ * original system
+ */
+class KrylovSolver{
+public:
+    using elements_type     = double;
+    using sparse_type       = SparseMatrix<elements_type>;
+    using vector_type       = std::vector<elements_type>;
+    using size_type         = std::size_t;
+    using result_roots_type = SleResult;
+
+    // Elements of vector operations handled by a thread at once
+    static constexpr size_type VECTOR_BLOCK = 4096;
+
+    /**
+     * Solver of square [matrix], which must outlive the solver. The
+     * preconditioner is built here
+     */
+    explicit KrylovSolver(const sparse_type& matrix,
+                        KrylovOptions options = KrylovOptions(),
+                        ThreadPool& pool = ThreadPool::Instance());
+
+    /**
+     * Preconditioned conjugate gradient, the matrix and the
+     * preconditioner must be symmetric positive definite
+     * @return roots and residual history, roots are empty if the system
+     * can't be solved. The last iterate if the tolerance isn't reached
+     */
+    result_roots_type ConjugateGradient(const vector_type& rhs) const;
+
+    /**
+     * Stabilized biconjugate gradient
+     * @return roots and residual history as ConjugateGradient does
+     */
+    result_roots_type BiCgStab(const vector_type& rhs) const;
+
+    /**
+     * GMRES restarted after every options.restart iterations
+     * @return roots and residual history as ConjugateGradient does
+     */
+    result_roots_type Gmres(const vector_type& rhs) const;
+
+private:
+    const sparse_type& matrix_;
+    KrylovOptions options_;
+    ThreadPool& pool_;
+    bool is_valid_;
+    vector_type inverse_diagonal_;
+    // ILU(0): L with unit diagonal and U in the pattern of the matrix
+    vector_type ilu_values_;
+    std::vector<size_type> diagonal_positions_;
+
+    /**
+     * Building the ILU(0) factors
+     * @return false if a pivot is zero or missing
+     */
+    bool BuildIlu_();
+
+    /**
+     * Checking the solver and the size of [rhs]
+     */
+    bool IsSolvable_(const vector_type& rhs) const;
+
+    /**
+     * [result] = M^-1 [vector] for the preconditioner M
+     */
+    void Precondition_(const vector_type& vector, vector_type& result) const;
+
+    /**
+     * Printing the error if [result] hasn't reached the tolerance
+     */
+    void CheckConvergence_(const result_roots_type& result,
+                            const char* function) const;
+
+    elements_type Dot_(const vector_type& x, const vector_type& y) const;
+    elements_type Norm_(const vector_type& x) const;
+
+    /**
+     * [y] = [alpha] * [x] + [beta] * [y]
+     */
+    void Combine_(elements_type alpha, const vector_type& x,
+                    elements_type beta, vector_type& y) const;
+
+    /**
+     * [residual] = [rhs] - A [x]
+     */
+    void Residual_(const vector_type& rhs, const vector_type& x,
+                    vector_type& residual) const;
+
+    /**
+     * Calling [body](begin, end, block_i) for blocks of VECTOR_BLOCK
+     * indices of [0, [size]) by threads of the pool
+     */
+    template < class Function >
+    void ForBlocks_(size_type size, Function body) const;
+};
+
+/**
+ * Solver of a sparse SLE given by its augmented matrix: the last column
+ * is the right-hand side, as in Sle. Conjugate gradient is tried first
+ * for a symmetric coefficient matrix with positive diagonal, GMRES is
+ * used for other ones and if conjugate gradient doesn't converge
+ */
+class SleKrylov{
+public:
+    using sparse_type       = KrylovSolver::sparse_type;
+    using vector_type       = KrylovSolver::vector_type;
+    using result_roots_type = SleResult;
+
+    // Relative difference between a_ij and a_ji taken as symmetry
+    static constexpr double SYMMETRY_TOLERANCE = 1e-12;
+
+    /**
+     * Solver of [augmented] matrix, coefficients and the right-hand side
+     * are copied out of it
+     */
+    explicit SleKrylov(const sparse_type& augmented,
+                        KrylovOptions options = KrylovOptions(),
+                        ThreadPool& pool = ThreadPool::Instance());
+
+    /**
+     * Cheap check of square [matrix] before trying conjugate gradient:
+     * symmetric and with positive diagonal
+     */
+    static bool IsSpdCandidate(const sparse_type& matrix);
+
+    /**
+     * @return roots and residual history, roots are empty if the
+     * augmented matrix isn't n x (n + 1) or the system can't be solved
+     */
+    result_roots_type Solve() const;
+
+private:
+    sparse_type matrix_;
+    vector_type rhs_;
+    KrylovOptions options_;
+    ThreadPool& pool_;
+};
+
+}
+
+#endif
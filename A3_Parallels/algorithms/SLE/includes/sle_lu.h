@@ -0,0 +1,177 @@
+#ifndef SLE_LU_H
+#define SLE_LU_H
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <thread>
+#include <cmath>
+
+#include "sle_simd.h"
+#include "sle_gemm.h"
+#include "../../../utils/includes/utils.h"
+#include "../../../utils/includes/thread_pool.h"
+#include "../../../matrix/includes/matrix.h"
+#include "../../../matrix/includes/sle.h"
+
+namespace s21{
+
+/**
+ * Right-looking blocked LU factorisation with partial pivoting: PA = LU.
+ * Every panel of panel_width columns is factorised by rank-1 updates,
+ * then the block row of U right of it is found by a triangular solve and
+ * the trailing matrix is updated by the tiled GEMM kernel, so most of
+ * the work runs at matrix-multiplication speed. L (unit diagonal, not
+ * stored) and U replace the matrix
+ */
+class BlockedLu{
+public:
+    using elements_type     = double;
+    using matrix_type       = Matrix<elements_type>;
+    using size_type         = std::size_t;
+    using permutation_type  = std::vector<size_type>;
+
+    static constexpr size_type DEFAULT_PANEL_WIDTH = 64;
+
+    /**
+     * Factorisation by up to [threads_count] threads of the shared pool
+     * with panels of [panel_width] columns
+     */
+    explicit BlockedLu(size_t threads_count =
+                            std::thread::hardware_concurrency(),
+                        size_type panel_width = DEFAULT_PANEL_WIDTH,
+                        sle::GemmBlocking blocking = sle::GemmBlocking());
+
+    /**
+     * Factorising square [matrix] in place. Row i of the factors is row
+     * [permutation][i] of the original matrix
+     * @return false if [matrix] isn't square or is singular
+     */
+    bool Factorize(matrix_type& matrix, permutation_type& permutation) const;
+
+    /**
+     * Factorising the leading [size]x[size] block of [data] whose rows
+     * are [leading_dimension] elements apart. Rows are swapped and
+     * updated as [row_length] elements long, so columns right of the
+     * block are turned into L^-1 P B: right-hand sides of an augmented
+     * matrix come out ready for back substitution
+     * @return count of zero pivots, 0 if the block is nonsingular
+     */
+    size_type Factorize(elements_type* data, size_type size,
+                        size_type leading_dimension, size_type row_length,
+                        permutation_type& permutation) const;
+
+private:
+    size_t threads_count_;
+    size_type panel_width_;
+    sle::GemmBlocking blocking_;
+    sle::axpy_kernel_type axpy_;
+
+    /**
+     * Factorising columns [panel_begin, panel_end) of rows from
+     * panel_begin down to [size] by rank-1 updates
+     * @return count of zero pivots of the panel
+     */
+    size_type FactorizePanel_(elements_type* data, size_type size,
+                            size_type leading_dimension,
+                            size_type row_length, size_type panel_begin,
+                            size_type panel_end,
+                            permutation_type& permutation) const;
+
+    /**
+     * Replacing rows [panel_begin, panel_end) right of the panel with
+     * L11^-1 times them
+     */
+    void SolveBlockRow_(elements_type* data, size_type leading_dimension,
+                        size_type row_length, size_type panel_begin,
+                        size_type panel_end) const;
+};
+
+/**
+ * Factor-once, solve-many solver: the coefficient matrix is factorised
+ * by BlockedLu once, every following solve costs only the O(n^2)
+ * forward and back substitutions. Right-hand sides given as columns of
+ * a matrix are solved in blocks of RHS_BLOCK columns by threads of the
+ * shared pool
+ */
+class LuSolver{
+public:
+    using elements_type     = double;
+    using matrix_type       = Matrix<elements_type>;
+    using matrix_unique_ptr = std::unique_ptr<matrix_type>;
+    using sle_type          = Sle<elements_type>;
+    using vector_type       = std::vector<elements_type>;
+    using size_type         = std::size_t;
+    using permutation_type  = BlockedLu::permutation_type;
+    using result_roots_type = SleResult;
+
+    // Right-hand sides substituted together by one thread
+    static constexpr size_type RHS_BLOCK = 16;
+
+    explicit LuSolver(size_t threads_count =
+                            std::thread::hardware_concurrency());
+
+    /**
+     * Factorising square [matrix], previous factors are dropped
+     * @return false if [matrix] isn't square or is singular
+     */
+    bool Factorize(const matrix_type& matrix);
+
+    /**
+     * Factorising coefficients of [sle], its right-hand side is ignored
+     * @return false if the coefficient matrix isn't square or is singular
+     */
+    bool Factorize(const sle_type& sle);
+
+    bool IsFactorized() const;
+
+    /**
+     * @return count of unknowns of the factorised system
+     */
+    size_type Size() const;
+
+    const matrix_type& Factors() const;
+    const permutation_type& Permutation() const;
+
+    /**
+     * Solving the system for right-hand side [rhs]
+     * @return roots, empty if nothing is factorised or [rhs] size differs
+     */
+    result_roots_type Solve(const vector_type& rhs) const;
+
+    /**
+     * Solving the system for every column of [rhs] into the same column
+     * of [solutions]. Empty [solutions] is replaced with a matrix of
+     * [rhs] sizes, one of these sizes is reused
+     * @return false if nothing is factorised, [rhs] rows count differs or
+     * [solutions] has other sizes
+     */
+    bool Solve(const matrix_type& rhs, matrix_type& solutions) const;
+
+private:
+    size_t threads_count_;
+    BlockedLu lu_;
+    matrix_unique_ptr factors_;
+    permutation_type permutation_;
+    bool is_factorized_;
+    sle::axpy_kernel_type axpy_;
+    sle::dot_kernel_type dot_;
+
+    /**
+     * Checking that the solver is factorised for [rhs_size] unknowns
+     */
+    bool IsSolvable_(size_type rhs_size) const;
+
+    /**
+     * Substituting columns [column_begin, column_end) of [solutions]
+     * holding permuted right-hand sides
+     */
+    void SubstituteColumns_(matrix_type& solutions, size_type column_begin,
+                            size_type column_end) const;
+};
+
+}
+
+#endif
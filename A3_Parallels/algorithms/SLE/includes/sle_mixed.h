@@ -0,0 +1,196 @@
+#ifndef SLE_MIXED_H
+#define SLE_MIXED_H
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <thread>
+#include <cmath>
+
+#include "sle_lu.h"
+#include "sle_simd.h"
+#include "../../../utils/includes/utils.h"
+#include "../../../utils/includes/thread_pool.h"
+#include "../../../matrix/includes/matrix.h"
+#include "../../../matrix/includes/matrix_storage.h"
+#include "../../../matrix/includes/sle.h"
+
+namespace s21{
+
+/**
+ * Mixed precision solver: the matrix is factorised by blocked LU with
+ * partial pivoting in float, which halves the memory traffic and doubles
+ * the SIMD width, then roots are refined in double: the residual
+ * b - Ax is found with double coefficients and the correction solved
+ * with float factors is added to the roots. Refinement stops when
+ * ||b - Ax|| <= ||A|| ||x|| eps sqrt(n) in the max norm, the accuracy of
+ * double LU. If that isn't reached in max_refinements steps, the
+ * residual stops falling or float factorisation fails (a pivot is zero
+ * or an element is out of float range), the matrix is factorised in
+ * double once and solved as by LuSolver
+ */
+class MixedLuSolver{
+public:
+    using elements_type     = double;
+    using factor_type       = float;
+    using matrix_type       = Matrix<elements_type>;
+    using matrix_unique_ptr = std::unique_ptr<matrix_type>;
+    using sle_type          = Sle<elements_type>;
+    using vector_type       = std::vector<elements_type>;
+    using factors_type      = std::vector<factor_type,
+                                            AlignedAllocator<factor_type>>;
+    using size_type         = std::size_t;
+    using permutation_type  = std::vector<size_type>;
+    using result_roots_type = SleResult;
+
+    static constexpr size_type DEFAULT_PANEL_WIDTH = 64;
+    // As in LAPACK dsgesv: more steps hardly ever help
+    static constexpr size_type DEFAULT_MAX_REFINEMENTS = 30;
+
+    /**
+     * Solver using up to [threads_count] threads of the shared pool and
+     * panels of [panel_width] columns
+     */
+    explicit MixedLuSolver(size_type max_refinements =
+                                DEFAULT_MAX_REFINEMENTS,
+                            size_t threads_count =
+                                std::thread::hardware_concurrency(),
+                            size_type panel_width = DEFAULT_PANEL_WIDTH);
+
+    /**
+     * Factorising square [matrix] in float, previous factors are dropped.
+     * [matrix] is copied for residuals
+     * @return false if [matrix] isn't square or is singular in double
+     */
+    bool Factorize(const matrix_type& matrix);
+
+    /**
+     * Factorising coefficients of [sle], its right-hand side is ignored
+     * @return false if the coefficient matrix isn't square or is singular
+     */
+    bool Factorize(const sle_type& sle);
+
+    bool IsFactorized() const;
+
+    /**
+     * @return true if the solver has fallen back to double factors
+     */
+    bool IsFallback() const;
+
+    /**
+     * @return count of unknowns of the factorised system
+     */
+    size_type Size() const;
+
+    /**
+     * Solving the system for right-hand side [rhs], the matrix is
+     * factorised in double here if refinement fails
+     * @return roots and ||b - Ax|| / ||b|| in the max norm after the
+     * float solve and every following step, the last one is the achieved
+     * residual. Roots are empty if nothing is factorised or [rhs] size
+     * differs
+     */
+    result_roots_type Solve(const vector_type& rhs);
+
+private:
+    size_type max_refinements_;
+    size_t threads_count_;
+    size_type panel_width_;
+    matrix_unique_ptr matrix_;
+    factors_type factors_;
+    size_type leading_dimension_;
+    permutation_type permutation_;
+    elements_type matrix_norm_;
+    bool is_factorized_;
+    bool is_fallback_;
+    LuSolver lu_;
+    sle::float_axpy_kernel_type axpy_;
+    sle::dot_kernel_type dot_;
+
+    /**
+     * Factorising matrix_ in float or in double if float fails
+     * @return false if matrix_ is singular in double
+     */
+    bool Factorize_();
+
+    /**
+     * Factorising the float copy of matrix_ in place
+     * @return false if a pivot is zero or an element is out of float range
+     */
+    bool FactorizeFloat_();
+
+    /**
+     * Factorising columns [panel_begin, panel_end) of the float factors
+     * @return false if a pivot is zero or not finite
+     */
+    bool FactorizePanel_(size_type panel_begin, size_type panel_end);
+
+    /**
+     * Replacing rows [panel_begin, panel_end) right of the panel with
+     * L11^-1 times them and subtracting L21 times them from the trailing
+     * rows
+     */
+    void UpdateTrailing_(size_type panel_begin, size_type panel_end);
+
+    /**
+     * Falling back to double factors
+     * @return false if the matrix is singular in double too
+     */
+    bool FallBack_();
+
+    /**
+     * Checking that the solver is factorised for [rhs_size] unknowns
+     */
+    bool IsSolvable_(size_type rhs_size) const;
+
+    /**
+     * Solving the system with float factors for [rhs] into [roots].
+     * [rhs] is divided by [scale] before rounding to float and roots are
+     * multiplied by it, so tiny residuals don't underflow
+     */
+    void SolveFloat_(const vector_type& rhs, elements_type scale,
+                    vector_type& roots) const;
+
+    /**
+     * [residual] = [rhs] - A [roots] in double
+     */
+    void Residual_(const vector_type& rhs, const vector_type& roots,
+                    vector_type& residual) const;
+};
+
+/**
+ * Mixed precision solver of an SLE given by its augmented matrix, see
+ * MixedLuSolver
+ */
+class SleMixedLu{
+public:
+    using matrix_type       = Sle<double>;
+    using result_roots_type = SleResult;
+
+    /**
+     * Solver of [matrix], which must outlive the solver
+     */
+    explicit SleMixedLu(const matrix_type& matrix,
+                        size_t threads_count =
+                            std::thread::hardware_concurrency());
+
+    /**
+     * @return roots and residual history, see MixedLuSolver::Solve. Roots
+     * are empty if the coefficient matrix isn't square or is singular
+     */
+    result_roots_type Solve();
+
+    /**
+     * @return true if the last Solve() has fallen back to double
+     */
+    bool IsFallback() const;
+
+private:
+    const matrix_type& matrix_;
+    MixedLuSolver solver_;
+};
+
+}
+
+#endif
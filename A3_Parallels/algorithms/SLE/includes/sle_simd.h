@@ -0,0 +1,48 @@
+#ifndef SLE_SIMD_H
+#define SLE_SIMD_H
+
+#include <cstddef>
+
+namespace s21::sle{
+
+/**
+ * y[i] += [alpha] * x[i] for i in [0, [count]). AVX2 and AVX-512 kernels
+ * use FMA, so every element is rounded once instead of twice
+ */
+using axpy_kernel_type = void (*)(std::size_t count, double alpha,
+                                const double* x, double* y);
+
+/**
+ * y[i] += [alpha] * x[i] for i in [0, [count]) in single precision: a
+ * vector register holds twice as many elements as for double
+ */
+using float_axpy_kernel_type = void (*)(std::size_t count, float alpha,
+                                        const float* x, float* y);
+
+/**
+ * @return sum of x[i] * y[i] for i in [0, [count])
+ */
+using dot_kernel_type = double (*)(std::size_t count, const double* x,
+                                const double* y);
+
+/**
+ * @return AXPY kernel of the widest instruction set supported by the CPU
+ */
+axpy_kernel_type GetAxpyKernel();
+
+/**
+ * @return single precision AXPY kernel of the widest instruction set
+ * supported by the CPU
+ */
+float_axpy_kernel_type GetFloatAxpyKernel();
+
+/**
+ * @return dot product kernel of the widest instruction set supported by
+ * the CPU. Partial sums are kept in vector lanes, so the result may
+ * differ from the sequential sum by rounding
+ */
+dot_kernel_type GetDotKernel();
+
+}
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef SLE_TILED_H
+#define SLE_TILED_H
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <atomic>
+#include <vector>
+#include <cmath>
+
+#include "sle_simd.h"
+#include "sle_gemm.h"
+#include "../../../utils/includes/utils.h"
+#include "../../../utils/includes/thread_pool.h"
+#include "../../../utils/includes/task_graph.h"
+#include "../../../matrix/includes/matrix.h"
+
+namespace s21{
+
+/**
+ * Tiled LU factorisation with partial pivoting: PA = LU, same factors as
+ * BlockedLu gives. The matrix is cut into tiles of tile_size columns and
+ * rows, and every step is split into tasks of a TaskGraph:
+ *  - panel: factorising the tiles column of the step;
+ *  - block row: swapping rows of one tiles column right of the panel and
+ *    solving its tile of U;
+ *  - update: subtracting the product of an L tile and a U tile from one
+ *    trailing tile by the GEMM kernel.
+ * A task waits only for the tasks writing tiles it touches, so the next
+ * panel is factorised while the rest of the trailing matrix is still
+ * updated. Tasks on the next [lookahead] tiles columns go before other
+ * updates ready with them, so the panels, the critical path of the
+ * factorisation, aren't delayed
+ */
+class TiledLu{
+public:
+    using elements_type     = double;
+    using matrix_type       = Matrix<elements_type>;
+    using size_type         = std::size_t;
+    using permutation_type  = std::vector<size_type>;
+
+    static constexpr size_type DEFAULT_TILE_SIZE = 128;
+    static constexpr size_type DEFAULT_LOOKAHEAD = 1;
+
+    /**
+     * Factorisation by tasks of [pool] on tiles of [tile_size] elements
+     * with [lookahead] tiles columns prioritised
+     */
+    explicit TiledLu(size_type tile_size = DEFAULT_TILE_SIZE,
+                    size_type lookahead = DEFAULT_LOOKAHEAD,
+                    ThreadPool& pool = ThreadPool::Instance());
+
+    /**
+     * Factorising square [matrix] in place. Row i of the factors is row
+     * [permutation][i] of the original matrix
+     * @return false if [matrix] isn't square or is singular
+     */
+    bool Factorize(matrix_type& matrix, permutation_type& permutation) const;
+
+    /**
+     * Factorising the leading [size]x[size] block of [data] whose rows
+     * are [leading_dimension] elements apart. Columns up to [row_length]
+     * are swapped and updated as by BlockedLu::Factorize
+     * @return count of zero pivots, 0 if the block is nonsingular
+     * @throw the first exception thrown by the tasks
+     */
+    size_type Factorize(elements_type* data, size_type size,
+                        size_type leading_dimension, size_type row_length,
+                        permutation_type& permutation) const;
+
+private:
+    // Priorities of the tasks ready together
+    static constexpr TaskGraph::priority_type PANEL_PRIORITY = 2;
+    static constexpr TaskGraph::priority_type LOOKAHEAD_PRIORITY = 1;
+    static constexpr TaskGraph::priority_type UPDATE_PRIORITY = 0;
+
+    size_type tile_size_;
+    size_type lookahead_;
+    ThreadPool& pool_;
+    sle::axpy_kernel_type axpy_;
+
+    /**
+     * Factorising columns [panel_begin, panel_end) of rows from
+     * panel_begin down to [size]. Rows are swapped inside the panel only,
+     * the row swapped with row i is kept in [pivots][i]
+     * @return count of zero pivots of the panel
+     */
+    size_type FactorizePanel_(elements_type* data, size_type size,
+                            size_type leading_dimension,
+                            size_type panel_begin, size_type panel_end,
+                            permutation_type& pivots) const;
+
+    /**
+     * Swapping rows of columns [column_begin, column_end) by [pivots] of
+     * the panel and replacing rows [panel_begin, panel_end) of them with
+     * L11^-1 times them
+     */
+    void SolveBlockRow_(elements_type* data, size_type leading_dimension,
+                        size_type panel_begin, size_type panel_end,
+                        size_type column_begin, size_type column_end,
+                        const permutation_type& pivots) const;
+
+    /**
+     * Swapping rows of L left of every panel by the pivots of the panel
+     * and turning [pivots] into the rows [permutation]
+     */
+    void ApplyPivots_(elements_type* data, size_type size,
+                    size_type leading_dimension,
+                    const permutation_type& pivots,
+                    permutation_type& permutation) const;
+};
+
+}
+
+#endif
@@ -0,0 +1,310 @@
+#include "../includes/sle_cholesky.h"
+
+namespace s21{
+
+TiledCholesky::TiledCholesky(size_type tile_size, size_type lookahead,
+                            ThreadPool& pool)
+                            : tile_size_(tile_size ? tile_size : 1),
+                                lookahead_(lookahead),
+                                pool_(pool),
+                                dot_(sle::GetDotKernel()),
+                                axpy_(sle::GetAxpyKernel()),
+                                size_(0),
+                                tiles_count_(0),
+                                is_factorized_(false) { }
+
+bool TiledCholesky::Factorize(const matrix_type& matrix){
+    if (matrix.RowsSize() != matrix.ColumnsSize()){
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
+                    "Invalid matrix: Only square matrices can be factorized");
+        is_factorized_ = false;
+        return false;
+    }
+    return Factorize_(matrix.Data(), matrix.RowsSize(),
+                        matrix.LeadingDimension());
+}
+
+bool TiledCholesky::Factorize(const sle_type& sle){
+    if (sle.ColumnsSize() != sle.RowsSize() + 1){
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
+                    "Invalid matrix: Coefficient matrix must be square");
+        is_factorized_ = false;
+        return false;
+    }
+    return Factorize_(sle.Data(), sle.RowsSize(), sle.LeadingDimension());
+}
+
+bool TiledCholesky::IsFactorized() const{
+    return is_factorized_;
+}
+
+TiledCholesky::size_type TiledCholesky::Size() const{
+    return is_factorized_ ? size_ : 0;
+}
+
+TiledCholesky::elements_type TiledCholesky::At(size_type row,
+                                            size_type column) const{
+    if (column > row) return 0;
+    return Tile_(row / tile_size_, column / tile_size_)[
+        row % tile_size_ * tile_size_ + column % tile_size_
+    ];
+}
+
+TiledCholesky::result_roots_type TiledCholesky::Solve(
+                                            const vector_type& rhs) const{
+    result_roots_type result;
+
+    if (!is_factorized_){
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
+                    "Invalid solver: No matrix is factorized");
+        return result;
+    }
+    if (rhs.size() != size_){
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
+                    "Invalid right-hand side: Size differs from "
+                    "the factorized matrix one");
+        return result;
+    }
+
+    const size_type tile = tile_size_;
+    vector_type& roots = result.equation_roots;
+
+    roots = rhs;
+    // L y = b by tiles rows
+    for (size_type tile_i = 0; tile_i < tiles_count_; tile_i++){
+        const size_type rows = TileRows_(tile_i);
+        elements_type* part = roots.data() + tile_i * tile;
+
+        for (size_type tile_j = 0; tile_j < tile_i; tile_j++){
+            const elements_type* factors = Tile_(tile_i, tile_j);
+            const elements_type* solved = roots.data() + tile_j * tile;
+
+            for (size_type row = 0; row < rows; row++){
+                part[row] -= dot_(tile, factors + row * tile, solved);
+            }
+        }
+
+        const elements_type* diagonal = Tile_(tile_i, tile_i);
+
+        for (size_type row = 0; row < rows; row++){
+            part[row] = (part[row] - dot_(row, diagonal + row * tile, part)) /
+                        diagonal[row * tile + row];
+        }
+    }
+    // L^T x = y by tiles columns of L from the last one
+    for (size_type tile_i = tiles_count_; tile_i-- > 0;){
+        const size_type rows = TileRows_(tile_i);
+        elements_type* part = roots.data() + tile_i * tile;
+
+        for (size_type tile_j = tile_i + 1; tile_j < tiles_count_; tile_j++){
+            const elements_type* factors = Tile_(tile_j, tile_i);
+            const elements_type* solved = roots.data() + tile_j * tile;
+
+            for (size_type row = 0; row < TileRows_(tile_j); row++){
+                axpy_(rows, -solved[row], factors + row * tile, part);
+            }
+        }
+
+        const elements_type* diagonal = Tile_(tile_i, tile_i);
+
+        for (size_type row = rows; row-- > 0;){
+            part[row] /= diagonal[row * tile + row];
+            axpy_(row, -part[row], diagonal + row * tile, part);
+        }
+    }
+    return result;
+}
+
+TiledCholesky::elements_type* TiledCholesky::Tile_(size_type tile_row,
+                                                size_type tile_column){
+    return tiles_.data() + (tile_row * (tile_row + 1) / 2 + tile_column) *
+                            tile_size_ * tile_size_;
+}
+
+const TiledCholesky::elements_type* TiledCholesky::Tile_(
+                                            size_type tile_row,
+                                            size_type tile_column) const{
+    return tiles_.data() + (tile_row * (tile_row + 1) / 2 + tile_column) *
+                            tile_size_ * tile_size_;
+}
+
+TiledCholesky::size_type TiledCholesky::TileRows_(size_type tile_i) const{
+    return std::min(tile_size_, size_ - tile_i * tile_size_);
+}
+
+bool TiledCholesky::Factorize_(const elements_type* data, size_type size,
+                                size_type leading_dimension){
+    const size_type tile = tile_size_;
+
+    size_ = size;
+    tiles_count_ = (size + tile - 1) / tile;
+    tiles_.assign(tiles_count_ * (tiles_count_ + 1) / 2 * tile * tile, 0);
+    for (size_type row = 0; row < size; row++){
+        const elements_type* source = data + row * leading_dimension;
+
+        for (size_type tile_j = 0; tile_j <= row / tile; tile_j++){
+            const size_type column_begin = tile_j * tile;
+            const size_type column_end = std::min(column_begin + tile,
+                                                row + 1);
+
+            std::copy(source + column_begin, source + column_end,
+                        Tile_(row / tile, tile_j) + row % tile * tile);
+        }
+    }
+
+    std::atomic<bool> is_failed(false);
+    TaskGraph graph(pool_);
+    // Last task writing every tile
+    std::vector<TaskGraph::task_id_type> writers(
+        tiles_count_ * (tiles_count_ + 1) / 2,
+        NO_TASK
+    );
+    auto writer = [&writers](size_type tile_row, size_type tile_column)
+                    -> TaskGraph::task_id_type& {
+        return writers[tile_row * (tile_row + 1) / 2 + tile_column];
+    };
+    auto add = [&](auto task, TaskGraph::priority_type priority,
+                    size_type tile_row, size_type tile_column){
+        const auto task_id = graph.Add(
+            [task, &is_failed](){
+                if (!is_failed.load(std::memory_order_relaxed)) task();
+            },
+            priority
+        );
+
+        if (writer(tile_row, tile_column) != NO_TASK){
+            graph.Precede(writer(tile_row, tile_column), task_id);
+        }
+        writer(tile_row, tile_column) = task_id;
+        return task_id;
+    };
+
+    for (size_type step = 0; step < tiles_count_; step++){
+        const auto potrf = add(
+            [this, step, &is_failed](){
+                if (!FactorizeDiagonal_(step)) is_failed = true;
+            },
+            POTRF_PRIORITY, step, step
+        );
+        std::vector<TaskGraph::task_id_type> trsms(tiles_count_, NO_TASK);
+
+        for (size_type tile_i = step + 1; tile_i < tiles_count_; tile_i++){
+            trsms[tile_i] = add(
+                [this, tile_i, step](){ SolveTile_(tile_i, step); },
+                LOOKAHEAD_PRIORITY, tile_i, step
+            );
+            graph.Precede(potrf, trsms[tile_i]);
+        }
+        for (size_type tile_j = step + 1; tile_j < tiles_count_; tile_j++){
+            const TaskGraph::priority_type priority =
+                tile_j <= step + lookahead_ ? LOOKAHEAD_PRIORITY
+                                            : UPDATE_PRIORITY;
+
+            for (size_type tile_i = tile_j; tile_i < tiles_count_;
+                    tile_i++){
+                // A_ij -= L_ik * L_jk^T, SYRK on the diagonal updates
+                // the whole tile, its upper part is never read
+                const auto update = add(
+                    [this, tile_i, tile_j, step](){
+                        sle::GemmSubtractTransposed(
+                            TileRows_(tile_i), TileRows_(tile_j),
+                            TileRows_(step),
+                            Tile_(tile_i, step), tile_size_,
+                            Tile_(tile_j, step), tile_size_,
+                            Tile_(tile_i, tile_j), tile_size_
+                        );
+                    },
+                    priority, tile_i, tile_j
+                );
+
+                graph.Precede(trsms[tile_i], update);
+                if (tile_j != tile_i) graph.Precede(trsms[tile_j], update);
+            }
+        }
+    }
+    graph.Run();
+    is_factorized_ = !is_failed;
+    return is_factorized_;
+}
+
+bool TiledCholesky::FactorizeDiagonal_(size_type step){
+    const size_type tile = tile_size_;
+    const size_type rows = TileRows_(step);
+    elements_type* diagonal = Tile_(step, step);
+
+    for (size_type column = 0; column < rows; column++){
+        elements_type* pivot_row = diagonal + column * tile;
+        const elements_type pivot = pivot_row[column] -
+                                    dot_(column, pivot_row, pivot_row);
+
+        // Also false for NaN
+        if (!(pivot > 0)) return false;
+        pivot_row[column] = std::sqrt(pivot);
+        for (size_type row_i = column + 1; row_i < rows; row_i++){
+            elements_type* row = diagonal + row_i * tile;
+
+            row[column] = (row[column] - dot_(column, row, pivot_row)) /
+                            pivot_row[column];
+        }
+    }
+    return true;
+}
+
+void TiledCholesky::SolveTile_(size_type tile_row, size_type step){
+    const size_type tile = tile_size_;
+    const size_type columns = TileRows_(step);
+    const elements_type* diagonal = Tile_(step, step);
+    elements_type* solved = Tile_(tile_row, step);
+
+    // x L_kk^T = a for every row: x_j = (a_j - x L_kk[j][0..j)) / l_jj
+    for (size_type row_i = 0; row_i < TileRows_(tile_row); row_i++){
+        elements_type* row = solved + row_i * tile;
+
+        for (size_type column = 0; column < columns; column++){
+            const elements_type* factors = diagonal + column * tile;
+
+            row[column] = (row[column] - dot_(column, row, factors)) /
+                            factors[column];
+        }
+    }
+}
+
+
+SleCholesky::SleCholesky(const matrix_type& matrix, size_t tile_size)
+                        : matrix_(matrix), cholesky_(tile_size) { }
+
+bool SleCholesky::IsSpdCandidate(const matrix_type& matrix){
+    const size_t size = matrix.RowsSize();
+
+    if (!size || matrix.ColumnsSize() != size + 1) return false;
+    for (size_t row = 0; row < size; row++){
+        if (!(matrix[row][row] > 0)) return false;
+        for (size_t column = 0; column < row; column++){
+            const double value = matrix[row][column];
+            const double mirrored = matrix[column][row];
+
+            if (std::abs(value - mirrored) > SYMMETRY_TOLERANCE *
+                    std::max(std::abs(value), std::abs(mirrored))){
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+SleCholesky::result_roots_type SleCholesky::Solve(){
+    if (!IsSpdCandidate(matrix_) || !cholesky_.Factorize(matrix_)){
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
+                    "Invalid matrix: Coefficient matrix isn't symmetric "
+                    "positive definite");
+        return result_roots_type();
+    }
+
+    const size_t size = matrix_.RowsSize();
+    std::vector<double> rhs(size);
+
+    for (size_t row = 0; row < size; row++) rhs[row] = matrix_[row][size];
+    return cholesky_.Solve(rhs);
+}
+
+}
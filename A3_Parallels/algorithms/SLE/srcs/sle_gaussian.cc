@@ -2,8 +2,11 @@
 
 namespace s21{
 
-SleGaussianParent::SleGaussianParent(matrix_type_reference matrix)
-                    : matrix_(new matrix_type(matrix)){
+SleGaussianParent::SleGaussianParent(matrix_type_reference matrix,
+                                    size_t threads_count)
+                    : matrix_(new matrix_type(matrix)),
+                        threads_count_(threads_count ? threads_count : 1),
+                        dot_(sle::GetDotKernel()){
     equations_count_ = matrix_->RowsSize();
     roots_count_ = matrix_->ColumnsSize() - 1;
 }
@@ -14,31 +17,7 @@ SleGaussianParent::result_roots_type SleGaussianParent::GaussianElimination(){
         return roots_;
     }
 
-    for(row_size_type current_i = 0;
-        current_i < matrix_->RowsSize() - 1 &&
-        current_i < matrix_->ColumnsSize() - 1;
-        current_i++
-    ){
-        // std::cout << (*matrix_)[current_i] << std::endl;
-        if(DoubleCompare((*matrix_)[current_i][current_i], 0) &&
-            SwapRow_(current_i)
-        ){
-            continue ;
-        }
-        ReduceRows_(current_i);
-            // {
-            //     for(const_iterator_type row_it = matrix_->Begin();
-            //         row_it != matrix_->End();
-            //         ++row_it){
-            //         for(auto& elem : *row_it){
-            //             std::cout << elem << "  ";
-            //         }
-            //         std::cout << std::endl;
-            //     }
-            //     std::cout << std::endl << std::endl;
-            // }
-        // if (current_i == 2) exit(0);
-    }
+    Eliminate_();
     DetermineResult_();
     return roots_;
 }
@@ -81,16 +60,36 @@ bool SleGaussianParent::SwapRow_(row_size_type swapped_i){
         row_i++
     ){
         if((*matrix_)[row_i][swapped_i] != 0){
-            std::iter_swap(
-                matrix_->Begin() + row_i,
-                matrix_->Begin() + swapped_i
-            );
+            matrix_->SwapRows(row_i, swapped_i);
             return false;
         }
     }
     return true;
 }
 
+void SleGaussianParent::Eliminate_(){
+    for(row_size_type current_i = 0;
+        current_i < matrix_->RowsSize() - 1 &&
+        current_i < matrix_->ColumnsSize() - 1;
+        current_i++
+    ){
+        if(DoubleCompare((*matrix_)[current_i][current_i], 0) &&
+            SwapRow_(current_i)
+        ){
+            continue ;
+        }
+        ReduceRows_(current_i);
+    }
+}
+
+void SleGaussianParent::ClearLower_(){
+    for(row_size_type row_i = 1; row_i < equations_count_; row_i++){
+        double* row = (*matrix_)[row_i].data();
+
+        std::fill(row, row + row_i, 0.0);
+    }
+}
+
 void SleGaussianParent::DetermineResult_(){
     if(!DetermineSingular_()){
         DetermineRoots_();
@@ -99,7 +98,12 @@ void SleGaussianParent::DetermineResult_(){
 
 bool SleGaussianParent::DetermineSingular_(){
     bool is_singular;
-    reverse_iterator_type last_equation_it = matrix_->Rbegin();
+    // Equations below the last unknown are checked by DetermineRoots_
+    const row_size_type extra_equations = matrix_->RowsSize() -
+                        std::min<row_size_type>(matrix_->RowsSize(),
+                                                matrix_->ColumnsSize() - 1);
+    reverse_iterator_type last_equation_it = matrix_->Rbegin() +
+                                                extra_equations;
     auto is_all_roots_zero = [&last_equation_it](void) -> bool {
         if(DoubleCompare(last_equation_it->at(0), 0)){
             return std::equal(
@@ -133,38 +137,76 @@ bool SleGaussianParent::DetermineSingular_(){
 }
 
 void SleGaussianParent::DetermineRoots_(){
-    double current_root_value;
+    // Columns are counted again: a zero factor of one equation may have
+    // been erased
+    const column_size_type unknowns = matrix_->ColumnsSize() - 1;
+    // Extra equations are checked by the roots of the leading ones
+    const row_size_type rows = std::min<row_size_type>(matrix_->RowsSize(),
+                                                        unknowns);
+    // Roots of the last rows are the last unknowns
+    const column_size_type offset = unknowns - rows;
+    std::vector<double>& roots = roots_.equation_roots;
+
+    roots.resize(rows);
+    for(row_size_type row_i = 0; row_i < rows; row_i++){
+        roots[row_i] = (*matrix_)[row_i][unknowns];
+    }
+    for(row_size_type block_end = rows; block_end > 0;){
+        const row_size_type block_begin =
+                    block_end - std::min(block_end, BACK_SUBSTITUTION_BLOCK);
 
-    for(reverse_const_iterator_type row_rev_it = matrix_->Rbegin();
-        row_rev_it != matrix_->Rend();
-        ++row_rev_it
-    ){
-        current_root_value = DetermineRoot_(row_rev_it);
-        roots_.equation_roots.insert(
-            roots_.equation_roots.begin(), current_root_value
-        );
+        SolveDiagonalBlock_(block_begin, block_end, offset);
+        if (block_begin) UpdateRightSides_(block_begin, block_end, offset);
+        block_end = block_begin;
+    }
+    // Elimination of a consistent system leaves only rounding residue in
+    // rows below the last unknown
+    for(row_size_type row_i = rows; row_i < matrix_->RowsSize(); row_i++){
+        const double* row = (*matrix_)[row_i].data();
+
+        if(!DoubleCompare(dot_(unknowns, row, roots.data()), row[unknowns])){
+            PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
+                UNSOLVABLE_MATRIX_MSG + ": SLE is inconsistent");
+            roots.clear();
+            return;
+        }
     }
 }
 
-double SleGaussianParent::DetermineRoot_(
-                            reverse_const_iterator_type& row_rev_it){
-    using column_rev_it = matrix_type::row_matrix_type::const_reverse_iterator;
-    using root_rev_it   = result_roots_type::sle_type::const_reverse_iterator;
+void SleGaussianParent::SolveDiagonalBlock_(row_size_type block_begin,
+                                            row_size_type block_end,
+                                            column_size_type offset){
+    std::vector<double>& roots = roots_.equation_roots;
 
-    double right_side;
-    double root_value;
-    column_rev_it root_factor_rev_it;
+    for(row_size_type row_i = block_end; row_i-- > block_begin;){
+        const double* row = (*matrix_)[row_i].data() + offset;
 
-    right_side = *row_rev_it->rbegin();
-    root_factor_rev_it = row_rev_it->rbegin() + 1;
-    for(root_rev_it root_rev_it = roots_.equation_roots.rbegin();
-        root_rev_it != roots_.equation_roots.rend();
-        ++root_rev_it, ++root_factor_rev_it
-    ){
-        right_side -= (*root_rev_it) * (*root_factor_rev_it);
+        roots[row_i] = (roots[row_i] - dot_(block_end - row_i - 1,
+                                            row + row_i + 1,
+                                            roots.data() + row_i + 1)) /
+                        row[row_i];
     }
-    root_value = right_side / (*root_factor_rev_it);
-    return root_value;
+}
+
+void SleGaussianParent::UpdateRightSides_(row_size_type block_begin,
+                                            row_size_type block_end,
+                                            column_size_type offset){
+    std::vector<double>& roots = roots_.equation_roots;
+
+    ThreadPool::Instance().ParallelFor(
+        0, block_begin,
+        [&](row_size_type row_begin, row_size_type row_end){
+            for(row_size_type row_i = row_begin; row_i < row_end; row_i++){
+                const double* row = (*matrix_)[row_i].data() + offset;
+
+                roots[row_i] -= dot_(block_end - block_begin,
+                                    row + block_begin,
+                                    roots.data() + block_begin);
+            }
+        },
+        BACK_SUBSTITUTION_ROWS_BLOCK,
+        threads_count_
+    );
 }
 
 bool SleGaussianParent::IsOneEquationSingular_(){
@@ -184,100 +226,230 @@ bool SleGaussianParent::IsOneEquationSingular_(){
 bool SleGaussianParent::DeleteZeroFactorInOneEquation_(
                                                 matrix_type_reference matrix){
     if (DoubleCompare(matrix.Begin()->at(0), 0)) {
-        matrix.Begin()->erase(matrix.Begin()->begin());
+        matrix.EraseColumn(0);
         return true;
     } else if (DoubleCompare(matrix.Begin()->at(1), 0)) {
-        matrix.Begin()->erase(matrix.Begin()->begin() + 1);
+        matrix.EraseColumn(1);
         return true;
     }
     return false;
 }
 
+void SleGaussianParent::ReduceRow_(row_size_type row_i,
+                                    row_size_type current_i){
+    double* row = (*matrix_)[row_i].data();
+    const double* current_row = (*matrix_)[current_i].data();
+    const double multiplier = row[current_i] / current_row[current_i];
+
+    // <= because we need to reduse and the right hand side of equation
+    for(column_size_type column_i = current_i;
+        column_i <= roots_count_;
+        column_i++
+    ){
+        row[column_i] -= current_row[column_i] * multiplier;
+    }
+}
+
 SleGaussianUsual::SleGaussianUsual(matrix_type_reference matrix)
     : SleGaussianParent(matrix){}
 
 void SleGaussianUsual::ReduceRows_(row_size_type current_i){
-    double current_multiplier;
-
-    current_multiplier = 0;
     for(row_size_type row_i = current_i + 1;
         row_i < equations_count_;
         row_i++
     ){
-        current_multiplier = (*matrix_)[row_i][current_i] /
-                                (*matrix_)[current_i][current_i];
-        for(column_size_type column_i = current_i;
-            column_i <= roots_count_; // <= because we need to reduse and the right hand side of equation
-            column_i++
-        ){
-            (*matrix_)[row_i][column_i] -=
-                        (*matrix_)[current_i][column_i] * current_multiplier;
-        }
+        ReduceRow_(row_i, current_i);
     }
 }
 
 
-SleGaussianParellel::SleGaussianParellel(matrix_type_reference matrix)
-    : SleGaussianParent(matrix){}
+SleGaussianParellel::SleGaussianParellel(matrix_type_reference matrix,
+                                        size_t threads_count)
+    : SleGaussianParent(matrix, threads_count),
+        axpy_(sle::GetAxpyKernel()),
+        is_step_skipped_(false){}
+
+void SleGaussianParellel::Eliminate_(){
+    const row_size_type steps_count = std::min<row_size_type>(
+        matrix_->RowsSize() - 1,
+        matrix_->ColumnsSize() - 1
+    );
+    // Spinning at the barrier, more workers than cores would wait for
+    // preempted ones
+    const size_t workers_count = std::min<size_t>({
+        threads_count_,
+        ThreadPool::Instance().ThreadsCount(),
+        (equations_count_ + OWNED_ROWS_BLOCK - 1) / OWNED_ROWS_BLOCK
+    });
+
+    if (workers_count <= 1 || equations_count_ < MIN_PARALLEL_EQUATIONS){
+        SleGaussianParent::Eliminate_();
+        return;
+    }
 
-void SleGaussianParellel::ReduceRows_(row_size_type current_i){
+    Barrier barrier(workers_count);
+    threads_array_type threads_array;
+    // Workers wait for all of them to be created: the barrier counts
+    // workers_count threads, so started ones would wait for a missing
+    // one forever
+    std::atomic<StartState> start_state(StartState::WAITING);
+    auto worker = [&](size_t worker_i){
+        StartState state;
+
+        while((state = start_state.load(std::memory_order_acquire)) ==
+                StartState::WAITING){
+            std::this_thread::yield();
+        }
+        if(state == StartState::STARTED){
+            Worker_(worker_i, workers_count, steps_count, barrier);
+        }
+    };
 
     try{
-        threads_array_type threads_array;
-
-        for(row_size_type row_i = current_i + 1;
-                row_i < equations_count_;
-                row_i++
-        ){
-                threads_array.push_back(std::thread(
-                    &SleGaussianParellel::ParallelReducing_,
-                    this,
-                    row_i,
-                    current_i
-                ));
+        threads_array.reserve(workers_count - 1);
+        for(size_t worker_i = 1; worker_i < workers_count; worker_i++){
+            threads_array.push_back(std::thread(worker, worker_i));
         }
-        JoinThreads(threads_array);
     } catch(const std::exception &e) {
         std::string error = "Threads problems: ";
+
+        start_state.store(StartState::CANCELLED, std::memory_order_release);
+        JoinThreads(threads_array);
         PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__, error + e.what());
+        // Nothing is eliminated yet
+        SleGaussianParent::Eliminate_();
+        return;
     }
+    start_state.store(StartState::STARTED, std::memory_order_release);
+    Worker_(0, workers_count, steps_count, barrier);
+    JoinThreads(threads_array);
+}
 
+void SleGaussianParellel::ReduceRows_(row_size_type current_i){
+    for(row_size_type row_i = current_i + 1;
+        row_i < equations_count_;
+        row_i++
+    ){
+        ReduceRowSimd_(row_i, current_i);
+    }
 }
 
-void SleGaussianParellel::ParallelReducing_(row_size_type row_i,
+void SleGaussianParellel::Worker_(size_t worker_i, size_t workers_count,
+                                row_size_type steps_count,
+                                Barrier& barrier){
+    const row_size_type blocks_step = workers_count * OWNED_ROWS_BLOCK;
+
+    for(row_size_type current_i = 0; current_i < steps_count; current_i++){
+        // Updates of the previous step are finished, so the last worker
+        // to arrive can look for the pivot and swap rows alone
+        barrier.ArriveAndWait([this, current_i](){
+            is_step_skipped_ =
+                        DoubleCompare((*matrix_)[current_i][current_i], 0) &&
+                        SwapRow_(current_i);
+        });
+        if (is_step_skipped_) continue;
+
+        const row_size_type first_row = current_i + 1;
+        const row_size_type first_block = first_row / OWNED_ROWS_BLOCK;
+        // First block of this worker not above first_row
+        row_size_type block_i = first_block +
+                                (worker_i + workers_count -
+                                    first_block % workers_count) %
+                                workers_count;
+
+        for(row_size_type block_begin = block_i * OWNED_ROWS_BLOCK;
+            block_begin < equations_count_;
+            block_begin += blocks_step
+        ){
+            const row_size_type block_end = std::min(
+                block_begin + OWNED_ROWS_BLOCK,
+                equations_count_
+            );
+
+            for(row_size_type row_i = std::max(block_begin, first_row);
+                row_i < block_end;
+                row_i++
+            ){
+                ReduceRowSimd_(row_i, current_i);
+            }
+        }
+    }
+}
+
+void SleGaussianParellel::ReduceRowSimd_(row_size_type row_i,
                                         row_size_type current_i){
-    threads_array_type threads_array;
-    double current_multiplier;
+    double* row = (*matrix_)[row_i].data();
+    const double* current_row = (*matrix_)[current_i].data();
+    const double multiplier = row[current_i] / current_row[current_i];
 
-    // std::cout << "Multiplier for " << current_i << std::endl;
-    current_multiplier = (*matrix_)[row_i][current_i] /
-                                            (*matrix_)[current_i][current_i];
+    if (multiplier == 0) return;
+    axpy_(roots_count_ + 1 - current_i, -multiplier,
+            current_row + current_i, row + current_i);
+}
 
-    for(column_size_type column_i = current_i;
-            column_i <= roots_count_; // <= because we need to reduse and the right hand side of equation
-            column_i++
-    ){
-        threads_array.push_back(std::thread(
-            &SleGaussianParellel::ParallelReduceRow_,
-            this,
-            row_i,
-            column_i,
-            current_i,
-            current_multiplier
-        ));
+
+SleGaussianBlocked::SleGaussianBlocked(matrix_type_reference matrix,
+                                    size_t threads_count)
+    : SleGaussianParent(matrix, threads_count),
+        lu_(threads_count){}
+
+void SleGaussianBlocked::Eliminate_(){
+    if (equations_count_ != roots_count_){
+        SleGaussianParent::Eliminate_();
+        return;
     }
-    JoinThreads(threads_array);
+
+    BlockedLu::permutation_type permutation;
+
+    // Right-hand sides are swapped and updated together with rows, so
+    // only L has to be cleared to get the row echelon form
+    lu_.Factorize(matrix_->Data(), equations_count_,
+                    matrix_->LeadingDimension(), roots_count_ + 1,
+                    permutation);
+    ClearLower_();
 }
 
-void SleGaussianParellel::ParallelReduceRow_(row_size_type row_i,
-                    column_size_type column_i, row_size_type current_i,
-                    double multiplier){
-    std::lock_guard<mutex_type> locker(lock_);
-    // std::cout << "Row for " << current_i << std::endl;
-    (*matrix_)[row_i][column_i] -=
-                (*matrix_)[current_i][column_i] * multiplier;
+void SleGaussianBlocked::ReduceRows_(row_size_type current_i){
+    for(row_size_type row_i = current_i + 1;
+        row_i < equations_count_;
+        row_i++
+    ){
+        ReduceRow_(row_i, current_i);
+    }
 }
 
 
+SleGaussianTiled::SleGaussianTiled(matrix_type_reference matrix,
+                                    size_t tile_size)
+    : SleGaussianParent(matrix, ThreadPool::Instance().ThreadsCount()),
+        lu_(tile_size){}
+
+void SleGaussianTiled::Eliminate_(){
+    if (equations_count_ != roots_count_){
+        SleGaussianParent::Eliminate_();
+        return;
+    }
+
+    TiledLu::permutation_type permutation;
+
+    try{
+        lu_.Factorize(matrix_->Data(), equations_count_,
+                        matrix_->LeadingDimension(), roots_count_ + 1,
+                        permutation);
+    } catch(const std::exception &e){
+        std::string error = "Threads problems: ";
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__, error + e.what());
+    }
+    ClearLower_();
+}
+
+void SleGaussianTiled::ReduceRows_(row_size_type current_i){
+    for(row_size_type row_i = current_i + 1;
+        row_i < equations_count_;
+        row_i++
+    ){
+        ReduceRow_(row_i, current_i);
+    }
+}
 
 }
@@ -0,0 +1,81 @@
+#ifndef SLE_GAUSSIAN_FIXED_H
+#error 'sle_gaussian_fixed_impl.h' is not supposed to be included directly. \
+        Include 'sle_gaussian_fixed.h' instead.
+#endif
+
+namespace s21{
+
+template < class T, std::size_t Equations >
+constexpr typename FixedGaussian<T, Equations>::result_type
+            FixedGaussian<T, Equations>::Solve(system_type system){
+    result_type result{false, {}};
+
+    for (std::size_t pivot = 0; pivot < Equations; pivot++){
+        std::size_t pivot_row = pivot;
+
+        for (std::size_t row = pivot + 1; row < Equations; row++){
+            if (Abs_(system[row][pivot]) > Abs_(system[pivot_row][pivot])){
+                pivot_row = row;
+            }
+        }
+        if (Abs_(system[pivot_row][pivot]) <= FIXED_PIVOT_EPSILON){
+            return result;
+        }
+        SwapRows_(system, pivot, pivot_row);
+
+        for (std::size_t row = pivot + 1; row < Equations; row++){
+            ReduceRow_(system, row, pivot,
+                        system[row][pivot] / system[pivot][pivot],
+                        columns_type());
+        }
+    }
+
+    for (std::size_t row = Equations; row-- > 0;){
+        T right_side = system[row][Equations];
+
+        for (std::size_t column = row + 1; column < Equations; column++){
+            right_side -= system[row][column] *
+                            result.equation_roots[column];
+        }
+        result.equation_roots[row] = right_side / system[row][row];
+    }
+    result.is_solved = true;
+    return result;
+}
+
+template < class T, std::size_t Equations >
+constexpr T FixedGaussian<T, Equations>::Abs_(T value){
+    return value < T() ? -value : value;
+}
+
+template < class T, std::size_t Equations >
+constexpr void FixedGaussian<T, Equations>::SwapRows_(system_type& system,
+                                                    std::size_t first,
+                                                    std::size_t second){
+    if (first == second) return;
+    for (std::size_t column = 0; column <= Equations; column++){
+        T tmp = system[first][column];
+
+        system[first][column] = system[second][column];
+        system[second][column] = tmp;
+    }
+}
+
+template < class T, std::size_t Equations >
+template < std::size_t... Columns >
+constexpr void FixedGaussian<T, Equations>::ReduceRow_(
+                                            system_type& system,
+                                            std::size_t row,
+                                            std::size_t pivot_row,
+                                            T multiplier,
+                                            std::index_sequence<Columns...>){
+    ((system[row][Columns] -= multiplier * system[pivot_row][Columns]), ...);
+}
+
+template < class T, std::size_t Equations >
+constexpr FixedSleResult<T, Equations> SolveGaussianFixed(
+                        const Matrix<T, Equations, Equations + 1>& system){
+    return FixedGaussian<T, Equations>::Solve(system);
+}
+
+}
@@ -0,0 +1,312 @@
+#include "../includes/sle_gemm.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "../../../utils/includes/thread_pool.h"
+#include "../../../matrix/includes/matrix_storage.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SLE_GEMM_X86
+#include <immintrin.h>
+#endif
+
+namespace s21::sle{
+
+namespace {
+
+constexpr std::size_t MR = GEMM_MICRO_ROWS;
+constexpr std::size_t NR = GEMM_MICRO_COLUMNS;
+
+// Packed panels are aligned for aligned SIMD loads
+using packed_type = std::vector<double, AlignedAllocator<double>>;
+
+/**
+ * c[r][j] -= sum of packed_a[p][r] * packed_b[p][j] over [inner] pairs
+ * for MR x NR tile [c]
+ */
+using gemm_kernel_type = void (*)(std::size_t inner, const double* packed_a,
+                                const double* packed_b, double* c,
+                                std::size_t ldc);
+
+void ScalarKernel(std::size_t inner, const double* packed_a,
+                const double* packed_b, double* c, std::size_t ldc){
+    double tile[MR][NR] = {};
+
+    for (std::size_t p = 0; p < inner; p++){
+        const double* a = packed_a + p * MR;
+        const double* b = packed_b + p * NR;
+
+        for (std::size_t r = 0; r < MR; r++){
+            for (std::size_t j = 0; j < NR; j++){
+                tile[r][j] += a[r] * b[j];
+            }
+        }
+    }
+    for (std::size_t r = 0; r < MR; r++){
+        for (std::size_t j = 0; j < NR; j++){
+            c[r * ldc + j] -= tile[r][j];
+        }
+    }
+}
+
+#ifdef SLE_GEMM_X86
+
+__attribute__((target("avx2,fma")))
+void Avx2Kernel(std::size_t inner, const double* packed_a,
+                const double* packed_b, double* c, std::size_t ldc){
+    static_assert(MR == 8 && NR == 8, "AVX2 kernel holds 4 x 2 registers");
+
+    // Two passes of 4 rows: 8 accumulators leave registers for the panel
+    // slice and broadcasted elements
+    for (std::size_t half = 0; half < MR; half += 4){
+        __m256d acc[4][2];
+
+        for (std::size_t r = 0; r < 4; r++){
+            acc[r][0] = _mm256_setzero_pd();
+            acc[r][1] = _mm256_setzero_pd();
+        }
+        for (std::size_t p = 0; p < inner; p++){
+            const double* a = packed_a + p * MR + half;
+            const __m256d b0 = _mm256_load_pd(packed_b + p * NR);
+            const __m256d b1 = _mm256_load_pd(packed_b + p * NR + 4);
+
+            for (std::size_t r = 0; r < 4; r++){
+                const __m256d a_r = _mm256_broadcast_sd(a + r);
+
+                acc[r][0] = _mm256_fmadd_pd(a_r, b0, acc[r][0]);
+                acc[r][1] = _mm256_fmadd_pd(a_r, b1, acc[r][1]);
+            }
+        }
+        for (std::size_t r = 0; r < 4; r++){
+            double* c_row = c + (half + r) * ldc;
+
+            _mm256_storeu_pd(c_row, _mm256_sub_pd(_mm256_loadu_pd(c_row),
+                                                acc[r][0]));
+            _mm256_storeu_pd(c_row + 4, _mm256_sub_pd(
+                _mm256_loadu_pd(c_row + 4), acc[r][1]));
+        }
+    }
+}
+
+__attribute__((target("avx512f")))
+void Avx512Kernel(std::size_t inner, const double* packed_a,
+                const double* packed_b, double* c, std::size_t ldc){
+    static_assert(MR == 8 && NR == 8, "AVX-512 kernel holds 8 registers");
+
+    __m512d acc[MR];
+
+    for (std::size_t r = 0; r < MR; r++) acc[r] = _mm512_setzero_pd();
+    for (std::size_t p = 0; p < inner; p++){
+        const double* a = packed_a + p * MR;
+        const __m512d b = _mm512_load_pd(packed_b + p * NR);
+
+        for (std::size_t r = 0; r < MR; r++){
+            acc[r] = _mm512_fmadd_pd(_mm512_set1_pd(a[r]), b, acc[r]);
+        }
+    }
+    for (std::size_t r = 0; r < MR; r++){
+        double* c_row = c + r * ldc;
+
+        _mm512_storeu_pd(c_row, _mm512_sub_pd(_mm512_loadu_pd(c_row),
+                                            acc[r]));
+    }
+}
+
+#endif
+
+gemm_kernel_type GetKernel(){
+#ifdef SLE_GEMM_X86
+    if (__builtin_cpu_supports("avx512f")) return Avx512Kernel;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")){
+        return Avx2Kernel;
+    }
+#endif
+    return ScalarKernel;
+}
+
+/**
+ * Packing [rows]x[inner] block of [a] into panels of MR rows, every panel
+ * keeps MR elements of one column after another. Missing rows are zero
+ */
+void PackA(std::size_t rows, std::size_t inner, const double* a,
+            std::size_t lda, double* packed){
+    for (std::size_t panel = 0; panel < rows; panel += MR){
+        const std::size_t panel_rows = std::min(MR, rows - panel);
+
+        for (std::size_t p = 0; p < inner; p++){
+            for (std::size_t r = 0; r < MR; r++){
+                packed[p * MR + r] = r < panel_rows ?
+                                    a[(panel + r) * lda + p] : 0;
+            }
+        }
+        packed += inner * MR;
+    }
+}
+
+/**
+ * Packing [inner]x[columns] block of [b] into panels of NR columns, every
+ * panel keeps NR elements of one row after another. Missing columns are
+ * zero
+ */
+void PackB(std::size_t inner, std::size_t columns, const double* b,
+            std::size_t ldb, double* packed){
+    for (std::size_t panel = 0; panel < columns; panel += NR){
+        const std::size_t panel_columns = std::min(NR, columns - panel);
+
+        for (std::size_t p = 0; p < inner; p++){
+            const double* b_row = b + p * ldb + panel;
+
+            std::copy(b_row, b_row + panel_columns, packed + p * NR);
+            std::fill(packed + p * NR + panel_columns, packed + (p + 1) * NR,
+                        0.0);
+        }
+        packed += inner * NR;
+    }
+}
+
+/**
+ * Packing [inner]x[columns] block of the transposed [b], whose rows are
+ * the columns, into panels as PackB does
+ */
+void PackBTransposed(std::size_t inner, std::size_t columns, const double* b,
+                    std::size_t ldb, double* packed){
+    for (std::size_t panel = 0; panel < columns; panel += NR){
+        const std::size_t panel_columns = std::min(NR, columns - panel);
+
+        for (std::size_t p = 0; p < inner; p++){
+            for (std::size_t t = 0; t < NR; t++){
+                packed[p * NR + t] = t < panel_columns ?
+                                    b[(panel + t) * ldb + p] : 0;
+            }
+        }
+        packed += inner * NR;
+    }
+}
+
+/**
+ * Multiplying packed [rows]x[inner] block by packed [inner]x[columns] one
+ * and subtracting the product from [c]
+ */
+void MultiplyPacked(std::size_t rows, std::size_t columns, std::size_t inner,
+                    const double* packed_a, const double* packed_b,
+                    double* c, std::size_t ldc, gemm_kernel_type kernel){
+    alignas(64) double edge[MR * NR];
+
+    for (std::size_t j = 0; j < columns; j += NR){
+        const std::size_t tile_columns = std::min(NR, columns - j);
+        const double* panel_b = packed_b + j * inner;
+
+        for (std::size_t i = 0; i < rows; i += MR){
+            const std::size_t tile_rows = std::min(MR, rows - i);
+            const double* panel_a = packed_a + i * inner;
+            double* tile = c + i * ldc + j;
+
+            if (tile_rows == MR && tile_columns == NR){
+                kernel(inner, panel_a, panel_b, tile, ldc);
+                continue;
+            }
+            std::fill(edge, edge + MR * NR, 0.0);
+            kernel(inner, panel_a, panel_b, edge, NR);
+            for (std::size_t r = 0; r < tile_rows; r++){
+                for (std::size_t t = 0; t < tile_columns; t++){
+                    tile[r * ldc + t] += edge[r * NR + t];
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @return [value] rounded up to a multiple of [step]
+ */
+std::size_t RoundUp(std::size_t value, std::size_t step){
+    return (value + step - 1) / step * step;
+}
+
+/**
+ * c -= a * op(b), op(b) is [b] or its transpose by [IsBTransposed]
+ */
+template < bool IsBTransposed >
+void GemmSubtractImpl(std::size_t rows, std::size_t columns,
+                    std::size_t inner, const double* a, std::size_t lda,
+                    const double* b, std::size_t ldb,
+                    double* c, std::size_t ldc, std::size_t threads_count,
+                    const GemmBlocking& blocking){
+    static const gemm_kernel_type kernel = GetKernel();
+
+    if (!rows || !columns || !inner) return;
+
+    const std::size_t rows_block = RoundUp(std::max<std::size_t>(
+                                            blocking.rows_block, 1), MR);
+    const std::size_t inner_block = std::max<std::size_t>(
+                                            blocking.inner_block, 1);
+    const std::size_t columns_block = RoundUp(std::max<std::size_t>(
+                                            blocking.columns_block, 1), NR);
+    packed_type packed_b(
+        RoundUp(std::min(columns, columns_block), NR) *
+        std::min(inner, inner_block)
+    );
+
+    for (std::size_t jc = 0; jc < columns; jc += columns_block){
+        const std::size_t nc = std::min(columns_block, columns - jc);
+
+        for (std::size_t pc = 0; pc < inner; pc += inner_block){
+            const std::size_t kc = std::min(inner_block, inner - pc);
+
+            if (IsBTransposed){
+                PackBTransposed(kc, nc, b + jc * ldb + pc, ldb,
+                                packed_b.data());
+            } else {
+                PackB(kc, nc, b + pc * ldb + jc, ldb, packed_b.data());
+            }
+            ThreadPool::Instance().ParallelFor(
+                0, rows,
+                [&](std::size_t row_begin, std::size_t row_end){
+                    // Every thread packs its rows blocks into own buffer
+                    thread_local packed_type packed_a;
+
+                    packed_a.resize(RoundUp(rows_block, MR) * kc);
+                    for (std::size_t ic = row_begin; ic < row_end;
+                            ic += rows_block){
+                        const std::size_t mc = std::min(rows_block,
+                                                        row_end - ic);
+
+                        PackA(mc, kc, a + ic * lda + pc, lda,
+                                packed_a.data());
+                        MultiplyPacked(mc, nc, kc, packed_a.data(),
+                                        packed_b.data(), c + ic * ldc + jc,
+                                        ldc, kernel);
+                    }
+                },
+                rows_block,
+                threads_count
+            );
+        }
+    }
+}
+
+}
+
+void GemmSubtract(std::size_t rows, std::size_t columns, std::size_t inner,
+                const double* a, std::size_t lda,
+                const double* b, std::size_t ldb,
+                double* c, std::size_t ldc,
+                std::size_t threads_count,
+                const GemmBlocking& blocking){
+    GemmSubtractImpl<false>(rows, columns, inner, a, lda, b, ldb, c, ldc,
+                            threads_count, blocking);
+}
+
+void GemmSubtractTransposed(std::size_t rows, std::size_t columns,
+                            std::size_t inner,
+                            const double* a, std::size_t lda,
+                            const double* b, std::size_t ldb,
+                            double* c, std::size_t ldc,
+                            std::size_t threads_count,
+                            const GemmBlocking& blocking){
+    GemmSubtractImpl<true>(rows, columns, inner, a, lda, b, ldb, c, ldc,
+                            threads_count, blocking);
+}
+
+}
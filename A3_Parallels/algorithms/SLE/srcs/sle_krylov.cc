@@ -0,0 +1,513 @@
+#include "../includes/sle_krylov.h"
+
+namespace s21{
+
+template < class Function >
+void KrylovSolver::ForBlocks_(size_type size, Function body) const{
+    const size_type blocks = (size + VECTOR_BLOCK - 1) / VECTOR_BLOCK;
+
+    // Blocks are the same for any count of threads, so are the sums
+    pool_.ParallelFor(0, blocks, [&](size_type block_begin,
+                                    size_type block_end){
+        for (size_type block_i = block_begin; block_i < block_end;
+                block_i++){
+            body(block_i * VECTOR_BLOCK,
+                std::min(size, (block_i + 1) * VECTOR_BLOCK), block_i);
+        }
+    });
+}
+
+KrylovSolver::KrylovSolver(const sparse_type& matrix, KrylovOptions options,
+                            ThreadPool& pool)
+                            : matrix_(matrix),
+                                options_(options),
+                                pool_(pool),
+                                is_valid_(false){
+    if (matrix_.RowsSize() != matrix_.ColumnsSize()){
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
+                    "Invalid matrix: Only square matrices can be solved");
+        return;
+    }
+    if (options_.preconditioner == KrylovPreconditioner::JACOBI){
+        inverse_diagonal_ = matrix_.Diagonal();
+        for (elements_type& element : inverse_diagonal_){
+            if (element == 0){
+                PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
+                            "Invalid matrix: Jacobi preconditioner "
+                            "needs a nonzero diagonal");
+                return;
+            }
+            element = 1 / element;
+        }
+    } else if (options_.preconditioner == KrylovPreconditioner::ILU0 &&
+                !BuildIlu_()){
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
+                    "Invalid matrix: ILU(0) has a zero pivot");
+        return;
+    }
+    is_valid_ = true;
+}
+
+KrylovSolver::result_roots_type KrylovSolver::ConjugateGradient(
+                                            const vector_type& rhs) const{
+    result_roots_type result;
+
+    if (!IsSolvable_(rhs)) return result;
+
+    const size_type size = rhs.size();
+    const elements_type rhs_norm = Norm_(rhs);
+    vector_type& x = result.equation_roots;
+    vector_type& history = result.residual_history;
+
+    x.assign(size, 0);
+    if (rhs_norm == 0){
+        history.push_back(0);
+        return result;
+    }
+
+    vector_type r(rhs), z(size), p(size), q(size);
+
+    Precondition_(r, z);
+    p = z;
+    elements_type rz = Dot_(r, z);
+
+    history.push_back(1);
+    for (size_type iteration = 0; iteration < options_.max_iterations &&
+            history.back() > options_.tolerance; iteration++){
+        matrix_.Multiply(p.data(), q.data(), pool_);
+
+        const elements_type curvature = Dot_(p, q);
+
+        if (!(curvature > 0)){
+            PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
+                        "Invalid matrix: Matrix isn't positive definite");
+            break;
+        }
+
+        const elements_type alpha = rz / curvature;
+
+        Combine_(alpha, p, 1, x);
+        Combine_(-alpha, q, 1, r);
+        history.push_back(Norm_(r) / rhs_norm);
+        if (history.back() <= options_.tolerance) break;
+
+        Precondition_(r, z);
+
+        const elements_type rz_next = Dot_(r, z);
+
+        // p = z + beta * p
+        Combine_(1, z, rz_next / rz, p);
+        rz = rz_next;
+    }
+    CheckConvergence_(result, __FUNCTION__);
+    return result;
+}
+
+KrylovSolver::result_roots_type KrylovSolver::BiCgStab(
+                                            const vector_type& rhs) const{
+    result_roots_type result;
+
+    if (!IsSolvable_(rhs)) return result;
+
+    const size_type size = rhs.size();
+    const elements_type rhs_norm = Norm_(rhs);
+    vector_type& x = result.equation_roots;
+    vector_type& history = result.residual_history;
+
+    x.assign(size, 0);
+    if (rhs_norm == 0){
+        history.push_back(0);
+        return result;
+    }
+
+    vector_type r(rhs), shadow(rhs), p(size, 0), v(size, 0);
+    vector_type p_hat(size), s_hat(size), t(size);
+    elements_type rho = 1, alpha = 1, omega = 1;
+
+    history.push_back(1);
+    for (size_type iteration = 0; iteration < options_.max_iterations &&
+            history.back() > options_.tolerance; iteration++){
+        const elements_type rho_next = Dot_(shadow, r);
+
+        if (rho_next == 0 || omega == 0){
+            PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
+                        "Solver breakdown: Residual became orthogonal "
+                        "to the shadow one");
+            break;
+        }
+
+        const elements_type beta = rho_next / rho * (alpha / omega);
+
+        // p = r + beta * (p - omega * v)
+        Combine_(-omega, v, 1, p);
+        Combine_(1, r, beta, p);
+        Precondition_(p, p_hat);
+        matrix_.Multiply(p_hat.data(), v.data(), pool_);
+        alpha = rho_next / Dot_(shadow, v);
+        // s = r - alpha * v is kept in r
+        Combine_(-alpha, v, 1, r);
+        Combine_(alpha, p_hat, 1, x);
+
+        const elements_type s_norm = Norm_(r) / rhs_norm;
+
+        if (s_norm <= options_.tolerance){
+            history.push_back(s_norm);
+            break;
+        }
+        Precondition_(r, s_hat);
+        matrix_.Multiply(s_hat.data(), t.data(), pool_);
+
+        const elements_type t_norm = Dot_(t, t);
+
+        omega = t_norm > 0 ? Dot_(t, r) / t_norm : 0;
+        Combine_(omega, s_hat, 1, x);
+        Combine_(-omega, t, 1, r);
+        history.push_back(Norm_(r) / rhs_norm);
+        rho = rho_next;
+    }
+    CheckConvergence_(result, __FUNCTION__);
+    return result;
+}
+
+KrylovSolver::result_roots_type KrylovSolver::Gmres(
+                                            const vector_type& rhs) const{
+    result_roots_type result;
+
+    if (!IsSolvable_(rhs)) return result;
+
+    const size_type size = rhs.size();
+    const size_type restart = std::max<size_type>(options_.restart, 1);
+    const elements_type rhs_norm = Norm_(rhs);
+    vector_type& x = result.equation_roots;
+    vector_type& history = result.residual_history;
+
+    x.assign(size, 0);
+    if (rhs_norm == 0){
+        history.push_back(0);
+        return result;
+    }
+
+    std::vector<vector_type> basis(restart + 1, vector_type(size));
+    // Hessenberg matrix by columns, turned into R by Givens rotations
+    std::vector<vector_type> hessenberg(restart, vector_type(restart + 1));
+    vector_type cosines(restart), sines(restart), g(restart + 1);
+    vector_type z(size), w(size);
+    size_type iteration = 0;
+    bool is_stagnated = false;
+
+    history.push_back(1);
+    while (iteration < options_.max_iterations &&
+            history.back() > options_.tolerance){
+        Residual_(rhs, x, basis[0]);
+
+        const elements_type beta = Norm_(basis[0]);
+
+        if (beta / rhs_norm <= options_.tolerance){
+            history.back() = beta / rhs_norm;
+            break;
+        }
+        Combine_(0, basis[0], 1 / beta, basis[0]);
+        std::fill(g.begin(), g.end(), 0);
+        g[0] = beta;
+
+        size_type basis_size = 0;
+
+        while (basis_size < restart && iteration < options_.max_iterations){
+            const size_type j = basis_size++;
+            vector_type& column = hessenberg[j];
+
+            iteration++;
+            Precondition_(basis[j], z);
+            matrix_.Multiply(z.data(), w.data(), pool_);
+            // Modified Gram-Schmidt
+            for (size_type i = 0; i <= j; i++){
+                column[i] = Dot_(w, basis[i]);
+                Combine_(-column[i], basis[i], 1, w);
+            }
+            column[j + 1] = Norm_(w);
+
+            // Zero norm: the basis holds the exact solution
+            const bool is_invariant = column[j + 1] == 0;
+
+            if (!is_invariant){
+                Combine_(1 / column[j + 1], w, 0, basis[j + 1]);
+            }
+            for (size_type i = 0; i < j; i++){
+                const elements_type upper = column[i];
+
+                column[i] = cosines[i] * upper + sines[i] * column[i + 1];
+                column[i + 1] = -sines[i] * upper +
+                                cosines[i] * column[i + 1];
+            }
+
+            const elements_type radius = std::hypot(column[j],
+                                                    column[j + 1]);
+
+            cosines[j] = radius != 0 ? column[j] / radius : 1;
+            sines[j] = radius != 0 ? column[j + 1] / radius : 0;
+            column[j] = radius;
+            column[j + 1] = 0;
+            g[j + 1] = -sines[j] * g[j];
+            g[j] *= cosines[j];
+            history.push_back(std::abs(g[j + 1]) / rhs_norm);
+            if (radius == 0) is_stagnated = true;
+            if (history.back() <= options_.tolerance || is_invariant ||
+                    is_stagnated){
+                break;
+            }
+        }
+
+        // R y = g, x += M^-1 V y
+        vector_type y(basis_size);
+
+        for (size_type i = basis_size; i-- > 0;){
+            elements_type sum = g[i];
+
+            for (size_type k = i + 1; k < basis_size; k++){
+                sum -= hessenberg[k][i] * y[k];
+            }
+            y[i] = hessenberg[i][i] != 0 ? sum / hessenberg[i][i] : 0;
+        }
+        std::fill(w.begin(), w.end(), 0);
+        for (size_type i = 0; i < basis_size; i++){
+            Combine_(y[i], basis[i], 1, w);
+        }
+        Precondition_(w, z);
+        Combine_(1, z, 1, x);
+        if (is_stagnated) break;
+    }
+    CheckConvergence_(result, __FUNCTION__);
+    return result;
+}
+
+bool KrylovSolver::BuildIlu_(){
+    const size_type size = matrix_.RowsSize();
+    const auto offsets = matrix_.RowOffsets();
+    const auto columns = matrix_.ColumnIndices();
+    // Positions are indices of nonzeros, so their count marks absent ones
+    const size_type missing = offsets[size];
+    // Position of every column in the current row or missing if it's zero
+    std::vector<size_type> positions(size, missing);
+
+    ilu_values_.assign(matrix_.Values().begin(), matrix_.Values().end());
+    diagonal_positions_.assign(size, missing);
+    for (size_type row = 0; row < size; row++){
+        for (size_type i = offsets[row]; i < offsets[row + 1]; i++){
+            positions[columns[i]] = i;
+            if (columns[i] == row) diagonal_positions_[row] = i;
+        }
+        if (diagonal_positions_[row] == missing) return false;
+        // IKJ variant: every a_ik of L is finished before row k of U is
+        // subtracted, fill-in outside the pattern is dropped
+        for (size_type i = offsets[row]; i < diagonal_positions_[row];
+                i++){
+            const size_type k = columns[i];
+
+            ilu_values_[i] /= ilu_values_[diagonal_positions_[k]];
+            for (size_type kj = diagonal_positions_[k] + 1;
+                    kj < offsets[k + 1]; kj++){
+                const size_type position = positions[columns[kj]];
+
+                if (position != missing){
+                    ilu_values_[position] -= ilu_values_[i] *
+                                                ilu_values_[kj];
+                }
+            }
+        }
+        for (size_type i = offsets[row]; i < offsets[row + 1]; i++){
+            positions[columns[i]] = missing;
+        }
+        if (ilu_values_[diagonal_positions_[row]] == 0) return false;
+    }
+    return true;
+}
+
+bool KrylovSolver::IsSolvable_(const vector_type& rhs) const{
+    if (!is_valid_){
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
+                    "Invalid solver: Matrix or preconditioner is invalid");
+        return false;
+    }
+    if (rhs.size() != matrix_.RowsSize()){
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
+                    "Invalid right-hand side: Size differs from "
+                    "the matrix one");
+        return false;
+    }
+    return true;
+}
+
+void KrylovSolver::Precondition_(const vector_type& vector,
+                                vector_type& result) const{
+    const size_type size = vector.size();
+
+    if (options_.preconditioner == KrylovPreconditioner::JACOBI){
+        ForBlocks_(size, [&](size_type begin, size_type end, size_type){
+            for (size_type i = begin; i < end; i++){
+                result[i] = inverse_diagonal_[i] * vector[i];
+            }
+        });
+        return;
+    }
+    if (options_.preconditioner == KrylovPreconditioner::NONE){
+        result = vector;
+        return;
+    }
+
+    // Triangular solves of ILU(0) are sequential by nature
+    const auto offsets = matrix_.RowOffsets();
+    const auto columns = matrix_.ColumnIndices();
+
+    for (size_type row = 0; row < size; row++){
+        elements_type sum = vector[row];
+
+        for (size_type i = offsets[row]; i < diagonal_positions_[row]; i++){
+            sum -= ilu_values_[i] * result[columns[i]];
+        }
+        result[row] = sum;
+    }
+    for (size_type row = size; row-- > 0;){
+        elements_type sum = result[row];
+
+        for (size_type i = diagonal_positions_[row] + 1;
+                i < offsets[row + 1]; i++){
+            sum -= ilu_values_[i] * result[columns[i]];
+        }
+        result[row] = sum / ilu_values_[diagonal_positions_[row]];
+    }
+}
+
+void KrylovSolver::CheckConvergence_(const result_roots_type& result,
+                                    const char* function) const{
+    if (result.residual_history.back() > options_.tolerance){
+        PRINT_ERROR(__FILE__, function, __LINE__,
+                    "Solver hasn't converged: Tolerance isn't reached, "
+                    "the last iterate is returned");
+    }
+}
+
+KrylovSolver::elements_type KrylovSolver::Dot_(const vector_type& x,
+                                            const vector_type& y) const{
+    const size_type size = x.size();
+    vector_type sums((size + VECTOR_BLOCK - 1) / VECTOR_BLOCK, 0);
+
+    ForBlocks_(size, [&](size_type begin, size_type end, size_type block_i){
+        elements_type sum = 0;
+
+        for (size_type i = begin; i < end; i++) sum += x[i] * y[i];
+        sums[block_i] = sum;
+    });
+
+    elements_type sum = 0;
+
+    for (elements_type block_sum : sums) sum += block_sum;
+    return sum;
+}
+
+KrylovSolver::elements_type KrylovSolver::Norm_(const vector_type& x) const{
+    return std::sqrt(Dot_(x, x));
+}
+
+void KrylovSolver::Combine_(elements_type alpha, const vector_type& x,
+                            elements_type beta, vector_type& y) const{
+    ForBlocks_(y.size(), [&](size_type begin, size_type end, size_type){
+        for (size_type i = begin; i < end; i++){
+            y[i] = alpha * x[i] + beta * y[i];
+        }
+    });
+}
+
+void KrylovSolver::Residual_(const vector_type& rhs, const vector_type& x,
+                            vector_type& residual) const{
+    matrix_.Multiply(x.data(), residual.data(), pool_);
+    Combine_(1, rhs, -1, residual);
+}
+
+
+SleKrylov::SleKrylov(const sparse_type& augmented, KrylovOptions options,
+                    ThreadPool& pool)
+                    : matrix_(0, 0), options_(options), pool_(pool){
+    const size_t size = augmented.RowsSize();
+
+    if (augmented.ColumnsSize() != size + 1) return;
+
+    const auto offsets = augmented.RowOffsets();
+    const auto columns = augmented.ColumnIndices();
+    const auto values = augmented.Values();
+    sparse_type::offsets_type row_offsets(size + 1, 0);
+    sparse_type::indices_type column_indices;
+    sparse_type::values_type coefficients;
+
+    column_indices.reserve(augmented.NonZerosCount());
+    coefficients.reserve(augmented.NonZerosCount());
+    rhs_.assign(size, 0);
+    for (size_t row = 0; row < size; row++){
+        for (size_t i = offsets[row]; i < offsets[row + 1]; i++){
+            if (columns[i] == size){
+                rhs_[row] = values[i];
+                continue;
+            }
+            column_indices.push_back(columns[i]);
+            coefficients.push_back(values[i]);
+        }
+        row_offsets[row + 1] = column_indices.size();
+    }
+    matrix_ = sparse_type(size, size, std::move(row_offsets),
+                            std::move(column_indices),
+                            std::move(coefficients));
+}
+
+bool SleKrylov::IsSpdCandidate(const sparse_type& matrix){
+    const size_t size = matrix.RowsSize();
+
+    if (!size || matrix.ColumnsSize() != size) return false;
+    for (double element : matrix.Diagonal()){
+        if (!(element > 0)) return false;
+    }
+
+    // Rows of the transposed matrix are columns of this one, so both
+    // have the same arrays if the matrix is symmetric
+    const sparse_type transposed = matrix.Transpose();
+    const auto columns = matrix.ColumnIndices();
+    const auto values = matrix.Values();
+    const auto transposed_values = transposed.Values();
+
+    if (!std::equal(columns.begin(), columns.end(),
+                    transposed.ColumnIndices().begin()) ||
+            !std::equal(matrix.RowOffsets().begin(),
+                        matrix.RowOffsets().end(),
+                        transposed.RowOffsets().begin())){
+        return false;
+    }
+    for (size_t i = 0; i < values.size(); i++){
+        const double value = values[i];
+        const double mirrored = transposed_values[i];
+
+        if (std::abs(value - mirrored) > SYMMETRY_TOLERANCE *
+                std::max(std::abs(value), std::abs(mirrored))){
+            return false;
+        }
+    }
+    return true;
+}
+
+SleKrylov::result_roots_type SleKrylov::Solve() const{
+    if (!matrix_.RowsSize()){
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
+                    "Invalid matrix: Augmented matrix must be n x (n + 1)");
+        return result_roots_type();
+    }
+
+    const KrylovSolver solver(matrix_, options_, pool_);
+
+    if (IsSpdCandidate(matrix_)){
+        result_roots_type result = solver.ConjugateGradient(rhs_);
+
+        if (!result.residual_history.empty() &&
+                result.residual_history.back() <= options_.tolerance){
+            return result;
+        }
+    }
+    return solver.Gmres(rhs_);
+}
+}
@@ -0,0 +1,320 @@
+#include "../includes/sle_lu.h"
+
+#include <numeric>
+
+namespace s21{
+
+namespace {
+
+// Rows of the panel below the pivot claimed by a thread at once
+constexpr std::size_t PANEL_ROWS_BLOCK = 256;
+// Columns of the block row claimed by a thread at once
+constexpr std::size_t BLOCK_ROW_COLUMNS = 512;
+
+}
+
+BlockedLu::BlockedLu(size_t threads_count, size_type panel_width,
+                    sle::GemmBlocking blocking)
+                    : threads_count_(threads_count ? threads_count : 1),
+                        panel_width_(panel_width ? panel_width : 1),
+                        blocking_(blocking),
+                        axpy_(sle::GetAxpyKernel()) { }
+
+bool BlockedLu::Factorize(matrix_type& matrix,
+                        permutation_type& permutation) const{
+    if (matrix.RowsSize() != matrix.ColumnsSize()){
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
+                    "Invalid matrix: Only square matrices can be factorized");
+        return false;
+    }
+    if (Factorize(matrix.Data(), matrix.RowsSize(),
+                    matrix.LeadingDimension(), matrix.ColumnsSize(),
+                    permutation)){
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
+                    "Invalid matrix: Matrix is singular");
+        return false;
+    }
+    return true;
+}
+
+BlockedLu::size_type BlockedLu::Factorize(elements_type* data,
+                                        size_type size,
+                                        size_type leading_dimension,
+                                        size_type row_length,
+                                        permutation_type& permutation) const{
+    size_type zero_pivots = 0;
+
+    permutation.resize(size);
+    std::iota(permutation.begin(), permutation.end(), size_type(0));
+    for (size_type panel_begin = 0; panel_begin < size;
+            panel_begin += panel_width_){
+        const size_type panel_end = std::min(panel_begin + panel_width_,
+                                            size);
+
+        zero_pivots += FactorizePanel_(data, size, leading_dimension,
+                                        row_length, panel_begin, panel_end,
+                                        permutation);
+        if (panel_end >= row_length) continue;
+
+        SolveBlockRow_(data, leading_dimension, row_length, panel_begin,
+                        panel_end);
+        // A22 -= L21 * U12, right-hand sides included
+        sle::GemmSubtract(
+            size - panel_end, row_length - panel_end,
+            panel_end - panel_begin,
+            data + panel_end * leading_dimension + panel_begin,
+            leading_dimension,
+            data + panel_begin * leading_dimension + panel_end,
+            leading_dimension,
+            data + panel_end * leading_dimension + panel_end,
+            leading_dimension,
+            threads_count_, blocking_
+        );
+    }
+    return zero_pivots;
+}
+
+BlockedLu::size_type BlockedLu::FactorizePanel_(elements_type* data,
+                                            size_type size,
+                                            size_type leading_dimension,
+                                            size_type row_length,
+                                            size_type panel_begin,
+                                            size_type panel_end,
+                                            permutation_type& permutation
+                                            ) const{
+    size_type zero_pivots = 0;
+
+    for (size_type column = panel_begin; column < panel_end; column++){
+        elements_type* pivot_row = data + column * leading_dimension;
+        size_type pivot_i = column;
+        elements_type pivot_abs = std::abs(pivot_row[column]);
+
+        for (size_type row_i = column + 1; row_i < size; row_i++){
+            const elements_type value_abs = std::abs(
+                data[row_i * leading_dimension + column]
+            );
+
+            if (value_abs > pivot_abs){
+                pivot_i = row_i;
+                pivot_abs = value_abs;
+            }
+        }
+        if (pivot_i != column){
+            std::swap_ranges(pivot_row, pivot_row + row_length,
+                            data + pivot_i * leading_dimension);
+            std::swap(permutation[column], permutation[pivot_i]);
+        }
+        if (pivot_abs == 0){
+            zero_pivots++;
+            continue;
+        }
+
+        const elements_type pivot = pivot_row[column];
+        const size_type width = panel_end - column - 1;
+
+        ThreadPool::Instance().ParallelFor(
+            column + 1, size,
+            [&](size_type row_begin, size_type row_end){
+                for (size_type row_i = row_begin; row_i < row_end; row_i++){
+                    elements_type* row = data + row_i * leading_dimension;
+
+                    row[column] /= pivot;
+                    if (width) axpy_(width, -row[column],
+                                    pivot_row + column + 1,
+                                    row + column + 1);
+                }
+            },
+            PANEL_ROWS_BLOCK,
+            threads_count_
+        );
+    }
+    return zero_pivots;
+}
+
+void BlockedLu::SolveBlockRow_(elements_type* data,
+                            size_type leading_dimension,
+                            size_type row_length, size_type panel_begin,
+                            size_type panel_end) const{
+    ThreadPool::Instance().ParallelFor(
+        panel_end, row_length,
+        [&](size_type column_begin, size_type column_end){
+            for (size_type row_i = panel_begin + 1; row_i < panel_end;
+                    row_i++){
+                elements_type* row = data + row_i * leading_dimension;
+
+                for (size_type inner_i = panel_begin; inner_i < row_i;
+                        inner_i++){
+                    axpy_(column_end - column_begin, -row[inner_i],
+                        data + inner_i * leading_dimension + column_begin,
+                        row + column_begin);
+                }
+            }
+        },
+        BLOCK_ROW_COLUMNS,
+        threads_count_
+    );
+}
+
+
+LuSolver::LuSolver(size_t threads_count)
+                    : threads_count_(threads_count ? threads_count : 1),
+                        lu_(threads_count_),
+                        factors_(new matrix_type(0, 0)),
+                        is_factorized_(false),
+                        axpy_(sle::GetAxpyKernel()),
+                        dot_(sle::GetDotKernel()) { }
+
+bool LuSolver::Factorize(const matrix_type& matrix){
+    // Matrix can't be assigned over a non-empty one
+    factors_ = std::make_unique<matrix_type>(matrix);
+    is_factorized_ = lu_.Factorize(*factors_, permutation_);
+    return is_factorized_;
+}
+
+bool LuSolver::Factorize(const sle_type& sle){
+    const size_type size = sle.RowsSize();
+
+    if (sle.ColumnsSize() != size + 1){
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
+                    "Invalid matrix: Coefficient matrix must be square");
+        is_factorized_ = false;
+        return false;
+    }
+
+    factors_ = std::make_unique<matrix_type>(size, size);
+    for (size_type row_i = 0; row_i < size; row_i++){
+        std::copy(sle[row_i].data(), sle[row_i].data() + size,
+                    (*factors_)[row_i].data());
+    }
+    is_factorized_ = lu_.Factorize(*factors_, permutation_);
+    return is_factorized_;
+}
+
+bool LuSolver::IsFactorized() const{
+    return is_factorized_;
+}
+
+LuSolver::size_type LuSolver::Size() const{
+    return is_factorized_ ? factors_->RowsSize() : 0;
+}
+
+const LuSolver::matrix_type& LuSolver::Factors() const{
+    return *factors_;
+}
+
+const LuSolver::permutation_type& LuSolver::Permutation() const{
+    return permutation_;
+}
+
+LuSolver::result_roots_type LuSolver::Solve(const vector_type& rhs) const{
+    result_roots_type result;
+
+    if (!IsSolvable_(rhs.size())) return result;
+
+    const matrix_type& factors = *factors_;
+    const size_type size = factors.RowsSize();
+    vector_type& roots = result.equation_roots;
+
+    roots.resize(size);
+    // L y = P b, then U x = y
+    for (size_type row_i = 0; row_i < size; row_i++){
+        roots[row_i] = rhs[permutation_[row_i]] -
+                        dot_(row_i, factors[row_i].data(), roots.data());
+    }
+    for (size_type row_i = size; row_i-- > 0;){
+        const elements_type* row = factors[row_i].data();
+
+        roots[row_i] = (roots[row_i] - dot_(size - row_i - 1,
+                                            row + row_i + 1,
+                                            roots.data() + row_i + 1)) /
+                        row[row_i];
+    }
+    return result;
+}
+
+bool LuSolver::Solve(const matrix_type& rhs, matrix_type& solutions) const{
+    if (!IsSolvable_(rhs.RowsSize())) return false;
+
+    const size_type size = factors_->RowsSize();
+    const size_type columns = rhs.ColumnsSize();
+
+    if (!solutions.RowsSize()){
+        solutions = matrix_type(size, columns);
+    } else if (solutions.RowsSize() != size ||
+                solutions.ColumnsSize() != columns){
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
+                    "Invalid solutions: Sizes differ from "
+                    "the right-hand sides ones");
+        return false;
+    }
+    if (!columns) return true;
+    for (size_type row_i = 0; row_i < size; row_i++){
+        std::copy(rhs[permutation_[row_i]].data(),
+                    rhs[permutation_[row_i]].data() + columns,
+                    solutions[row_i].data());
+    }
+    try{
+        ThreadPool::Instance().ParallelFor(
+            0, columns,
+            [this, &solutions](size_type column_begin, size_type column_end){
+                SubstituteColumns_(solutions, column_begin, column_end);
+            },
+            RHS_BLOCK,
+            threads_count_
+        );
+    } catch(const std::exception &e){
+        std::string error = "Threads problems: ";
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__, error + e.what());
+        return false;
+    }
+    return true;
+}
+
+bool LuSolver::IsSolvable_(size_type rhs_size) const{
+    if (!is_factorized_){
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
+                    "Invalid solver: No matrix is factorized");
+        return false;
+    }
+    if (rhs_size != factors_->RowsSize()){
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
+                    "Invalid right-hand side: Size differs from "
+                    "the factorized matrix one");
+        return false;
+    }
+    return true;
+}
+
+void LuSolver::SubstituteColumns_(matrix_type& solutions,
+                                size_type column_begin,
+                                size_type column_end) const{
+    const matrix_type& factors = *factors_;
+    const size_type size = factors.RowsSize();
+    const size_type width = column_end - column_begin;
+
+    // Rows of the block are updated by whole previous rows, so every
+    // factor is read once per block instead of once per right-hand side
+    for (size_type row_i = 1; row_i < size; row_i++){
+        const elements_type* factors_row = factors[row_i].data();
+        elements_type* row = solutions[row_i].data() + column_begin;
+
+        for (size_type inner_i = 0; inner_i < row_i; inner_i++){
+            axpy_(width, -factors_row[inner_i],
+                    solutions[inner_i].data() + column_begin, row);
+        }
+    }
+    for (size_type row_i = size; row_i-- > 0;){
+        const elements_type* factors_row = factors[row_i].data();
+        elements_type* row = solutions[row_i].data() + column_begin;
+
+        for (size_type inner_i = row_i + 1; inner_i < size; inner_i++){
+            axpy_(width, -factors_row[inner_i],
+                    solutions[inner_i].data() + column_begin, row);
+        }
+        for (size_type column_i = 0; column_i < width; column_i++){
+            row[column_i] /= factors_row[row_i];
+        }
+    }
+}
+
+}
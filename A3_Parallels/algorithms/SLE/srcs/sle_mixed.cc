@@ -0,0 +1,378 @@
+#include "../includes/sle_mixed.h"
+
+#include <numeric>
+#include <limits>
+
+namespace s21{
+
+namespace {
+
+// Rows of the panel below the pivot claimed by a thread at once
+constexpr std::size_t PANEL_ROWS_BLOCK = 256;
+// Trailing rows claimed by a thread at once
+constexpr std::size_t TRAILING_ROWS_BLOCK = 32;
+// Trailing columns updated at once: the block row of U slice stays in
+// cache while every row of the block is updated by it
+constexpr std::size_t TRAILING_COLUMNS_BLOCK = 1024;
+// Rows of the residual found by a thread at once
+constexpr std::size_t RESIDUAL_ROWS_BLOCK = 64;
+
+double MaxNorm(const std::vector<double>& vector){
+    double norm = 0;
+
+    for (double element : vector) norm = std::max(norm, std::abs(element));
+    return norm;
+}
+
+}
+
+MixedLuSolver::MixedLuSolver(size_type max_refinements, size_t threads_count,
+                            size_type panel_width)
+                            : max_refinements_(max_refinements),
+                                threads_count_(threads_count ?
+                                                threads_count : 1),
+                                panel_width_(panel_width ? panel_width : 1),
+                                matrix_(new matrix_type(0, 0)),
+                                leading_dimension_(0),
+                                matrix_norm_(0),
+                                is_factorized_(false),
+                                is_fallback_(false),
+                                lu_(threads_count_),
+                                axpy_(sle::GetFloatAxpyKernel()),
+                                dot_(sle::GetDotKernel()) { }
+
+bool MixedLuSolver::Factorize(const matrix_type& matrix){
+    if (matrix.RowsSize() != matrix.ColumnsSize()){
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
+                    "Invalid matrix: Only square matrices can be factorized");
+        is_factorized_ = false;
+        return false;
+    }
+    // Matrix can't be assigned over a non-empty one
+    matrix_ = std::make_unique<matrix_type>(matrix);
+    return Factorize_();
+}
+
+bool MixedLuSolver::Factorize(const sle_type& sle){
+    const size_type size = sle.RowsSize();
+
+    if (sle.ColumnsSize() != size + 1){
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
+                    "Invalid matrix: Coefficient matrix must be square");
+        is_factorized_ = false;
+        return false;
+    }
+
+    matrix_ = std::make_unique<matrix_type>(size, size);
+    for (size_type row_i = 0; row_i < size; row_i++){
+        std::copy(sle[row_i].data(), sle[row_i].data() + size,
+                    (*matrix_)[row_i].data());
+    }
+    return Factorize_();
+}
+
+bool MixedLuSolver::IsFactorized() const{
+    return is_factorized_;
+}
+
+bool MixedLuSolver::IsFallback() const{
+    return is_fallback_;
+}
+
+MixedLuSolver::size_type MixedLuSolver::Size() const{
+    return is_factorized_ ? matrix_->RowsSize() : 0;
+}
+
+MixedLuSolver::result_roots_type MixedLuSolver::Solve(
+                                                const vector_type& rhs){
+    result_roots_type result;
+
+    if (!IsSolvable_(rhs.size())) return result;
+
+    const size_type size = matrix_->RowsSize();
+    const elements_type rhs_norm = MaxNorm(rhs);
+    vector_type& roots = result.equation_roots;
+    vector_type& history = result.residual_history;
+    vector_type residual(size);
+
+    if (rhs_norm == 0){
+        roots.assign(size, 0);
+        history.push_back(0);
+        return result;
+    }
+    if (!is_fallback_){
+        // Backward error of double LU, as in LAPACK dsgesv
+        const elements_type threshold = matrix_norm_ *
+                                std::numeric_limits<elements_type>::epsilon() *
+                                std::sqrt(static_cast<elements_type>(size));
+        vector_type correction(size);
+
+        roots.resize(size);
+        SolveFloat_(rhs, rhs_norm, roots);
+        Residual_(rhs, roots, residual);
+
+        elements_type residual_norm = MaxNorm(residual);
+
+        history.push_back(residual_norm / rhs_norm);
+        for (size_type step = 0; step < max_refinements_ &&
+                residual_norm > threshold * MaxNorm(roots); step++){
+            const elements_type previous_norm = residual_norm;
+
+            SolveFloat_(residual, residual_norm, correction);
+            for (size_type i = 0; i < size; i++) roots[i] += correction[i];
+            Residual_(rhs, roots, residual);
+            residual_norm = MaxNorm(residual);
+            history.push_back(residual_norm / rhs_norm);
+            // The matrix is too ill-conditioned for float factors
+            if (!(residual_norm < previous_norm)) break;
+        }
+        if (residual_norm <= threshold * MaxNorm(roots)) return result;
+        if (!FallBack_()){
+            is_factorized_ = false;
+            return result_roots_type();
+        }
+    }
+    roots = lu_.Solve(rhs).equation_roots;
+    Residual_(rhs, roots, residual);
+    history.push_back(MaxNorm(residual) / rhs_norm);
+    return result;
+}
+
+bool MixedLuSolver::Factorize_(){
+    const size_type size = matrix_->RowsSize();
+
+    matrix_norm_ = 0;
+    for (size_type row_i = 0; row_i < size; row_i++){
+        const auto row = (*matrix_)[row_i];
+        elements_type row_norm = 0;
+
+        for (elements_type element : row) row_norm += std::abs(element);
+        matrix_norm_ = std::max(matrix_norm_, row_norm);
+    }
+    is_fallback_ = false;
+    is_factorized_ = FactorizeFloat_() || FallBack_();
+    return is_factorized_;
+}
+
+bool MixedLuSolver::FactorizeFloat_(){
+    const size_type size = matrix_->RowsSize();
+
+    leading_dimension_ = PaddedStride<factor_type>(size);
+    factors_.assign(size * leading_dimension_, 0);
+    for (size_type row_i = 0; row_i < size; row_i++){
+        const auto row = (*matrix_)[row_i];
+        factor_type* factors_row = factors_.data() +
+                                    row_i * leading_dimension_;
+
+        for (size_type column = 0; column < size; column++){
+            if (!(std::abs(row[column]) <=
+                    std::numeric_limits<factor_type>::max())){
+                return false;
+            }
+            factors_row[column] = static_cast<factor_type>(row[column]);
+        }
+    }
+    permutation_.resize(size);
+    std::iota(permutation_.begin(), permutation_.end(), size_type(0));
+    for (size_type panel_begin = 0; panel_begin < size;
+            panel_begin += panel_width_){
+        const size_type panel_end = std::min(panel_begin + panel_width_,
+                                            size);
+
+        if (!FactorizePanel_(panel_begin, panel_end)) return false;
+        if (panel_end < size) UpdateTrailing_(panel_begin, panel_end);
+    }
+    return true;
+}
+
+bool MixedLuSolver::FactorizePanel_(size_type panel_begin,
+                                    size_type panel_end){
+    const size_type size = matrix_->RowsSize();
+    factor_type* data = factors_.data();
+
+    for (size_type column = panel_begin; column < panel_end; column++){
+        factor_type* pivot_row = data + column * leading_dimension_;
+        size_type pivot_i = column;
+        factor_type pivot_abs = std::abs(pivot_row[column]);
+
+        for (size_type row_i = column + 1; row_i < size; row_i++){
+            const factor_type value_abs = std::abs(
+                data[row_i * leading_dimension_ + column]
+            );
+
+            if (value_abs > pivot_abs){
+                pivot_i = row_i;
+                pivot_abs = value_abs;
+            }
+        }
+        if (!(pivot_abs > 0) || !std::isfinite(pivot_abs)) return false;
+        if (pivot_i != column){
+            std::swap_ranges(pivot_row, pivot_row + size,
+                            data + pivot_i * leading_dimension_);
+            std::swap(permutation_[column], permutation_[pivot_i]);
+        }
+
+        const factor_type pivot = pivot_row[column];
+        const size_type width = panel_end - column - 1;
+
+        ThreadPool::Instance().ParallelFor(
+            column + 1, size,
+            [&](size_type row_begin, size_type row_end){
+                for (size_type row_i = row_begin; row_i < row_end; row_i++){
+                    factor_type* row = data + row_i * leading_dimension_;
+
+                    row[column] /= pivot;
+                    if (width) axpy_(width, -row[column],
+                                    pivot_row + column + 1,
+                                    row + column + 1);
+                }
+            },
+            PANEL_ROWS_BLOCK,
+            threads_count_
+        );
+    }
+    return true;
+}
+
+void MixedLuSolver::UpdateTrailing_(size_type panel_begin,
+                                    size_type panel_end){
+    const size_type size = matrix_->RowsSize();
+    factor_type* data = factors_.data();
+
+    // U12 = L11^-1 A12
+    ThreadPool::Instance().ParallelFor(
+        panel_end, size,
+        [&](size_type column_begin, size_type column_end){
+            for (size_type row_i = panel_begin + 1; row_i < panel_end;
+                    row_i++){
+                factor_type* row = data + row_i * leading_dimension_;
+
+                for (size_type inner_i = panel_begin; inner_i < row_i;
+                        inner_i++){
+                    axpy_(column_end - column_begin, -row[inner_i],
+                        data + inner_i * leading_dimension_ + column_begin,
+                        row + column_begin);
+                }
+            }
+        },
+        TRAILING_COLUMNS_BLOCK,
+        threads_count_
+    );
+    // A22 -= L21 * U12
+    ThreadPool::Instance().ParallelFor(
+        panel_end, size,
+        [&](size_type row_begin, size_type row_end){
+            for (size_type column_begin = panel_end; column_begin < size;
+                    column_begin += TRAILING_COLUMNS_BLOCK){
+                const size_type width = std::min(TRAILING_COLUMNS_BLOCK,
+                                                size - column_begin);
+
+                for (size_type row_i = row_begin; row_i < row_end; row_i++){
+                    factor_type* row = data + row_i * leading_dimension_;
+
+                    for (size_type inner_i = panel_begin;
+                            inner_i < panel_end; inner_i++){
+                        axpy_(width, -row[inner_i],
+                            data + inner_i * leading_dimension_ +
+                                column_begin,
+                            row + column_begin);
+                    }
+                }
+            }
+        },
+        TRAILING_ROWS_BLOCK,
+        threads_count_
+    );
+}
+
+bool MixedLuSolver::FallBack_(){
+    is_fallback_ = true;
+    return lu_.Factorize(*matrix_);
+}
+
+bool MixedLuSolver::IsSolvable_(size_type rhs_size) const{
+    if (!is_factorized_){
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
+                    "Invalid solver: No matrix is factorized");
+        return false;
+    }
+    if (rhs_size != matrix_->RowsSize()){
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
+                    "Invalid right-hand side: Size differs from "
+                    "the factorized matrix one");
+        return false;
+    }
+    return true;
+}
+
+void MixedLuSolver::SolveFloat_(const vector_type& rhs, elements_type scale,
+                                vector_type& roots) const{
+    const size_type size = rhs.size();
+    const factor_type* data = factors_.data();
+    std::vector<factor_type> solution(size);
+
+    // L y = P b / scale, then U x = y
+    for (size_type row_i = 0; row_i < size; row_i++){
+        const factor_type* row = data + row_i * leading_dimension_;
+        factor_type sum = static_cast<factor_type>(
+            rhs[permutation_[row_i]] / scale
+        );
+
+        for (size_type inner_i = 0; inner_i < row_i; inner_i++){
+            sum -= row[inner_i] * solution[inner_i];
+        }
+        solution[row_i] = sum;
+    }
+    for (size_type row_i = size; row_i-- > 0;){
+        const factor_type* row = data + row_i * leading_dimension_;
+        factor_type sum = solution[row_i];
+
+        for (size_type inner_i = row_i + 1; inner_i < size; inner_i++){
+            sum -= row[inner_i] * solution[inner_i];
+        }
+        solution[row_i] = sum / row[row_i];
+    }
+    for (size_type i = 0; i < size; i++) roots[i] = solution[i] * scale;
+}
+
+void MixedLuSolver::Residual_(const vector_type& rhs,
+                            const vector_type& roots,
+                            vector_type& residual) const{
+    const matrix_type& matrix = *matrix_;
+    const size_type size = matrix.RowsSize();
+
+    ThreadPool::Instance().ParallelFor(
+        0, size,
+        [&](size_type row_begin, size_type row_end){
+            for (size_type row_i = row_begin; row_i < row_end; row_i++){
+                residual[row_i] = rhs[row_i] - dot_(size,
+                                                    matrix[row_i].data(),
+                                                    roots.data());
+            }
+        },
+        RESIDUAL_ROWS_BLOCK,
+        threads_count_
+    );
+}
+
+
+SleMixedLu::SleMixedLu(const matrix_type& matrix, size_t threads_count)
+                        : matrix_(matrix),
+                            solver_(MixedLuSolver::DEFAULT_MAX_REFINEMENTS,
+                                    threads_count) { }
+
+SleMixedLu::result_roots_type SleMixedLu::Solve(){
+    if (!solver_.Factorize(matrix_)) return result_roots_type();
+
+    const size_t size = matrix_.RowsSize();
+    std::vector<double> rhs(size);
+
+    for (size_t row = 0; row < size; row++) rhs[row] = matrix_[row][size];
+    return solver_.Solve(rhs);
+}
+
+bool SleMixedLu::IsFallback() const{
+    return solver_.IsFallback();
+}
+
+}
@@ -0,0 +1,205 @@
+#include "../includes/sle_simd.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SLE_X86
+#include <immintrin.h>
+#endif
+
+namespace s21::sle{
+
+namespace {
+
+void ScalarAxpy(std::size_t count, double alpha, const double* x,
+                double* y){
+    for (std::size_t i = 0; i < count; i++){
+        y[i] += alpha * x[i];
+    }
+}
+
+void ScalarFloatAxpy(std::size_t count, float alpha, const float* x,
+                    float* y){
+    for (std::size_t i = 0; i < count; i++){
+        y[i] += alpha * x[i];
+    }
+}
+
+double ScalarDot(std::size_t count, const double* x, const double* y){
+    double sum = 0;
+
+    for (std::size_t i = 0; i < count; i++){
+        sum += x[i] * y[i];
+    }
+    return sum;
+}
+
+#ifdef SLE_X86
+
+__attribute__((target("avx2,fma")))
+double Avx2Dot(std::size_t count, const double* x, const double* y){
+    __m256d sum0 = _mm256_setzero_pd();
+    __m256d sum1 = _mm256_setzero_pd();
+    std::size_t i = 0;
+
+    for (; i + 8 <= count; i += 8){
+        sum0 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i),
+                                sum0);
+        sum1 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i + 4),
+                                _mm256_loadu_pd(y + i + 4), sum1);
+    }
+
+    alignas(32) double lanes[4];
+    double sum = 0;
+
+    _mm256_store_pd(lanes, _mm256_add_pd(sum0, sum1));
+    for (; i < count; i++){
+        sum = __builtin_fma(x[i], y[i], sum);
+    }
+    return sum + (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+}
+
+__attribute__((target("avx512f")))
+double Avx512Dot(std::size_t count, const double* x, const double* y){
+    __m512d sum0 = _mm512_setzero_pd();
+    __m512d sum1 = _mm512_setzero_pd();
+    std::size_t i = 0;
+
+    for (; i + 16 <= count; i += 16){
+        sum0 = _mm512_fmadd_pd(_mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i),
+                                sum0);
+        sum1 = _mm512_fmadd_pd(_mm512_loadu_pd(x + i + 8),
+                                _mm512_loadu_pd(y + i + 8), sum1);
+    }
+    if (i + 8 <= count){
+        sum0 = _mm512_fmadd_pd(_mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i),
+                                sum0);
+        i += 8;
+    }
+    if (i < count){
+        const __mmask8 tail = static_cast<__mmask8>((1u << (count - i)) - 1);
+
+        sum1 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(tail, x + i),
+                                _mm512_maskz_loadu_pd(tail, y + i), sum1);
+    }
+    return _mm512_reduce_add_pd(_mm512_add_pd(sum0, sum1));
+}
+
+__attribute__((target("avx2,fma")))
+void Avx2Axpy(std::size_t count, double alpha, const double* x, double* y){
+    const __m256d a = _mm256_set1_pd(alpha);
+    std::size_t i = 0;
+
+    for (; i + 8 <= count; i += 8){
+        _mm256_storeu_pd(y + i, _mm256_fmadd_pd(
+            a, _mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i)));
+        _mm256_storeu_pd(y + i + 4, _mm256_fmadd_pd(
+            a, _mm256_loadu_pd(x + i + 4), _mm256_loadu_pd(y + i + 4)));
+    }
+    for (; i < count; i++){
+        y[i] = __builtin_fma(alpha, x[i], y[i]);
+    }
+}
+
+__attribute__((target("avx512f")))
+void Avx512Axpy(std::size_t count, double alpha, const double* x,
+                double* y){
+    const __m512d a = _mm512_set1_pd(alpha);
+    std::size_t i = 0;
+
+    for (; i + 16 <= count; i += 16){
+        _mm512_storeu_pd(y + i, _mm512_fmadd_pd(
+            a, _mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i)));
+        _mm512_storeu_pd(y + i + 8, _mm512_fmadd_pd(
+            a, _mm512_loadu_pd(x + i + 8), _mm512_loadu_pd(y + i + 8)));
+    }
+    for (; i + 8 <= count; i += 8){
+        _mm512_storeu_pd(y + i, _mm512_fmadd_pd(
+            a, _mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i)));
+    }
+    if (i < count){
+        const __mmask8 tail = static_cast<__mmask8>((1u << (count - i)) - 1);
+
+        _mm512_mask_storeu_pd(y + i, tail, _mm512_fmadd_pd(
+            a, _mm512_maskz_loadu_pd(tail, x + i),
+            _mm512_maskz_loadu_pd(tail, y + i)));
+    }
+}
+
+__attribute__((target("avx2,fma")))
+void Avx2FloatAxpy(std::size_t count, float alpha, const float* x,
+                    float* y){
+    const __m256 a = _mm256_set1_ps(alpha);
+    std::size_t i = 0;
+
+    for (; i + 16 <= count; i += 16){
+        _mm256_storeu_ps(y + i, _mm256_fmadd_ps(
+            a, _mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i)));
+        _mm256_storeu_ps(y + i + 8, _mm256_fmadd_ps(
+            a, _mm256_loadu_ps(x + i + 8), _mm256_loadu_ps(y + i + 8)));
+    }
+    for (; i < count; i++){
+        y[i] = __builtin_fmaf(alpha, x[i], y[i]);
+    }
+}
+
+__attribute__((target("avx512f")))
+void Avx512FloatAxpy(std::size_t count, float alpha, const float* x,
+                    float* y){
+    const __m512 a = _mm512_set1_ps(alpha);
+    std::size_t i = 0;
+
+    for (; i + 32 <= count; i += 32){
+        _mm512_storeu_ps(y + i, _mm512_fmadd_ps(
+            a, _mm512_loadu_ps(x + i), _mm512_loadu_ps(y + i)));
+        _mm512_storeu_ps(y + i + 16, _mm512_fmadd_ps(
+            a, _mm512_loadu_ps(x + i + 16), _mm512_loadu_ps(y + i + 16)));
+    }
+    for (; i + 16 <= count; i += 16){
+        _mm512_storeu_ps(y + i, _mm512_fmadd_ps(
+            a, _mm512_loadu_ps(x + i), _mm512_loadu_ps(y + i)));
+    }
+    if (i < count){
+        const __mmask16 tail = static_cast<__mmask16>(
+            (1u << (count - i)) - 1
+        );
+
+        _mm512_mask_storeu_ps(y + i, tail, _mm512_fmadd_ps(
+            a, _mm512_maskz_loadu_ps(tail, x + i),
+            _mm512_maskz_loadu_ps(tail, y + i)));
+    }
+}
+
+#endif
+
+}
+
+axpy_kernel_type GetAxpyKernel(){
+#ifdef SLE_X86
+    if (__builtin_cpu_supports("avx512f")) return Avx512Axpy;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")){
+        return Avx2Axpy;
+    }
+#endif
+    return ScalarAxpy;
+}
+
+float_axpy_kernel_type GetFloatAxpyKernel(){
+#ifdef SLE_X86
+    if (__builtin_cpu_supports("avx512f")) return Avx512FloatAxpy;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")){
+        return Avx2FloatAxpy;
+    }
+#endif
+    return ScalarFloatAxpy;
+}
+
+dot_kernel_type GetDotKernel(){
+#ifdef SLE_X86
+    if (__builtin_cpu_supports("avx512f")) return Avx512Dot;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")){
+        return Avx2Dot;
+    }
+#endif
+    return ScalarDot;
+}
+
+}
@@ -0,0 +1,253 @@
+#include "../includes/sle_tiled.h"
+
+#include <numeric>
+
+namespace s21{
+
+namespace {
+
+// Rows of the panel below the pivot claimed by a thread at once
+constexpr std::size_t PANEL_ROWS_BLOCK = 256;
+
+}
+
+TiledLu::TiledLu(size_type tile_size, size_type lookahead, ThreadPool& pool)
+                : tile_size_(tile_size ? tile_size : 1),
+                    lookahead_(lookahead),
+                    pool_(pool),
+                    axpy_(sle::GetAxpyKernel()) { }
+
+bool TiledLu::Factorize(matrix_type& matrix,
+                        permutation_type& permutation) const{
+    if (matrix.RowsSize() != matrix.ColumnsSize()){
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
+                    "Invalid matrix: Only square matrices can be factorized");
+        return false;
+    }
+    try{
+        if (Factorize(matrix.Data(), matrix.RowsSize(),
+                        matrix.LeadingDimension(), matrix.ColumnsSize(),
+                        permutation)){
+            PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
+                        "Invalid matrix: Matrix is singular");
+            return false;
+        }
+    } catch(const std::exception &e){
+        std::string error = "Threads problems: ";
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__, error + e.what());
+        return false;
+    }
+    return true;
+}
+
+TiledLu::size_type TiledLu::Factorize(elements_type* data, size_type size,
+                                    size_type leading_dimension,
+                                    size_type row_length,
+                                    permutation_type& permutation) const{
+    const size_type tile = tile_size_;
+    const size_type steps = (size + tile - 1) / tile;
+    // Columns right of the block are tiled from its end, so the last
+    // tiles column of the block is its last panel
+    const size_type right_columns = row_length > size ? row_length - size
+                                                        : 0;
+    const size_type columns = steps + (right_columns + tile - 1) / tile;
+    auto column_begin_of = [=](size_type column){
+        return column < steps ? column * tile
+                                : size + (column - steps) * tile;
+    };
+    permutation_type pivots(size);
+    std::atomic<size_type> zero_pivots(0);
+    TaskGraph graph(pool_);
+    // Update tasks of the previous step writing every tiles column
+    std::vector<std::vector<TaskGraph::task_id_type>> writers(columns);
+
+    for (size_type step = 0; step < steps; step++){
+        const size_type panel_begin = step * tile;
+        const size_type panel_end = std::min(panel_begin + tile, size);
+        const auto panel = graph.Add(
+            [=, &pivots, &zero_pivots](){
+                zero_pivots += FactorizePanel_(data, size, leading_dimension,
+                                                panel_begin, panel_end,
+                                                pivots);
+            },
+            PANEL_PRIORITY
+        );
+
+        for (auto writer : writers[step]) graph.Precede(writer, panel);
+        for (size_type column = step + 1; column < columns; column++){
+            const size_type column_begin = column_begin_of(column);
+            const size_type column_end = column + 1 < columns ?
+                                        column_begin_of(column + 1)
+                                        : row_length;
+            const TaskGraph::priority_type priority =
+                column <= step + lookahead_ ? LOOKAHEAD_PRIORITY
+                                            : UPDATE_PRIORITY;
+            const auto block_row = graph.Add(
+                [=, &pivots](){
+                    SolveBlockRow_(data, leading_dimension, panel_begin,
+                                    panel_end, column_begin, column_end,
+                                    pivots);
+                },
+                priority
+            );
+
+            // Rows swapped by the panel may be anywhere below it, so the
+            // whole tiles column has to be updated by the previous step
+            graph.Precede(panel, block_row);
+            for (auto writer : writers[column]){
+                graph.Precede(writer, block_row);
+            }
+            writers[column].clear();
+            for (size_type row_begin = panel_end; row_begin < size;
+                    row_begin += tile){
+                const size_type rows = std::min(tile, size - row_begin);
+                const auto update = graph.Add(
+                    [=](){
+                        // A_ij -= L_ik * U_kj
+                        sle::GemmSubtract(
+                            rows, column_end - column_begin,
+                            panel_end - panel_begin,
+                            data + row_begin * leading_dimension +
+                                panel_begin,
+                            leading_dimension,
+                            data + panel_begin * leading_dimension +
+                                column_begin,
+                            leading_dimension,
+                            data + row_begin * leading_dimension +
+                                column_begin,
+                            leading_dimension
+                        );
+                    },
+                    priority
+                );
+
+                graph.Precede(block_row, update);
+                writers[column].push_back(update);
+            }
+        }
+    }
+    graph.Run();
+    ApplyPivots_(data, size, leading_dimension, pivots, permutation);
+    return zero_pivots;
+}
+
+TiledLu::size_type TiledLu::FactorizePanel_(elements_type* data,
+                                        size_type size,
+                                        size_type leading_dimension,
+                                        size_type panel_begin,
+                                        size_type panel_end,
+                                        permutation_type& pivots) const{
+    size_type zero_pivots = 0;
+
+    for (size_type column = panel_begin; column < panel_end; column++){
+        elements_type* pivot_row = data + column * leading_dimension;
+        size_type pivot_i = column;
+        elements_type pivot_abs = std::abs(pivot_row[column]);
+
+        for (size_type row_i = column + 1; row_i < size; row_i++){
+            const elements_type value_abs = std::abs(
+                data[row_i * leading_dimension + column]
+            );
+
+            if (value_abs > pivot_abs){
+                pivot_i = row_i;
+                pivot_abs = value_abs;
+            }
+        }
+        pivots[column] = pivot_i;
+        if (pivot_i != column){
+            std::swap_ranges(pivot_row + panel_begin, pivot_row + panel_end,
+                            data + pivot_i * leading_dimension +
+                                panel_begin);
+        }
+        if (pivot_abs == 0){
+            zero_pivots++;
+            continue;
+        }
+
+        const elements_type pivot = pivot_row[column];
+        const size_type width = panel_end - column - 1;
+
+        pool_.ParallelFor(
+            column + 1, size,
+            [&](size_type row_begin, size_type row_end){
+                for (size_type row_i = row_begin; row_i < row_end; row_i++){
+                    elements_type* row = data + row_i * leading_dimension;
+
+                    row[column] /= pivot;
+                    if (width) axpy_(width, -row[column],
+                                    pivot_row + column + 1,
+                                    row + column + 1);
+                }
+            },
+            PANEL_ROWS_BLOCK
+        );
+    }
+    return zero_pivots;
+}
+
+void TiledLu::SolveBlockRow_(elements_type* data,
+                            size_type leading_dimension,
+                            size_type panel_begin, size_type panel_end,
+                            size_type column_begin, size_type column_end,
+                            const permutation_type& pivots) const{
+    const size_type width = column_end - column_begin;
+
+    for (size_type row_i = panel_begin; row_i < panel_end; row_i++){
+        if (pivots[row_i] == row_i) continue;
+
+        elements_type* row = data + row_i * leading_dimension + column_begin;
+
+        std::swap_ranges(row, row + width,
+                        data + pivots[row_i] * leading_dimension +
+                            column_begin);
+    }
+    for (size_type row_i = panel_begin + 1; row_i < panel_end; row_i++){
+        elements_type* row = data + row_i * leading_dimension;
+
+        for (size_type inner_i = panel_begin; inner_i < row_i; inner_i++){
+            axpy_(width, -row[inner_i],
+                data + inner_i * leading_dimension + column_begin,
+                row + column_begin);
+        }
+    }
+}
+
+void TiledLu::ApplyPivots_(elements_type* data, size_type size,
+                        size_type leading_dimension,
+                        const permutation_type& pivots,
+                        permutation_type& permutation) const{
+    const size_type steps = (size + tile_size_ - 1) / tile_size_;
+
+    // Rows of L in every tiles column are swapped by the pivots of every
+    // later panel, in order
+    pool_.ParallelFor(
+        0, steps,
+        [&](size_type step_begin, size_type step_end){
+            for (size_type step = step_begin; step < step_end; step++){
+                const size_type column_begin = step * tile_size_;
+                const size_type column_end = std::min(
+                    column_begin + tile_size_,
+                    size
+                );
+
+                for (size_type row_i = column_end; row_i < size; row_i++){
+                    if (pivots[row_i] == row_i) continue;
+
+                    elements_type* row = data + row_i * leading_dimension;
+
+                    std::swap_ranges(row + column_begin, row + column_end,
+                                    data + pivots[row_i] *
+                                        leading_dimension + column_begin);
+                }
+            }
+        }
+    );
+    permutation.resize(size);
+    std::iota(permutation.begin(), permutation.end(), size_type(0));
+    for (size_type row_i = 0; row_i < size; row_i++){
+        std::swap(permutation[row_i], permutation[pivots[row_i]]);
+    }
+}
+
+}
@@ -1,36 +1,31 @@
 #ifndef WINOGRAD
 #define WINOGRAD
 
-#include <condition_variable>
-#include <functional>
-#include <unistd.h>
 #include <utility>
 #include <vector>
 #include <memory>
 #include <limits>
 #include <thread>
-#include <queue>
+#include <string>
+#include <atomic>
 #include <cmath>
-#include <mutex>
-#include <map>
 
+#include "winograd_kernel.h"
+#include "winograd_blocked.h"
+#include "winograd_strassen.h"
+#include "winograd_prepared.h"
+#include "winograd_batched.h"
+#include "winograd_fixed.h"
+#include "winograd_gemm.h"
+#include "winograd_skinny.h"
+#include "winograd_out_of_core.h"
 #include "../../../utils/includes/utils.h"
+#include "../../../utils/includes/spsc_ring.h"
+#include "../../../utils/includes/thread_pool.h"
 #include "../../../matrix/includes/matrix.h"
 
 namespace s21{
 
-enum class WhitchMultiplicatorsCalculate {
-    FIRST = 0,
-    FIRST_SECOND = 1,
-    SECOND = 2,
-    NO_ONE = 3
-};
-
-enum class WhichMultiplicationCalculationSolution{
-    FOR_FIRST_ELEM = 0,
-    FOR_NEXT_ELEMS = 1
-};
-
 class WinogradParent{
 public:
     using elements_type             = double;
@@ -40,34 +35,26 @@ public:
     using result_matrix_rows_type   = typename result_matrix_type::rows_type;
     using row_size_type             = typename matrix_type::row_size_type;
     using column_size_type          = typename matrix_type::column_size_type;
-    using multiplicators_arrray     = std::map<row_size_type, elements_type>;
-    using multiplicators_arrray_reference
-                                    = multiplicators_arrray&;
+    using factors_type              = winograd::factors_type;
     using matrices_pair             = std::pair<
                                         matrix_type_const_ref,
                                         matrix_type_const_ref>;
     using matrices_pair_ptr         = matrices_pair*;
-    using matrix_rows_unique_ptr    = std::unique_ptr<result_matrix_rows_type>;
-    using multiplications_calculate_pair
-                                    = std::pair<
-                                        WhitchMultiplicatorsCalculate,
-                                        WhitchMultiplicatorsCalculate>;
-    using extra_multiplier_func     = std::function<elements_type(
-                                            row_size_type,
-                                            column_size_type)>;
-    using multiplicators_func       = std::function<elements_type(
-                                        elements_type,
-                                        multiplicators_arrray_reference,
-                                        row_size_type,
-                                        column_size_type,
-                                        column_size_type)>;
-
-    WinogradParent();
-    ~WinogradParent() = default;
+    using simd_level_type           = winograd::SimdLevel;
+
+    /**
+     * Second matrices of up to SKINNY_MAX_COLUMNS columns are multiplied
+     * by skinny kernels of [simd_level] split between
+     * [skinny_threads_count] threads instead of RowsMultiplication_
+     */
+    explicit WinogradParent(size_t skinny_threads_count = 1,
+                            simd_level_type simd_level =
+                                winograd::DetectSimdLevel());
+    virtual ~WinogradParent() = default;
 
     /**
      * Multiplying [matrix_first] and [matrix_second] by Winograd method
-     * @return result_matrix_type object
+     * @return result_matrix_type object, empty if matrices are invalid
      */
     result_matrix_type WinogradMultiplication(
                             matrix_type_const_ref matrix_first,
@@ -75,7 +62,14 @@ public:
 
 protected:
     result_matrix_type result_matrix_;
-    multiplicators_arrray second_matrix_multiplicators_;
+    // Winograd factors of the first matrix rows
+    factors_type row_factors_;
+    // Winograd factors of the second matrix columns
+    factors_type column_factors_;
+    size_t skinny_threads_count_;
+    simd_level_type simd_level_;
+    // Second matrix of the last skinny multiplication
+    winograd::SkinnyColumns skinny_second_;
 
     /**
      * Check if matrices' sizes [matrix_first_column_count] and 
@@ -86,47 +80,38 @@ protected:
     bool IsMatricesInvalid_(column_size_type matrix_first_column_count,
                         row_size_type matrix_second_row_count);
 
+    /**
+     * Precalculating rows' and columns' factors, preallocating
+     * result_matrix_ and starting rows calculation
+     */
     void StartMultiplication_(matrices_pair_ptr matrices_ptr);
 
     /**
-     * Creating lambda function which returns extra multiplicator for
-     * [matrices_ptr] first matrix, if odd size of elements in row, or zero
-     * @return extra_multiplier_func object
+     * Precalculating row_factors_ and column_factors_
      */
-    extra_multiplier_func MatrixMultiplication_(matrices_pair_ptr matrices_ptr);
+    virtual void CalculateFactors_(matrices_pair_ptr matrices_ptr);
 
-    virtual void RowsMultiplication_(matrices_pair_ptr matrices_ptr,
-                            extra_multiplier_func element_calculation) = 0;
+    virtual void RowsMultiplication_(matrices_pair_ptr matrices_ptr) = 0;
 
     /**
-     * Defining pattern for calculating multiplicators depending 
-     * of the calculating element of matrices in [matrices_ptr]
-     * @return multiplicators_func object
+     * Multiplying by a second matrix of up to SKINNY_MAX_COLUMNS columns:
+     * the first matrix is streamed once, its row factors are calculated
+     * on the fly
      */
-    multiplicators_func DefineMultiplicatorsFunc_(
-                                    WhitchMultiplicatorsCalculate code,
-                                    matrices_pair_ptr matrices_ptr);
+    virtual void SkinnyMultiplication_(matrices_pair_ptr matrices_ptr);
 
     /**
-     * Defining ways for calculating multiplicators depending 
-     * of the calculating element of matrices in [matrices_ptr]
-     * @return multiplications_calculate_pair object
+     * Calculating [of_first_row_i] row of result matrix straight into
+     * preallocated row of result_matrix_
      */
-    multiplications_calculate_pair DefineMultiplicationCalculationSolution_(
-                                WhichMultiplicationCalculationSolution code);
+    void CalculateRow_(matrices_pair_ptr matrices_ptr,
+                        row_size_type of_first_row_i);
 
-    matrix_rows_unique_ptr CalculateRow_(
-                        matrices_pair_ptr matrices_ptr,
-                        row_size_type of_first_row_i,
-                        extra_multiplier_func extra_muliplier,
-                        WhichMultiplicationCalculationSolution type_row_code);
-
-    elements_type CalculateElement_(matrices_pair_ptr matrices_ptr,
-                    row_size_type of_first_row_i,
-                    column_size_type of_second_colum_i,
-                    extra_multiplier_func extra_muliplier,
-                    multiplicators_func multiplicators_calculation, 
-                    elements_type& first_matrix_multiplicator);
+    /**
+     * Replacing result_matrix_ with [rows_count]x[columns_count] matrix
+     */
+    void ResultMatrixDefaultInitialization_(row_size_type rows_count,
+                                        column_size_type columns_count);
 };
 
 class WinogradUsual : public WinogradParent{
@@ -134,79 +119,209 @@ public:
     WinogradUsual();
 
 private:
-    void RowsMultiplication_(matrices_pair_ptr matrices_ptr,
-                        extra_multiplier_func element_calculation);
+    void RowsMultiplication_(matrices_pair_ptr matrices_ptr);
 };
 
 class WinogradParallel : public WinogradParent{
 public:
-    using mutex_type    = std::recursive_mutex;
-
+    /**
+     * Rows of the result are calculated by up to [threads_count] threads
+     * of the shared pool
+     */
     WinogradParallel(size_t threads_count);
 
 private:
+    // Rows handed to a thread at a time are ROWS_PER_THREAD_BLOCKS times
+    // less than rows per thread, so faster threads can take over the tail
+    const row_size_type ROWS_PER_THREAD_BLOCKS = 8;
+
     size_t threads_count_;
-    mutex_type lock_;
+    // Size of the rows block claimed by a thread at once
+    row_size_type rows_block_;
+
+    void RowsMultiplication_(matrices_pair_ptr matrices_ptr);
+
+    /**
+     * Calculating rows [block_begin, block_end) of the result
+     */
+    void RowsBlockMultiplication_(matrices_pair_ptr matrices_ptr,
+                                row_size_type block_begin,
+                                row_size_type block_end);
+};
+
+class WinogradBlocked : public WinogradParent{
+public:
+    using blocking_type     = winograd::BlockingParams;
+    using packed_type       = winograd::PackedPanels;
+    using result_rows_type  = std::vector<elements_type*>;
+    using simd_level_type   = winograd::SimdLevel;
+
+    /**
+     * Cache-blocked multiplication over packed second matrix. Rows of
+     * the result are split between [threads_count] threads, tile sizes
+     * are taken from [blocking] (by default from detected cache sizes),
+     * micro kernel uses [simd_level] instructions or the widest
+     * supported ones below it
+     */
+    explicit WinogradBlocked(size_t threads_count = 1,
+                            blocking_type blocking = blocking_type::Detect(),
+                            simd_level_type simd_level =
+                                winograd::DetectSimdLevel());
+
+    const blocking_type& Blocking() const;
+
+private:
+    size_t threads_count_;
+    blocking_type blocking_;
+    winograd::micro_kernel_type micro_kernel_;
+    // Second matrix packed into panels, reused between multiplications
+    packed_type packed_second_;
+    // Pointers to the rows of result_matrix_
+    result_rows_type result_rows_;
+
+    void RowsMultiplication_(matrices_pair_ptr matrices_ptr);
+
+    /**
+     * Calculating result rows [row_begin, row_end)
+     */
+    void RowsBlockMultiplication_(matrices_pair_ptr matrices_ptr,
+                                row_size_type row_begin,
+                                row_size_type row_end);
+};
 
-    void ResultMatrixDefaultInitialization_(row_size_type of_first_rows_count);
+class WinogradStrassen : public WinogradParent{
+public:
+    using blocking_type     = winograd::BlockingParams;
+    using simd_level_type   = winograd::SimdLevel;
+    using result_rows_type  = std::vector<elements_type*>;
 
-    void RowsMultiplication_(matrices_pair_ptr matrices_ptr,
-                        extra_multiplier_func element_calculation);
+    /**
+     * Strassen-Winograd recursion down to [cutoff] sized products which
+     * are calculated by the blocked kernel with [blocking] tiles and
+     * [simd_level] instructions. Seven top level sub-products are spread
+     * between [threads_count] threads
+     */
+    explicit WinogradStrassen(
+                size_t threads_count = 1,
+                row_size_type cutoff = winograd::STRASSEN_DEFAULT_CUTOFF,
+                blocking_type blocking = blocking_type::Detect(),
+                simd_level_type simd_level = winograd::DetectSimdLevel());
+
+private:
+    winograd::StrassenMultiplier multiplier_;
+    // Pointers to the rows of result_matrix_
+    result_rows_type result_rows_;
 
-    void RowsParallelism_(matrices_pair_ptr matrices_ptr,
-                    extra_multiplier_func extra_muliplier);
+    /**
+     * Nothing to calculate: the multiplier finds factors of every
+     * sub-product itself
+     */
+    void CalculateFactors_(matrices_pair_ptr matrices_ptr);
+
+    void RowsMultiplication_(matrices_pair_ptr matrices_ptr);
 };
 
 class WinograPipelineParallel : public WinogradParent{
 public:
-    WinograPipelineParallel();
+    using ring_stats_type   = RingStats;
+
+    // Counters of one pipeline stage after the last multiplication
+    struct StageStats{
+        std::string role;
+        // Rows blocks processed by the stage
+        size_t blocks;
+        // Times the stage waited for input
+        size_t input_stalls;
+        // Times the stage waited for room in the next queue
+        size_t output_stalls;
+        // Average count of blocks in the stage input queue(s)
+        double input_occupancy;
+    };
+
+    using stats_type        = std::vector<StageStats>;
+
+    /**
+     * Pipeline of a factor stage (rows' factors of a rows block),
+     * [compute_stages] row-block compute stages and a write-back stage
+     * connected by bounded queues of [queue_capacity] blocks of
+     * [rows_block] rows. If a stage can't be created, rows are
+     * calculated by one thread
+     */
+    explicit WinograPipelineParallel(size_t compute_stages = 2,
+                                    row_size_type rows_block = 8,
+                                    size_t queue_capacity = 4);
+
+    /**
+     * @return stats of every stage in pipeline order
+     */
+    const stats_type& Stats() const;
 
 private:
-    struct Stage{
-        Stage() = default;
-        Stage(const Stage&) = delete;
-        Stage(Stage&& st) = default;
-        ~Stage() = default;
-
-        Stage& operator=(const Stage&) = delete;
-        Stage& operator=(Stage&&) = default;
-
-        std::queue<row_size_type> rows;
-        std::thread thread;
-        int id;
+    // Rows block travelling through the pipeline
+    struct Block{
+        row_size_type row_begin;
+        row_size_type row_end;
+        // Index of the block buffer holding calculated rows
+        size_t buffer_i;
+    };
+
+    // Stages are released when all of them are created or cancelled if
+    // creating one fails
+    enum class StartState{
+        WAITING,
+        STARTED,
+        CANCELLED
     };
 
-    const row_size_type MAX_STAGES = 4;
-    // Count of finished rows in result matrix
-    row_size_type rows_done_;
-    // Value to make threads wait for signal
-    std::condition_variable cv_;
-    // Stages
-    std::vector<Stage> stages_;
-    // Stages mutex
-    std::vector<std::mutex> stages_mutexes_;
-    // Start stages' threads muteces
-    std::vector<std::mutex> start_mutexes_;
-    // Multiplicators for columns
-    std::vector<double> multiplicators_b_;
-    // Mutex for columns' multiplicators
-    std::mutex multiplicators_b_mutex_;
-
-    void RowsMultiplication_(
-        matrices_pair_ptr matrices_ptr,
-        extra_multiplier_func extra_muliplier
-    );
-
-    // Fill result mtrx with default values
-    void InitResultMtrx_(matrices_pair_ptr matrices_ptr);
-    // Fill field multiplicators_b_ with NANs
-    void InitMultiplicators_(matrices_pair_ptr matrices_ptr);
-    // Return lambda function to run in thread
-    std::function<void ()> GetThreadBody_(
-        Stage& stage,
-        row_size_type max_stage,
-        matrices_pair_ptr matrices_ptr
-    );
+    using ring_type         = SpscRing<Block>;
+    using ring_ptr_type     = std::unique_ptr<ring_type>;
+    using buffer_type       = winograd::PackedPanels::storage_type;
+
+    size_t compute_stages_;
+    row_size_type rows_block_;
+    // Free block buffers: write-back stage -> factor stage
+    ring_ptr_type free_buffers_;
+    // Factor stage -> compute stage i
+    std::vector<ring_ptr_type> compute_inputs_;
+    // Compute stage i -> write-back stage
+    std::vector<ring_ptr_type> compute_outputs_;
+    // Block buffers of rows_block_ x result columns each
+    buffer_type buffers_;
+    size_t buffer_size_;
+    std::vector<size_t> compute_blocks_;
+    stats_type stats_;
+
+    /**
+     * Calculating column factors only, row factors are left
+     * to the factor stage
+     */
+    void CalculateFactors_(matrices_pair_ptr matrices_ptr);
+
+    void RowsMultiplication_(matrices_pair_ptr matrices_ptr);
+
+    /**
+     * Calculating row factors of every rows block and dealing the blocks
+     * round-robin to compute stages
+     */
+    void FactorStage_(matrices_pair_ptr matrices_ptr);
+
+    /**
+     * Calculating rows of blocks from [stage_i] input into block buffers
+     */
+    void ComputeStage_(matrices_pair_ptr matrices_ptr, size_t stage_i);
+
+    /**
+     * Copying calculated blocks into result_matrix_ in rows order and
+     * recycling their buffers
+     */
+    void WriteBackStage_(matrices_pair_ptr matrices_ptr);
+
+    void CollectStats_();
+
+    /**
+     * Skinny multiplication doesn't use the pipeline, so stats are cleared
+     */
+    void SkinnyMultiplication_(matrices_pair_ptr matrices_ptr);
 };
 
 }
@@ -0,0 +1,51 @@
+#ifndef WINOGRAD_BATCHED_H
+#define WINOGRAD_BATCHED_H
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "winograd_kernel.h"
+#include "../../../utils/includes/utils.h"
+#include "../../../utils/includes/thread_pool.h"
+
+namespace s21::winograd{
+
+/**
+ * [count] row-major [rows]x[columns] matrices in one array: element
+ * (i, j) of matrix m is data[m * stride + i * ld + j]
+ */
+template < class T >
+struct BatchView{
+    T* data;
+    size_type count;
+    size_type rows;
+    size_type columns;
+    // Distance between beginnings of neighbouring rows
+    size_type ld;
+    // Distance between beginnings of neighbouring matrices
+    size_type stride;
+
+    T* Matrix(size_type matrix_i) const { return data + matrix_i * stride; }
+};
+
+using const_batch_type  = BatchView<const elements_type>;
+using batch_type        = BatchView<elements_type>;
+
+// Matrices claimed by a thread at once
+constexpr size_type BATCH_CHUNK = 16;
+
+/**
+ * Calculating result[m] = first[m] x second[m] for every m of the batch
+ * by [threads_count] threads. Square batches of 8, 16, 24, 32, 48 and 64
+ * use kernels with compile-time sizes
+ * @return false if batches' sizes don't match
+ */
+bool MultiplyBatch(const_batch_type first,
+                    const_batch_type second,
+                    batch_type result,
+                    size_t threads_count = 1);
+
+}
+
+#endif
@@ -0,0 +1,106 @@
+#ifndef WINOGRAD_BLOCKED_H
+#define WINOGRAD_BLOCKED_H
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "winograd_kernel.h"
+#include "winograd_simd.h"
+#include "../../../utils/includes/utils.h"
+#include "../../../matrix/includes/matrix_storage.h"
+
+namespace s21::winograd{
+
+/**
+ * Tile sizes of the blocked multiplication. Inner dimension is counted
+ * in pairs of elements since Winograd method consumes them by two
+ */
+struct BlockingParams{
+    // Rows of the first matrix calculated against one L2-resident block
+    size_type rows_block;
+    // Columns of the second matrix in one outer (L3) block
+    size_type columns_block;
+    // Pairs of the inner dimension in one L1-resident panel slice
+    size_type pairs_block;
+
+    /**
+     * Calculating tile sizes so that a panel slice takes half of L1,
+     * a block of the first matrix rows takes half of L2 and
+     * a block of the packed second matrix takes half of L3
+     */
+    static BlockingParams FromCacheSizes(const CacheSizes& sizes);
+
+    /**
+     * FromCacheSizes for the caches of the current CPU
+     */
+    static BlockingParams Detect();
+
+    /**
+     * @return copy with zero sizes replaced by 1 and columns_block and
+     * rows_block rounded up to PANEL_WIDTH and MICRO_ROWS
+     */
+    BlockingParams Normalized() const;
+};
+
+/**
+ * Second matrix packed into PANEL_WIDTH-column panels (i.e. transposed
+ * by panels). Every panel keeps for each pair p of the inner dimension
+ * PANEL_WIDTH elements of row 2p+1 followed by PANEL_WIDTH elements
+ * of row 2p, the last panel is padded with zeros
+ */
+struct PackedPanels{
+    using storage_type  = std::vector<elements_type,
+                                    AlignedAllocator<elements_type>>;
+
+    storage_type data;
+    // Last row of the second matrix if its rows count is odd
+    factors_type odd_row;
+    size_type inner_size = 0;
+    size_type columns = 0;
+    size_type pairs = 0;
+
+    /**
+     * @return beginning of [panel_i] panel
+     */
+    const elements_type* Panel(size_type panel_i) const{
+        return data.data() + panel_i * pairs * 2 * PANEL_WIDTH;
+    }
+};
+
+/**
+ * Packing [second] matrix into [packed]. Storage of [packed] is reused
+ * when it is large enough
+ */
+void PackSecondMatrix(const Matrix<elements_type>& second,
+                    PackedPanels& packed);
+
+/**
+ * PackSecondMatrix for [rows]x[columns] matrix stored in [second]
+ * with [ld] leading dimension
+ */
+void PackSecondMatrix(const elements_type* second, size_type rows,
+                    size_type columns, size_type ld,
+                    PackedPanels& packed);
+
+/**
+ * Calculating rows [row_begin, row_end) of [first]x[second] product with
+ * [first] stored with [first_ld] leading dimension and [second] packed
+ * into [packed] by [kernel]. Result rows are written through
+ * [result_rows] pointers, their previous content is overwritten
+ */
+void MultiplyBlocked(const elements_type* first,
+                    size_type first_ld,
+                    const PackedPanels& packed,
+                    const BlockingParams& blocking,
+                    const factors_type& row_factors,
+                    const factors_type& column_factors,
+                    size_type row_begin,
+                    size_type row_end,
+                    elements_type* const* result_rows,
+                    micro_kernel_type kernel = GetMicroKernel(
+                                                    DetectSimdLevel()));
+
+}
+
+#endif
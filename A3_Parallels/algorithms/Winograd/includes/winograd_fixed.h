@@ -0,0 +1,58 @@
+#ifndef WINOGRAD_FIXED_H
+#define WINOGRAD_FIXED_H
+
+#include <cstddef>
+#include <utility>
+
+#include "../../../matrix/includes/matrix_fixed.h"
+
+namespace s21::winograd{
+
+/**
+ * Winograd multiplication of fixed-size matrices. Inner dimension loops
+ * are unrolled at compile time, the whole product can be calculated in
+ * a constant expression. Summation order is the same as in RowKernel,
+ * so results equal the runtime ones
+ */
+template < class T, std::size_t Rows, std::size_t Inner,
+            std::size_t Columns >
+struct FixedWinograd{
+    using first_type    = Matrix<T, Rows, Inner>;
+    using second_type   = Matrix<T, Inner, Columns>;
+    using result_type   = Matrix<T, Rows, Columns>;
+    using pairs_type    = std::make_index_sequence<Inner / 2>;
+
+    static constexpr result_type Multiply(const first_type& first,
+                                        const second_type& second);
+
+private:
+    template < std::size_t... Pairs >
+    static constexpr T RowFactor_(const first_type& first, std::size_t row,
+                                std::index_sequence<Pairs...>);
+
+    template < std::size_t... Pairs >
+    static constexpr T ColumnFactor_(const second_type& second,
+                                    std::size_t column,
+                                    std::index_sequence<Pairs...>);
+
+    template < std::size_t... Pairs >
+    static constexpr T PairsSum_(const first_type& first,
+                                const second_type& second,
+                                std::size_t row, std::size_t column,
+                                std::index_sequence<Pairs...>);
+};
+
+/**
+ * @return [first]x[second] calculated by FixedWinograd
+ */
+template < class T, std::size_t Rows, std::size_t Inner,
+            std::size_t Columns >
+constexpr Matrix<T, Rows, Columns> MultiplyFixed(
+                                    const Matrix<T, Rows, Inner>& first,
+                                    const Matrix<T, Inner, Columns>& second);
+
+}
+
+#include "../srcs/winograd_fixed_impl.h"
+
+#endif
@@ -0,0 +1,125 @@
+#ifndef WINOGRAD_GEMM_H
+#define WINOGRAD_GEMM_H
+
+#include <algorithm>
+#include <functional>
+#include <atomic>
+#include <vector>
+#include <thread>
+
+#include "winograd_kernel.h"
+#include "winograd_blocked.h"
+#include "../../../utils/includes/utils.h"
+#include "../../../utils/includes/thread_pool.h"
+#include "../../../matrix/includes/matrix.h"
+
+namespace s21{
+
+/**
+ * GEMM on Winograd kernels: result = alpha * op(first) * op(second) +
+ * beta * result, where op() is either identity or transposition.
+ * Result rows are split into blocks claimed by [threads_count] tasks of
+ * the shared pool as in WinogradParallel. Every block is multiplied into
+ * a thread-local buffer and merged into result at once, so no full size
+ * temporary matrix is created. Buffers are kept between calls
+ */
+class WinogradGemm{
+public:
+    using elements_type     = double;
+    using matrix_type       = Matrix<elements_type>;
+    using row_size_type     = typename matrix_type::row_size_type;
+    using column_size_type  = typename matrix_type::column_size_type;
+    using blocking_type     = winograd::BlockingParams;
+    using simd_level_type   = winograd::SimdLevel;
+    using storage_type      = winograd::PackedPanels::storage_type;
+
+    enum class Operation{
+        NORMAL,
+        TRANSPOSED
+    };
+
+    explicit WinogradGemm(size_t threads_count = 1,
+                        blocking_type blocking = blocking_type::Detect(),
+                        simd_level_type simd_level =
+                            winograd::DetectSimdLevel());
+
+    /**
+     * Calculating [result] = [alpha] * op([first]) * op([second]) +
+     * [beta] * [result] in place. When [beta] is zero previous content
+     * of [result] is ignored (NaN and infinity included)
+     * @return false (and leaves [result] untouched) if sizes of
+     * op([first]), op([second]) and [result] don't match
+     * @return false (and leaves [result] partly updated) if a thread fails
+     */
+    bool Multiply(elements_type alpha,
+                const matrix_type& first, Operation first_operation,
+                const matrix_type& second, Operation second_operation,
+                elements_type beta,
+                matrix_type& result);
+
+    /**
+     * Multiply with both operations NORMAL
+     */
+    bool Multiply(elements_type alpha, const matrix_type& first,
+                const matrix_type& second, elements_type beta,
+                matrix_type& result);
+
+private:
+    // Rows handed to a thread at a time are ROWS_PER_THREAD_BLOCKS times
+    // less than rows per thread, so faster threads can take over the tail
+    static constexpr row_size_type ROWS_PER_THREAD_BLOCKS = 8;
+
+    // Product rows of one block before merging into result
+    struct ThreadBuffer{
+        storage_type data;
+        std::vector<elements_type*> rows;
+    };
+
+    size_t threads_count_;
+    blocking_type blocking_;
+    winograd::micro_kernel_type kernel_;
+    // op(first) if it is transposed
+    storage_type first_transposed_;
+    // op(second) if it is transposed
+    storage_type second_transposed_;
+    winograd::PackedPanels packed_second_;
+    winograd::factors_type row_factors_;
+    winograd::factors_type column_factors_;
+    std::vector<ThreadBuffer> buffers_;
+
+    // State of the current multiplication
+    const elements_type* first_;
+    column_size_type first_ld_;
+    elements_type alpha_;
+    elements_type beta_;
+    matrix_type* result_;
+    row_size_type rows_block_;
+    std::atomic<row_size_type> next_row_;
+
+    /**
+     * Copying transposed [rows]x[columns] [matrix] into [transposed]
+     */
+    static void Transpose_(const matrix_type& matrix,
+                            storage_type& transposed);
+
+    /**
+     * result = beta * result when the product is zero
+     */
+    void ScaleResult_(matrix_type& result, elements_type beta);
+
+    /**
+     * Task body: claiming rows blocks from next_row_ and calculating
+     * them with [buffer]
+     */
+    void RowsParallelism_(ThreadBuffer& buffer);
+
+    /**
+     * Merging [buffer] product of [row_begin, row_end) rows into result_
+     */
+    void MergeBlock_(const ThreadBuffer& buffer, row_size_type row_begin,
+                    row_size_type row_end);
+};
+
+}
+
+#endif
@@ -0,0 +1,82 @@
+#ifndef WINOGRAD_KERNEL_H
+#define WINOGRAD_KERNEL_H
+
+#include <cstddef>
+#include <vector>
+
+#include "../../../matrix/includes/matrix.h"
+
+namespace s21::winograd{
+
+using elements_type     = double;
+using size_type         = std::size_t;
+using factors_type      = std::vector<elements_type>;
+
+/**
+ * Calculating Winograd factors a[i][0]*a[i][1] + a[i][2]*a[i][3] + ...
+ * for every row of [matrix] into [factors]
+ */
+void CalculateRowFactors(const Matrix<elements_type>& matrix,
+                        factors_type& factors);
+
+/**
+ * Calculating Winograd factors b[0][j]*b[1][j] + b[2][j]*b[3][j] + ...
+ * for every column of [matrix] into [factors]
+ */
+void CalculateColumnFactors(const Matrix<elements_type>& matrix,
+                            factors_type& factors);
+
+/**
+ * CalculateRowFactors for [rows]x[columns] matrix stored in [matrix]
+ * with [ld] leading dimension
+ */
+void CalculateRowFactors(const elements_type* matrix, size_type rows,
+                        size_type columns, size_type ld,
+                        factors_type& factors);
+
+/**
+ * CalculateColumnFactors for [rows]x[columns] matrix stored in [matrix]
+ * with [ld] leading dimension
+ */
+void CalculateColumnFactors(const elements_type* matrix, size_type rows,
+                            size_type columns, size_type ld,
+                            factors_type& factors);
+
+/**
+ * Inner loop of Winograd multiplication for one row of the result.
+ * [OddInnerSize] is true when the common dimension of the matrices is odd
+ * and the last product a[i][n-1]*b[n-1][j] has to be added separately
+ */
+template < bool OddInnerSize >
+struct RowKernel{
+    /**
+     * Calculating [columns] elements of [result_row] for [first_row] of
+     * the first matrix and [second] matrix with [second_ld] leading
+     * dimension. [inner_size] is the common dimension of the matrices
+     */
+    static void Calculate(const elements_type* first_row,
+                        const elements_type* second,
+                        size_type second_ld,
+                        size_type inner_size,
+                        size_type columns,
+                        elements_type row_factor,
+                        const elements_type* column_factors,
+                        elements_type* result_row);
+};
+
+/**
+ * Calculating [row_i] row of [first]x[second] product into [result_row]
+ * using precalculated [row_factors] and [column_factors]
+ */
+void CalculateRow(const Matrix<elements_type>& first,
+                const Matrix<elements_type>& second,
+                size_type row_i,
+                const factors_type& row_factors,
+                const factors_type& column_factors,
+                elements_type* result_row);
+
+}
+
+#include "../srcs/winograd_kernel_impl.h"
+
+#endif
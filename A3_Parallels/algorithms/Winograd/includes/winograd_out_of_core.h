@@ -0,0 +1,143 @@
+#ifndef WINOGRAD_OUT_OF_CORE_H
+#define WINOGRAD_OUT_OF_CORE_H
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <string>
+#include <vector>
+#include <thread>
+
+#include "winograd_kernel.h"
+#include "winograd_blocked.h"
+#include "../../../utils/includes/utils.h"
+#include "../../../utils/includes/thread_pool.h"
+#include "../../../utils/includes/spsc_ring.h"
+#include "../../../matrix/includes/matrix_file.h"
+
+namespace s21{
+
+/**
+ * Multiplication of binary matrix files (see matrix_file.h) which don't
+ * fit into memory. Operands are mapped and split into square tiles: a
+ * loader thread copies the next tiles of the first matrix and packs tiles
+ * of the second one while the caller's thread multiplies the current ones
+ * by the blocked Winograd kernel. Finished result tiles are written
+ * straight into the mapped result file. Memory use is about
+ * 2 * (prefetch_depth + 1) tiles
+ */
+class WinogradOutOfCore{
+public:
+    using elements_type     = double;
+    using size_type         = MappedMatrixFile::size_type;
+    using blocking_type     = winograd::BlockingParams;
+    using simd_level_type   = winograd::SimdLevel;
+
+    static constexpr size_type DEFAULT_TILE_SIZE = 2048;
+
+    // Counters of the last multiplication
+    struct Stats{
+        // Tile products calculated
+        size_t tiles;
+        // Times the multiplication waited for the loader
+        size_t compute_stalls;
+        // Times the loader waited for a free tile buffer
+        size_t loader_stalls;
+    };
+
+    /**
+     * Multiplier of [tile_size] tiles (rounded up to PANEL_WIDTH) with
+     * up to [prefetch_depth] tiles loaded ahead. Rows of every tile
+     * product are split between [threads_count] threads
+     */
+    explicit WinogradOutOfCore(size_type tile_size = DEFAULT_TILE_SIZE,
+                            size_t threads_count = 1,
+                            size_t prefetch_depth = 2,
+                            blocking_type blocking = blocking_type::Detect(),
+                            simd_level_type simd_level =
+                                winograd::DetectSimdLevel());
+    WinogradOutOfCore(const WinogradOutOfCore&) = delete;
+
+    WinogradOutOfCore& operator=(const WinogradOutOfCore&) = delete;
+
+    /**
+     * Writing [first_filename] x [second_filename] product into
+     * [result_filename] (replaced if exists). All files keep doubles
+     * @return false if files can't be opened, aren't double matrices,
+     * their sizes don't match or a thread fails
+     */
+    bool Multiply(const std::string& first_filename,
+                const std::string& second_filename,
+                const std::string& result_filename);
+
+    const Stats& LastStats() const;
+
+private:
+    using storage_type      = winograd::PackedPanels::storage_type;
+    using ring_type         = SpscRing<size_t>;
+
+    // One loaded step: tile of the first matrix and packed tile of
+    // the second one
+    struct TileSlot{
+        storage_type first;
+        winograd::PackedPanels packed;
+        winograd::factors_type row_factors;
+        winograd::factors_type column_factors;
+        size_type row_begin;
+        size_type row_end;
+        size_type column_begin;
+        size_type column_end;
+        size_type inner_begin;
+        size_type inner_end;
+    };
+
+    size_type tile_size_;
+    size_t threads_count_;
+    blocking_type blocking_;
+    winograd::micro_kernel_type kernel_;
+    std::vector<TileSlot> slots_;
+    // Loaded slots: loader -> multiplication
+    ring_type loaded_;
+    // Free slots: multiplication -> loader
+    ring_type free_;
+    // Result tile being accumulated and product of the current step
+    storage_type accumulator_;
+    storage_type product_;
+    std::vector<elements_type*> result_rows_;
+    Stats stats_;
+    // Exception stopped the loader, rethrown by Multiply() after joining
+    std::exception_ptr load_error_;
+
+    /**
+     * Loader thread body: loading every step of [first]x[second] into
+     * free slots in the multiplication order. An exception stops loading
+     * and is kept in load_error_, loaded_ is closed anyway
+     */
+    void Load_(const MappedMatrixFile& first,
+                const MappedMatrixFile& second);
+
+    /**
+     * Copying the tile of [first] and packing the tile of [second] of
+     * [slot] bounds
+     */
+    void LoadSlot_(const MappedMatrixFile& first,
+                    const MappedMatrixFile& second, TileSlot& slot);
+
+    /**
+     * Multiplying tiles of [slot] into result_rows_ by threads_count_
+     * threads
+     * @throw the exception of a failed thread, the product is left
+     * unfinished
+     */
+    void MultiplySlot_(const TileSlot& slot);
+
+    /**
+     * Consuming loaded slots of [inner] common dimension and writing
+     * result tiles into [result]
+     */
+    void Compute_(size_type inner, MappedMatrixFile& result);
+};
+
+}
+
+#endif
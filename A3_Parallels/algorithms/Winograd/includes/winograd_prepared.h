@@ -0,0 +1,111 @@
+#ifndef WINOGRAD_PREPARED_H
+#define WINOGRAD_PREPARED_H
+
+#include <condition_variable>
+#include <vector>
+#include <thread>
+#include <mutex>
+
+#include "winograd_kernel.h"
+#include "winograd_blocked.h"
+#include "../../../utils/includes/utils.h"
+#include "../../../matrix/includes/matrix.h"
+
+namespace s21{
+
+/**
+ * Winograd multiplication by one prepared second matrix. Preparing
+ * calculates its column factors and packs it into panels once, then
+ * every Multiply calculates only row factors of the first matrix and
+ * writes the product into caller's matrix. Buffers and worker threads
+ * are kept between calls, so repeated multiplications of up to the same
+ * rows count don't allocate heap memory
+ */
+class WinogradPrepared{
+public:
+    using elements_type     = double;
+    using matrix_type       = Matrix<elements_type>;
+    using row_size_type     = typename matrix_type::row_size_type;
+    using column_size_type  = typename matrix_type::column_size_type;
+    using blocking_type     = winograd::BlockingParams;
+    using simd_level_type   = winograd::SimdLevel;
+
+    /**
+     * Heap buffers kept between multiplications: the same pointers and
+     * capacities after a call mean it hasn't allocated them again
+     */
+    struct Buffers{
+        const elements_type* row_factors;
+        size_t row_factors_capacity;
+        elements_type* const* result_rows;
+        size_t result_rows_capacity;
+    };
+
+    /**
+     * Multiplier splitting rows of the first matrix between
+     * [threads_count] threads (caller's thread included)
+     */
+    explicit WinogradPrepared(size_t threads_count = 1,
+                            blocking_type blocking = blocking_type::Detect(),
+                            simd_level_type simd_level =
+                                winograd::DetectSimdLevel());
+    WinogradPrepared(const WinogradPrepared&) = delete;
+    ~WinogradPrepared();
+
+    WinogradPrepared& operator=(const WinogradPrepared&) = delete;
+
+    /**
+     * Preparing [second] for following multiplications. [second] isn't
+     * referenced after return
+     * @return false if [second] is empty
+     */
+    bool Prepare(const matrix_type& second);
+
+    /**
+     * Calculating [first] x prepared matrix into [result] of
+     * [first] rows x prepared columns size
+     * @return false (and leaves [result] untouched) if nothing is prepared
+     * or sizes don't match
+     */
+    bool Multiply(const matrix_type& first, matrix_type& result);
+
+    bool IsPrepared() const;
+    row_size_type PreparedRowsSize() const;
+    column_size_type PreparedColumnsSize() const;
+    Buffers KeptBuffers() const;
+
+private:
+    blocking_type blocking_;
+    winograd::micro_kernel_type kernel_;
+    winograd::PackedPanels packed_second_;
+    winograd::factors_type column_factors_;
+    winograd::factors_type row_factors_;
+    std::vector<elements_type*> result_rows_;
+    bool is_prepared_;
+
+    // Workers' state of the current multiplication
+    const matrix_type* first_;
+    row_size_type rows_per_worker_;
+    threads_array_type workers_;
+    std::mutex mutex_;
+    std::condition_variable start_cv_;
+    std::condition_variable done_cv_;
+    size_t generation_;
+    size_t workers_busy_;
+    bool is_stopped_;
+
+    /**
+     * Worker thread body: calculating [part_i] part of rows for every
+     * new multiplication until is_stopped_
+     */
+    void Worker_(size_t part_i);
+
+    /**
+     * Calculating [part_i] part of rows of the current multiplication
+     */
+    void CalculatePart_(size_t part_i);
+};
+
+}
+
+#endif
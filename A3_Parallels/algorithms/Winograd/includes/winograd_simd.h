@@ -0,0 +1,66 @@
+#ifndef WINOGRAD_SIMD_H
+#define WINOGRAD_SIMD_H
+
+#include <string>
+
+#include "winograd_kernel.h"
+
+namespace s21::winograd{
+
+// Columns of the second matrix in one packed panel
+constexpr size_type PANEL_WIDTH = 8;
+// Rows of the first matrix calculated by one micro kernel call
+constexpr size_type MICRO_ROWS = 4;
+
+/**
+ * Instruction sets of the blocked micro kernel. SSE2 kernel rounds
+ * exactly like the scalar one. AVX2 and AVX-512 kernels use FMA, so every
+ * pair product is rounded once instead of twice and the result may differ
+ * from the scalar one by up to inner_size * DBL_EPSILON * sum of absolute
+ * values of pair products (SIMD_RELATIVE_TOLERANCE relative to that sum
+ * for inner sizes up to 4096). Integer matrices with sums below 2^53
+ * are multiplied exactly by every kernel
+ */
+enum class SimdLevel{
+    SCALAR,
+    SSE2,
+    AVX2,
+    AVX512
+};
+
+constexpr elements_type SIMD_RELATIVE_TOLERANCE = 1e-12;
+
+/**
+ * Accumulating [pairs] pair products of MICRO_ROWS rows [first_rows]
+ * (already shifted to the first pair) and [panel] into MICRO_ROWS x
+ * PANEL_WIDTH tile given by [tile_rows] pointers to its rows, which
+ * need no alignment
+ */
+using micro_kernel_type = void (*)(size_type pairs,
+                                    const elements_type* const* first_rows,
+                                    const elements_type* panel,
+                                    elements_type* const* tile_rows);
+
+/**
+ * @return the widest instruction set supported by the CPU
+ */
+SimdLevel DetectSimdLevel();
+
+/**
+ * @return true if CPU can run kernel of [level]
+ */
+bool IsSimdLevelSupported(SimdLevel level);
+
+/**
+ * @return kernel of [level], or of the widest supported level below it
+ */
+micro_kernel_type GetMicroKernel(SimdLevel level);
+
+/**
+ * @return printable name of [level]
+ */
+std::string SimdLevelName(SimdLevel level);
+
+}
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef WINOGRAD_SKINNY_H
+#define WINOGRAD_SKINNY_H
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "winograd_kernel.h"
+#include "winograd_simd.h"
+#include "winograd_blocked.h"
+#include "../../../matrix/includes/matrix.h"
+
+namespace s21::winograd{
+
+// Second matrices with up to SKINNY_MAX_COLUMNS columns are multiplied
+// by the skinny kernels (matrix-vector products included)
+constexpr size_type SKINNY_MAX_COLUMNS = 4;
+// Elements of the first matrix streamed by one thread at least
+constexpr size_type SKINNY_ELEMENTS_PER_THREAD = size_type(1) << 16;
+
+/**
+ * Columns of a skinny second matrix stored contiguously with elements
+ * swapped in pairs: column j keeps b[1][j], b[0][j], b[3][j], b[2][j], ...
+ * So a row of the first matrix plus a stored column gives both factors
+ * of every Winograd pair product next to each other
+ */
+struct SkinnyColumns{
+    PackedPanels::storage_type data;
+    // Winograd factors of the columns
+    factors_type factors;
+    // Last row of the second matrix if its rows count is odd
+    factors_type odd_row;
+    size_type inner_size = 0;
+    size_type columns = 0;
+    size_type pairs = 0;
+
+    const elements_type* Column(size_type column_i) const{
+        return data.data() + column_i * pairs * 2;
+    }
+};
+
+/**
+ * Calculating [columns] elements of [result_row] for [first_row] of the
+ * first matrix and [packed] second matrix. Row factor is calculated in
+ * the same pass, so the first matrix is read only once
+ */
+using skinny_kernel_type = void (*)(const elements_type* first_row,
+                                    const SkinnyColumns& packed,
+                                    elements_type* result_row);
+
+/**
+ * Packing [second] matrix of up to SKINNY_MAX_COLUMNS columns into
+ * [packed] and calculating its column factors. Storage of [packed] is
+ * reused when it is large enough
+ */
+void PackSkinnyMatrix(const Matrix<elements_type>& second,
+                    SkinnyColumns& packed);
+
+/**
+ * @return kernel for [columns] columns of [level] instructions or of the
+ * widest supported level below it. Scalar and SSE2 kernels round exactly
+ * like RowKernel, AVX2 and AVX-512 ones sum pair products in a different
+ * order and with FMA, see SIMD_RELATIVE_TOLERANCE
+ */
+skinny_kernel_type GetSkinnyKernel(SimdLevel level, size_type columns);
+
+/**
+ * Calculating rows [row_begin, row_end) of [first]x[packed] product with
+ * [first] stored with [first_ld] leading dimension by [kernel]
+ */
+void MultiplySkinny(const elements_type* first,
+                    size_type first_ld,
+                    const SkinnyColumns& packed,
+                    size_type row_begin,
+                    size_type row_end,
+                    elements_type* const* result_rows,
+                    skinny_kernel_type kernel);
+
+}
+
+#endif
@@ -0,0 +1,125 @@
+#ifndef WINOGRAD_STRASSEN_H
+#define WINOGRAD_STRASSEN_H
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "winograd_blocked.h"
+#include "../../../utils/includes/thread_pool.h"
+
+namespace s21::winograd{
+
+// Sub-products of one Strassen-Winograd recursion step
+constexpr size_type STRASSEN_PRODUCTS = 7;
+// Recursion stops when any dimension of a sub-product is not above it
+constexpr size_type STRASSEN_DEFAULT_CUTOFF = 512;
+constexpr size_type STRASSEN_MAX_LEVELS = 16;
+
+/**
+ * Strassen-Winograd recursion: 7 half-sized products and 15 additions
+ * per level. Dimensions are padded with zeros to multiples of 2^levels,
+ * products below the cutoff are calculated by the blocked kernel.
+ * Sub-products of the top level run in parallel. All temporary matrices
+ * live in one workspace which is kept between multiplications
+ */
+class StrassenMultiplier{
+public:
+    using workspace_type    = PackedPanels::storage_type;
+    using result_rows_type  = std::vector<elements_type*>;
+
+    StrassenMultiplier(size_type cutoff, size_t threads_count,
+                        const BlockingParams& blocking,
+                        micro_kernel_type kernel);
+
+    /**
+     * Calculating [first]x[second] into [result_rows]
+     */
+    void Multiply(const Matrix<elements_type>& first,
+                const Matrix<elements_type>& second,
+                elements_type* const* result_rows);
+
+    /**
+     * @return recursion depth which would be used for [rows]x[inner] by
+     * [inner]x[columns] product
+     */
+    size_type Levels(size_type rows, size_type inner,
+                    size_type columns) const;
+
+private:
+    // Buffers of the blocked kernel reused by leaves of one task
+    struct LeafScratch{
+        PackedPanels packed;
+        factors_type row_factors;
+        factors_type column_factors;
+        result_rows_type result_rows;
+    };
+
+    struct ConstView{
+        const elements_type* data;
+        size_type ld;
+
+        ConstView Block(size_type row, size_type column) const{
+            return ConstView{data + row * ld + column, ld};
+        }
+    };
+
+    struct View{
+        elements_type* data;
+        size_type ld;
+
+        View Block(size_type row, size_type column) const{
+            return View{data + row * ld + column, ld};
+        }
+        operator ConstView() const { return ConstView{data, ld}; }
+    };
+
+    size_type cutoff_;
+    size_t threads_count_;
+    BlockingParams blocking_;
+    micro_kernel_type kernel_;
+    size_type levels_;
+    // Temporaries of every recursion level followed by padded operands
+    workspace_type workspace_;
+    std::vector<LeafScratch> scratches_;
+
+    /**
+     * @return workspace elements needed by a [level] node multiplying
+     * [rows]x[inner] by [inner]x[columns]
+     */
+    size_type WorkspaceSize_(size_type level, size_type rows,
+                            size_type inner, size_type columns) const;
+
+    /**
+     * Calculating c = a x b of [rows]x[inner] by [inner]x[columns] on
+     * [level] of the recursion using [workspace] for temporaries
+     */
+    void Recurse_(size_type level, size_type rows, size_type inner,
+                size_type columns, ConstView a, ConstView b, View c,
+                elements_type* workspace, LeafScratch& scratch);
+
+    /**
+     * Multiplying by the blocked kernel
+     */
+    void Leaf_(size_type rows, size_type inner, size_type columns,
+                ConstView a, ConstView b, View c, LeafScratch& scratch);
+
+    /**
+     * Copying [rows]x[columns] [source] into [destination] of
+     * [padded_rows]x[padded_columns] with zero padding
+     */
+    static void CopyPadded_(size_type rows, size_type columns,
+                            ConstView source, size_type padded_rows,
+                            size_type padded_columns, View destination);
+
+    /**
+     * c = a + b ([Sign] = 1) or c = a - b ([Sign] = -1)
+     */
+    template < int Sign >
+    static void Combine_(size_type rows, size_type columns,
+                        ConstView a, ConstView b, View c);
+};
+
+}
+
+#endif
@@ -2,19 +2,31 @@
 
 namespace s21{
 
-WinogradParent::WinogradParent() { }
+WinogradParent::WinogradParent(size_t skinny_threads_count,
+                                simd_level_type simd_level)
+                            : skinny_threads_count_(
+                                skinny_threads_count ? skinny_threads_count : 1
+                            ),
+                                simd_level_(simd_level) { }
 
 WinogradParent::result_matrix_type WinogradParent::WinogradMultiplication(
                                     matrix_type_const_ref matrix_first,
                                     matrix_type_const_ref matrix_second){
-    if(!IsMatricesInvalid_(
+    if(IsMatricesInvalid_(
         matrix_first.ColumnsSize(), matrix_second.RowsSize()
     )){
-        matrices_pair matrices{matrix_first, matrix_second};
+        // Result of the previous multiplication must not leak out
+        result_matrix_.matrix_array.clear();
+        return result_matrix_;
+    }
+
+    matrices_pair matrices{matrix_first, matrix_second};
 
+    if (matrix_second.ColumnsSize() <= winograd::SKINNY_MAX_COLUMNS){
+        SkinnyMultiplication_(&matrices);
+    } else {
         StartMultiplication_(&matrices);
     }
-
     return result_matrix_;
 }
 
@@ -43,484 +55,449 @@ bool WinogradParent::IsMatricesInvalid_(
 }
 
 void WinogradParent::StartMultiplication_(matrices_pair_ptr matrices_ptr){
-    extra_multiplier_func extra_muliplier;
-
-    extra_muliplier = MatrixMultiplication_(matrices_ptr);
-    RowsMultiplication_(
-        matrices_ptr,
-        extra_muliplier
+    CalculateFactors_(matrices_ptr);
+    ResultMatrixDefaultInitialization_(
+        matrices_ptr->first.RowsSize(),
+        matrices_ptr->second.ColumnsSize()
     );
+    RowsMultiplication_(matrices_ptr);
 }
 
-WinogradParent::extra_multiplier_func WinogradParent::MatrixMultiplication_(
-                                                matrices_pair_ptr matrices_ptr){
-    extra_multiplier_func extra_muliplier;
-
-    if (matrices_ptr->first.ColumnsSize() % 2){
-        extra_muliplier =
-            [matrices_ptr]
-            (row_size_type of_first_row_i, column_size_type of_second_column_i)
-            -> elements_type {
-                elements_type returned_multiplicator;
-
-                returned_multiplicator =
-                    matrices_ptr->first[of_first_row_i].back() *
-                    matrices_ptr->second.Back()[of_second_column_i];
-                return returned_multiplicator;
-            };
-    } else {
-        extra_muliplier =
-            [](row_size_type, column_size_type) -> elements_type { return 0; };
-    }
-    return extra_muliplier;
+void WinogradParent::CalculateFactors_(matrices_pair_ptr matrices_ptr){
+    winograd::CalculateRowFactors(matrices_ptr->first, row_factors_);
+    winograd::CalculateColumnFactors(matrices_ptr->second, column_factors_);
 }
 
+void WinogradParent::SkinnyMultiplication_(matrices_pair_ptr matrices_ptr){
+    const matrix_type& first = matrices_ptr->first;
+    const row_size_type rows_count = first.RowsSize();
+    const winograd::skinny_kernel_type kernel = winograd::GetSkinnyKernel(
+        simd_level_,
+        matrices_ptr->second.ColumnsSize()
+    );
+    std::vector<elements_type*> result_rows(rows_count);
 
-WinogradParent::multiplicators_func WinogradParent::DefineMultiplicatorsFunc_(
-                                        WhitchMultiplicatorsCalculate code,
-                                        matrices_pair_ptr matrices_ptr){
-    multiplicators_func return_func;
-
-    switch (code){
-        // For first element in row & all rows exclude first:
-        // - first_matrix_multiplicator wasn't calculated
-        // - all second_matrix multiplications were calculated
-        case WhitchMultiplicatorsCalculate::FIRST:
-            return_func =
-                [matrices_ptr](
-                    elements_type first_matrix_multiplicator,
-                    multiplicators_arrray_reference,
-                    row_size_type row_i,
-                    column_size_type column_i,
-                    column_size_type
-                ) -> elements_type {
-                    first_matrix_multiplicator +=
-                        matrices_ptr->first[row_i][column_i] *
-                        matrices_ptr->first[row_i][column_i + 1];
-                    return first_matrix_multiplicator;
-                };
-            break;
-
-        // For first element in row & first row:
-        // - first_matrix_multiplicator wasn't calculated
-        // - second_matrix multiplications weren't calculated
-        case WhitchMultiplicatorsCalculate::FIRST_SECOND:
-            return_func =
-                [matrices_ptr](
-                    elements_type first_matrix_multiplicator,
-                    multiplicators_arrray_reference of_second_multiplicators,
-                    row_size_type row_i,
-                    column_size_type column_i,
-                    column_size_type of_second_column_i
-                ) -> elements_type {
-                    first_matrix_multiplicator +=
-                        matrices_ptr->first[row_i][column_i] *
-                        matrices_ptr->first[row_i][column_i + 1];
-
-                    of_second_multiplicators[of_second_column_i] +=
-                        matrices_ptr->second[column_i][of_second_column_i] *
-                        matrices_ptr->second[column_i + 1][of_second_column_i];
-                    return first_matrix_multiplicator;
-                };
-            break;
-
-        // For all elements exclude first & first row:
-        // - first_matrix_multiplicator was calculated
-        // - second_matrix multiplications weren't calculated
-        case WhitchMultiplicatorsCalculate::SECOND:
-            return_func =
-                [matrices_ptr](
-                    elements_type first_matrix_multiplicator,
-                    multiplicators_arrray_reference of_second_multiplicators,
-                    row_size_type,
-                    column_size_type column_i,
-                    column_size_type of_second_column_i
-                ) -> elements_type {
-                    of_second_multiplicators[of_second_column_i] +=
-                        matrices_ptr->second[column_i][of_second_column_i] *
-                        matrices_ptr->second[column_i + 1][of_second_column_i];
-                return first_matrix_multiplicator;
-                };
-            break;
-
-        // For all elements exclude first & all rows exclude first:
-        // - first_matrix_multiplicator was calculated
-        // - second_matrix multiplications were calculated
-        case WhitchMultiplicatorsCalculate::NO_ONE:
-            return_func =
-                [matrices_ptr](
-                    elements_type first_matrix_multiplicator,
-                    multiplicators_arrray_reference,
-                    row_size_type,
-                    column_size_type,
-                    column_size_type
-                ) -> elements_type {
-                    (void) matrices_ptr;
-                    return first_matrix_multiplicator;
-                };
-            break;
+    winograd::PackSkinnyMatrix(matrices_ptr->second, skinny_second_);
+    ResultMatrixDefaultInitialization_(
+        rows_count,
+        matrices_ptr->second.ColumnsSize()
+    );
+    for (row_size_type row_i = 0; row_i < rows_count; row_i++){
+        result_rows[row_i] = result_matrix_.matrix_array[row_i].data();
     }
-    return return_func;
-}
 
-WinogradParent::multiplications_calculate_pair
-    WinogradParent::DefineMultiplicationCalculationSolution_(
-                                WhichMultiplicationCalculationSolution code){
-    multiplications_calculate_pair return_pair;
-
-    switch(code){
-        case WhichMultiplicationCalculationSolution::FOR_FIRST_ELEM:
-            if (second_matrix_multiplicators_.empty()){
-                return_pair.first = WhitchMultiplicatorsCalculate::FIRST_SECOND;
-                return_pair.second = WhitchMultiplicatorsCalculate::SECOND;
-            } else {
-                return_pair.first = WhitchMultiplicatorsCalculate::FIRST;
-                return_pair.second = WhitchMultiplicatorsCalculate::NO_ONE;
-            }
-            break;
-        case WhichMultiplicationCalculationSolution::FOR_NEXT_ELEMS:
-            return_pair.first = WhitchMultiplicatorsCalculate::FIRST;
-            return_pair.second = WhitchMultiplicatorsCalculate::NO_ONE;
-            break;
+    // Threads pay off only when every one streams enough of the first matrix
+    const size_t threads_count = std::min<size_t>(
+        skinny_threads_count_,
+        rows_count * first.ColumnsSize() /
+            winograd::SKINNY_ELEMENTS_PER_THREAD
+    );
+    if (threads_count <= 1){
+        winograd::MultiplySkinny(first.Data(), first.LeadingDimension(),
+                                skinny_second_, 0, rows_count,
+                                result_rows.data(), kernel);
+        return;
     }
-    return return_pair;
-}
-
 
-WinogradParent::matrix_rows_unique_ptr
-    WinogradParent::CalculateRow_(matrices_pair_ptr matrices_ptr,
-                        row_size_type of_first_row_i,
-                        extra_multiplier_func extra_muliplier,
-                        WhichMultiplicationCalculationSolution type_row_code){
-    matrix_rows_unique_ptr result_row(new result_matrix_rows_type());
-    elements_type current_element_result;
-    multiplications_calculate_pair execute_codes;
-    multiplicators_func multiplicators_calculation;
-    elements_type first_matrix_multiplicator;
-
-    execute_codes = DefineMultiplicationCalculationSolution_(type_row_code);
-    first_matrix_multiplicator = 0;
-
-    //For first element
-    multiplicators_calculation = DefineMultiplicatorsFunc_(
-        execute_codes.first,
-        matrices_ptr
-    );
+    const row_size_type rows_per_thread = (rows_count + threads_count - 1) /
+                                            threads_count;
+    try{
+        ThreadPool::Instance().ParallelFor(
+            0, rows_count,
+            [&](row_size_type row_begin, row_size_type row_end){
+                winograd::MultiplySkinny(first.Data(),
+                                        first.LeadingDimension(),
+                                        skinny_second_, row_begin, row_end,
+                                        result_rows.data(), kernel);
+            },
+            rows_per_thread,
+            threads_count
+        );
+    } catch(const std::exception &e){
+        std::string error = "Threads problems: ";
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__, error + e.what());
+    }
+}
 
-    current_element_result = CalculateElement_(
-        matrices_ptr,
+void WinogradParent::CalculateRow_(matrices_pair_ptr matrices_ptr,
+                                    row_size_type of_first_row_i){
+    winograd::CalculateRow(
+        matrices_ptr->first,
+        matrices_ptr->second,
         of_first_row_i,
-        0,
-        extra_muliplier,
-        multiplicators_calculation,
-        first_matrix_multiplicator
+        row_factors_,
+        column_factors_,
+        result_matrix_.matrix_array[of_first_row_i].data()
     );
-    result_row->push_back(current_element_result);
+}
 
-    //For next elements
-    multiplicators_calculation = DefineMultiplicatorsFunc_(
-        execute_codes.second,
-        matrices_ptr
+void WinogradParent::ResultMatrixDefaultInitialization_(
+                                            row_size_type rows_count,
+                                            column_size_type columns_count){
+    result_matrix_.matrix_array.assign(
+        rows_count,
+        result_matrix_rows_type(columns_count)
     );
+}
 
-    for(column_size_type of_second_column_i = 1;
-        of_second_column_i < matrices_ptr->second.ColumnsSize();
-        of_second_column_i++
-    ){
-        current_element_result = CalculateElement_(
-            matrices_ptr,
-            of_first_row_i,
-            of_second_column_i,
-            extra_muliplier,
-            multiplicators_calculation,
-            first_matrix_multiplicator
-        );
-        result_row->push_back(current_element_result);
 
-    }
-    first_matrix_multiplicator = 0;
-    return result_row;
-}
+WinogradUsual::WinogradUsual() : WinogradParent() { }
 
-WinogradParent::elements_type
-    WinogradParent::CalculateElement_(matrices_pair_ptr matrices_ptr,
-                    row_size_type of_first_row_i,
-                    column_size_type of_second_column_i,
-                    extra_multiplier_func extra_muliplier,
-                    multiplicators_func multiplicators_calculation,
-                    elements_type& first_matrix_multiplicator){
-    elements_type element_result;
-
-    element_result = 0;
-    for(column_size_type of_first_column_i = 0;
-            of_first_column_i < matrices_ptr->first.ColumnsSize() - 1;
-            of_first_column_i += 2
+void WinogradUsual::RowsMultiplication_(matrices_pair_ptr matrices_ptr){
+    for(row_size_type of_first_row_i = 0;
+        of_first_row_i < matrices_ptr->first.RowsSize();
+        of_first_row_i++
     ){
-        element_result +=
-            (matrices_ptr->first[of_first_row_i][of_first_column_i] +
-            matrices_ptr->second[of_first_column_i + 1][of_second_column_i]) *
-            (matrices_ptr->first[of_first_row_i][of_first_column_i + 1] +
-            matrices_ptr->second[of_first_column_i][of_second_column_i]);
-
-        first_matrix_multiplicator = multiplicators_calculation(
-            first_matrix_multiplicator,
-            second_matrix_multiplicators_,
-            of_first_row_i,
-            of_first_column_i,
-            of_second_column_i
-        );
+        CalculateRow_(matrices_ptr, of_first_row_i);
     }
-    element_result += extra_muliplier(of_first_row_i, of_second_column_i);
-    element_result -=
-        first_matrix_multiplicator +
-        second_matrix_multiplicators_[of_second_column_i];
-    return element_result;
 }
 
 
-WinogradUsual::WinogradUsual() : WinogradParent() { }
-
-void WinogradUsual::RowsMultiplication_(matrices_pair_ptr matrices_ptr,
-                                    extra_multiplier_func extra_muliplier){
+WinogradParallel::WinogradParallel(size_t threads_count)
+                            : WinogradParent(threads_count),
+                                threads_count_(threads_count ? threads_count : 1),
+                                rows_block_(1) { }
 
-    matrix_rows_unique_ptr current_result_row;
+void WinogradParallel::RowsMultiplication_(matrices_pair_ptr matrices_ptr){
+    row_size_type of_first_rows_count;
 
-    // For first row
-    current_result_row = CalculateRow_(
-        matrices_ptr,
-        0,
-        extra_muliplier,
-        WhichMultiplicationCalculationSolution::FOR_FIRST_ELEM
+    of_first_rows_count = matrices_ptr->first.RowsSize();
+    rows_block_ = std::max<row_size_type>(
+        1,
+        of_first_rows_count / (threads_count_ * ROWS_PER_THREAD_BLOCKS)
     );
-    result_matrix_.matrix_array.push_back(*current_result_row);
+    try{
+        ThreadPool::Instance().ParallelFor(
+            0, of_first_rows_count,
+            [this, matrices_ptr](row_size_type block_begin,
+                                row_size_type block_end){
+                RowsBlockMultiplication_(matrices_ptr, block_begin,
+                                        block_end);
+            },
+            rows_block_,
+            threads_count_
+        );
+    } catch(const std::exception &e){
+        std::string error = "Threads problems: ";
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__, error + e.what());
+    }
+}
 
-    // For next rows
-    for(row_size_type of_first_row_i = 1;
-        of_first_row_i < matrices_ptr->first.RowsSize();
+void WinogradParallel::RowsBlockMultiplication_(matrices_pair_ptr matrices_ptr,
+                                            row_size_type block_begin,
+                                            row_size_type block_end){
+    for(row_size_type of_first_row_i = block_begin;
+        of_first_row_i < block_end;
         of_first_row_i++
     ){
-        current_result_row = CalculateRow_(
-            matrices_ptr,
-            of_first_row_i,
-            extra_muliplier,
-            WhichMultiplicationCalculationSolution::FOR_NEXT_ELEMS);
-        result_matrix_.matrix_array.push_back(*current_result_row);
+        CalculateRow_(matrices_ptr, of_first_row_i);
     }
 }
 
 
-WinogradParallel::WinogradParallel(size_t threads_count)
-                            : WinogradParent(), threads_count_(threads_count){ }
+WinogradBlocked::WinogradBlocked(size_t threads_count,
+                                blocking_type blocking,
+                                simd_level_type simd_level)
+                            : WinogradParent(threads_count, simd_level),
+                                threads_count_(threads_count ? threads_count : 1),
+                                blocking_(blocking.Normalized()),
+                                micro_kernel_(winograd::GetMicroKernel(
+                                    simd_level
+                                )) { }
 
-void WinogradParallel::ResultMatrixDefaultInitialization_(
-                                            row_size_type of_first_rows_count){
-    for(row_size_type i = 0; i < of_first_rows_count; i++){
-        result_matrix_.matrix_array.push_back(result_matrix_rows_type());
-    }
+const WinogradBlocked::blocking_type& WinogradBlocked::Blocking() const{
+    return blocking_;
 }
 
-void WinogradParallel::RowsMultiplication_(matrices_pair_ptr matrices_ptr,
-                                    extra_multiplier_func extra_muliplier){
-
-    matrix_rows_unique_ptr current_result_row;
-    row_size_type of_first_rows_count;
-
-    of_first_rows_count = matrices_ptr->first.RowsSize();
-    ResultMatrixDefaultInitialization_(matrices_ptr->first.RowsSize());
+void WinogradBlocked::RowsMultiplication_(matrices_pair_ptr matrices_ptr){
+    row_size_type of_first_rows_count = matrices_ptr->first.RowsSize();
+    row_size_type rows_per_thread;
 
-    // For first row
-    current_result_row = CalculateRow_(
-        matrices_ptr,
-        0,
-        extra_muliplier,
-        WhichMultiplicationCalculationSolution::FOR_FIRST_ELEM);
-    result_matrix_.matrix_array[0] = std::move(*current_result_row);
+    winograd::PackSecondMatrix(matrices_ptr->second, packed_second_);
+    result_rows_.resize(of_first_rows_count);
+    for (row_size_type row_i = 0; row_i < of_first_rows_count; row_i++){
+        result_rows_[row_i] = result_matrix_.matrix_array[row_i].data();
+    }
 
-    // For next rows
+    // Threads get whole rows blocks so that the second matrix blocks
+    // are reused by as many rows as possible
+    rows_per_thread = (of_first_rows_count + threads_count_ - 1) /
+                        threads_count_;
+    rows_per_thread = (rows_per_thread + winograd::MICRO_ROWS - 1) /
+                        winograd::MICRO_ROWS * winograd::MICRO_ROWS;
     try{
-        threads_array_type threads_array;
-
-        for(size_t thread_i = 0;
-            of_first_rows_count > 1 &&
-            thread_i < threads_count_;
-            thread_i++
-        ){
-            threads_array.push_back(std::thread(
-                &WinogradParallel::RowsParallelism_,
-                this,
-                matrices_ptr,
-                extra_muliplier
-            ));
-        }
-        JoinThreads(threads_array);
+        ThreadPool::Instance().ParallelFor(
+            0, of_first_rows_count,
+            [this, matrices_ptr](row_size_type row_begin,
+                                row_size_type row_end){
+                RowsBlockMultiplication_(matrices_ptr, row_begin, row_end);
+            },
+            rows_per_thread,
+            threads_count_
+        );
     } catch(const std::exception &e){
         std::string error = "Threads problems: ";
         PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__, error + e.what());
     }
 }
 
-void WinogradParallel::RowsParallelism_(matrices_pair_ptr matrices_ptr,
-                                    extra_multiplier_func extra_muliplier){
-    matrix_rows_unique_ptr current_result_row;
-
-    for(row_size_type of_first_row_i = 1;
-            of_first_row_i < matrices_ptr->first.RowsSize();
-            of_first_row_i++
-        ){
-            std::lock_guard<mutex_type> locker(lock_);
-            if (result_matrix_.matrix_array[of_first_row_i].empty()){
-                current_result_row = CalculateRow_(
-                    matrices_ptr,
-                    of_first_row_i,
-                    extra_muliplier,
-                    WhichMultiplicationCalculationSolution::FOR_NEXT_ELEMS
-                );
-                result_matrix_.matrix_array[of_first_row_i] =
-                                            std::move(*current_result_row);
-            }
-        }
+void WinogradBlocked::RowsBlockMultiplication_(matrices_pair_ptr matrices_ptr,
+                                            row_size_type row_begin,
+                                            row_size_type row_end){
+    winograd::MultiplyBlocked(
+        matrices_ptr->first.Data(),
+        matrices_ptr->first.LeadingDimension(),
+        packed_second_,
+        blocking_,
+        row_factors_,
+        column_factors_,
+        row_begin,
+        row_end,
+        result_rows_.data(),
+        micro_kernel_
+    );
 }
 
 
-WinograPipelineParallel::WinograPipelineParallel() : WinogradParent() { }
+WinogradStrassen::WinogradStrassen(size_t threads_count,
+                                    row_size_type cutoff,
+                                    blocking_type blocking,
+                                    simd_level_type simd_level)
+                            : WinogradParent(threads_count, simd_level),
+                                multiplier_(
+                                    cutoff,
+                                    threads_count,
+                                    blocking,
+                                    winograd::GetMicroKernel(simd_level)
+                                ) { }
 
-void WinograPipelineParallel::RowsMultiplication_(
-                                        matrices_pair_ptr matrices_ptr,
-                                        extra_multiplier_func){
-    InitResultMtrx_(matrices_ptr);
-    InitMultiplicators_(matrices_ptr);
-
-    row_size_type rows_count = matrices_ptr->first.RowsSize();
-    row_size_type stages_count = std::min(rows_count, MAX_STAGES);
-
-    rows_done_ = 0;
-    stages_.reserve(stages_count);
-    
-    std::vector<std::mutex> m1(stages_count);
-    std::vector<std::mutex> m2(stages_count);
-    start_mutexes_ = std::move(m1);
-    stages_mutexes_ = std::move(m2);
-   
-    int next_id = 0;
-    for (row_size_type row = 0; row < stages_count; row++){
-        Stage s;
-        stages_.push_back(std::move(s));
-        
-        Stage& stage = stages_.back();
-        stage.id = next_id++;
-
-        std::thread th = std::thread(
-            GetThreadBody_(stages_.back(), stages_count, matrices_ptr)
-        );
-        stage.thread = std::move(th);
-    }
+void WinogradStrassen::CalculateFactors_(matrices_pair_ptr){ }
 
-    stages_[0].rows.push(0);
-    for (Stage& stage : stages_){
-        stage.thread.join();
+void WinogradStrassen::RowsMultiplication_(matrices_pair_ptr matrices_ptr){
+    row_size_type of_first_rows_count = matrices_ptr->first.RowsSize();
+
+    result_rows_.resize(of_first_rows_count);
+    for (row_size_type row_i = 0; row_i < of_first_rows_count; row_i++){
+        result_rows_[row_i] = result_matrix_.matrix_array[row_i].data();
     }
+    multiplier_.Multiply(
+        matrices_ptr->first,
+        matrices_ptr->second,
+        result_rows_.data()
+    );
 }
 
-void WinograPipelineParallel::InitResultMtrx_(matrices_pair_ptr matrices_ptr){
-    row_size_type rows_count = matrices_ptr->first.RowsSize();
-    column_size_type columns_count = matrices_ptr->second.ColumnsSize();
 
-    result_matrix_.matrix_array.reserve(rows_count);
-    for (row_size_type i = 0; i < rows_count; i++){
-        result_matrix_type::rows_type new_row(columns_count);
-        result_matrix_.matrix_array.push_back(std::move(new_row));
+WinograPipelineParallel::WinograPipelineParallel(size_t compute_stages,
+                                                row_size_type rows_block,
+                                                size_t queue_capacity)
+                            : WinogradParent(compute_stages),
+                                compute_stages_(compute_stages ? compute_stages : 1),
+                                rows_block_(rows_block ? rows_block : 1),
+                                buffer_size_(0) {
+    queue_capacity = queue_capacity ? queue_capacity : 1;
+    for (size_t stage_i = 0; stage_i < compute_stages_; stage_i++){
+        compute_inputs_.push_back(
+            std::make_unique<ring_type>(queue_capacity)
+        );
+        compute_outputs_.push_back(
+            std::make_unique<ring_type>(queue_capacity)
+        );
     }
+    // Enough buffers for every queue slot and every stage at work, so
+    // the factor stage waits for free buffers only if write-back lags
+    free_buffers_ = std::make_unique<ring_type>(
+        compute_stages_ * (2 * queue_capacity + 1) + 1
+    );
 }
 
-void WinograPipelineParallel::InitMultiplicators_(
-    matrices_pair_ptr matrices_ptr
-){
-    column_size_type columns_count = matrices_ptr->second.ColumnsSize();
+const WinograPipelineParallel::stats_type&
+                            WinograPipelineParallel::Stats() const{
+    return stats_;
+}
 
-    std::vector<double> mb(
-        columns_count, 
-        std::numeric_limits<double>::quiet_NaN()
-    );
-    multiplicators_b_ = std::move(mb);
+void WinograPipelineParallel::CalculateFactors_(
+                                        matrices_pair_ptr matrices_ptr){
+    // Row factors are calculated block by block by the factor stage
+    row_factors_.assign(matrices_ptr->first.RowsSize(), 0);
+    winograd::CalculateColumnFactors(matrices_ptr->second, column_factors_);
 }
 
-std::function<void ()> WinograPipelineParallel::GetThreadBody_(
-    Stage& stage,
-    row_size_type max_stage,
-    matrices_pair_ptr matrices_ptr
-){
-    return [this, &stage, max_stage, matrices_ptr](){
-        matrix_type_const_ref A = matrices_ptr->first;
-        matrix_type_const_ref B = matrices_ptr->second;
-        row_size_type max_rows = A.RowsSize();
-
-        while (true){
-            while (true) {
-                if (this->rows_done_ == max_rows || !stage.rows.empty()) {
-                    break;
-                }
-                usleep(500);
-            }
+void WinograPipelineParallel::RowsMultiplication_(
+                                        matrices_pair_ptr matrices_ptr){
+    const size_t buffers_count = free_buffers_->Capacity();
+
+    buffer_size_ = rows_block_ * matrices_ptr->second.ColumnsSize();
+    buffers_.resize(buffers_count * buffer_size_);
+    compute_blocks_.assign(compute_stages_, 0);
+    free_buffers_->Reset();
+    for (size_t stage_i = 0; stage_i < compute_stages_; stage_i++){
+        compute_inputs_[stage_i]->Reset();
+        compute_outputs_[stage_i]->Reset();
+    }
+    for (size_t buffer_i = 0; buffer_i < buffers_count; buffer_i++){
+        free_buffers_->Push(Block{0, 0, buffer_i});
+    }
 
-            // Get next row number
-            if (this->rows_done_ == max_rows) break;
-            this->stages_mutexes_[stage.id].lock();
-            row_size_type row = stage.rows.front();
-            stage.rows.pop();
-            this->stages_mutexes_[stage.id].unlock();
-        
-            // Create row's multiplicator
-            double multi_a = 0;
-            for (column_size_type col = 0; col + 1 < A.ColumnsSize(); col += 2){
-                multi_a += A[row][col] * A[row][col + 1];
+    threads_array_type threads_array;
+    // Stages wait for all of them to be created: without one of them
+    // the others would wait on its queues forever
+    std::atomic<StartState> start_state(StartState::WAITING);
+    auto start_stage = [&](auto stage){
+        threads_array.push_back(std::thread([&start_state, stage](){
+            StartState state;
+
+            while((state = start_state.load(std::memory_order_acquire)) ==
+                    StartState::WAITING){
+                std::this_thread::yield();
             }
+            if(state == StartState::STARTED) stage();
+        }));
+    };
 
-            // Calculate row of result mtrx
-            for (column_size_type col = 0; col < B.ColumnsSize(); col++){
-                double multi_b = multiplicators_b_[col];
-                // Create column's multiplicator
-                if (std::isnan(multi_b)){
-                    multi_b = 0;
-                    for (row_size_type i = 0; i + 1 < B.RowsSize(); i += 2){
-                        multi_b += B[i][col] * B[i + 1][col];
-                    }
-                    std::lock_guard guard(this->multiplicators_b_mutex_);
-                    this->multiplicators_b_[col] = multi_b;
-                }
-                        
-                // Continue row calculation
-                double res = 0;
-                column_size_type columns_count = A.ColumnsSize();
-                for (column_size_type i = 0; i < columns_count; i++){
-                    if (i + 1 < columns_count) {
-                        res += (A[row][i] + B[i + 1][col]) *
-                                (A[row][i + 1] + B[i][col]);
-                        i++;
-                    } else {
-                        res += A[row][i] * B[i][col];
-                    }
-                }
-                res -= multi_a + multi_b;
-                this->result_matrix_.matrix_array[row][col] = res;
-            
-                // Let next thread start
-                if (col == 0 && row + 1 != A.RowsSize()){
-                    row_size_type next_row = row + 1;
-                    int next_stage_id = 
-                        (stage.id + 1 == static_cast<int>(max_stage)) ?
-                        0 :
-                        stage.id + 1;
-
-                    // Update row next stage to work with
-                    this->stages_mutexes_[next_stage_id].lock();
-                    this->stages_[next_stage_id].rows.push(next_row);
-                    this->stages_mutexes_[next_stage_id].unlock();
-                }
+    try{
+        threads_array.reserve(compute_stages_ + 2);
+        start_stage([this, matrices_ptr](){ FactorStage_(matrices_ptr); });
+        for (size_t stage_i = 0; stage_i < compute_stages_; stage_i++){
+            start_stage([this, matrices_ptr, stage_i](){
+                ComputeStage_(matrices_ptr, stage_i);
+            });
+        }
+        start_stage([this, matrices_ptr](){ WriteBackStage_(matrices_ptr); });
+    } catch(const std::exception &e){
+        std::string error = "Threads problems: ";
+
+        start_state.store(StartState::CANCELLED, std::memory_order_release);
+        JoinThreads(threads_array);
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__, error + e.what());
+        // No block has entered the pipeline yet
+        winograd::CalculateRowFactors(matrices_ptr->first, row_factors_);
+        for (row_size_type row_i = 0; row_i < matrices_ptr->first.RowsSize();
+                row_i++){
+            CalculateRow_(matrices_ptr, row_i);
+        }
+        stats_.clear();
+        return;
+    }
+    start_state.store(StartState::STARTED, std::memory_order_release);
+    JoinThreads(threads_array);
+    CollectStats_();
+}
+
+void WinograPipelineParallel::FactorStage_(matrices_pair_ptr matrices_ptr){
+    const matrix_type& first = matrices_ptr->first;
+    const row_size_type inner_size = first.ColumnsSize();
+    size_t block_i = 0;
+
+    for (row_size_type row_begin = 0; row_begin < first.RowsSize();
+            row_begin += rows_block_, block_i++){
+        Block block;
+
+        free_buffers_->Pop(block);
+        block.row_begin = row_begin;
+        block.row_end = std::min(row_begin + rows_block_, first.RowsSize());
+        for (row_size_type row_i = block.row_begin; row_i < block.row_end;
+                row_i++){
+            const elements_type* row = first[row_i].data();
+            elements_type factor = 0;
+
+            for (row_size_type k = 0; k + 1 < inner_size; k += 2){
+                factor += row[k] * row[k + 1];
             }
-            
-            this->rows_done_++;
+            row_factors_[row_i] = factor;
         }
-    };
+        compute_inputs_[block_i % compute_stages_]->Push(block);
+    }
+    for (ring_ptr_type& ring : compute_inputs_) ring->Close();
+}
+
+void WinograPipelineParallel::ComputeStage_(matrices_pair_ptr matrices_ptr,
+                                            size_t stage_i){
+    const column_size_type columns = matrices_ptr->second.ColumnsSize();
+    Block block;
+
+    while (compute_inputs_[stage_i]->Pop(block)){
+        elements_type* buffer = buffers_.data() +
+                                block.buffer_i * buffer_size_;
+
+        for (row_size_type row_i = block.row_begin; row_i < block.row_end;
+                row_i++){
+            winograd::CalculateRow(
+                matrices_ptr->first,
+                matrices_ptr->second,
+                row_i,
+                row_factors_,
+                column_factors_,
+                buffer + (row_i - block.row_begin) * columns
+            );
+        }
+        compute_blocks_[stage_i]++;
+        compute_outputs_[stage_i]->Push(block);
+    }
+    compute_outputs_[stage_i]->Close();
+}
+
+void WinograPipelineParallel::WriteBackStage_(
+                                        matrices_pair_ptr matrices_ptr){
+    const column_size_type columns = matrices_ptr->second.ColumnsSize();
+    Block block;
+
+    // Blocks were dealt round-robin, so taking them round-robin
+    // restores rows order
+    for (size_t block_i = 0;
+            compute_outputs_[block_i % compute_stages_]->Pop(block);
+            block_i++){
+        const elements_type* buffer = buffers_.data() +
+                                        block.buffer_i * buffer_size_;
+
+        for (row_size_type row_i = block.row_begin; row_i < block.row_end;
+                row_i++){
+            const elements_type* row = buffer +
+                                        (row_i - block.row_begin) * columns;
+
+            std::copy(row, row + columns,
+                        result_matrix_.matrix_array[row_i].begin());
+        }
+        free_buffers_->Push(block);
+    }
+}
+
+void WinograPipelineParallel::SkinnyMultiplication_(
+                                            matrices_pair_ptr matrices_ptr){
+    stats_.clear();
+    WinogradParent::SkinnyMultiplication_(matrices_ptr);
+}
+
+void WinograPipelineParallel::CollectStats_(){
+    StageStats factor_stats{"factors", 0, free_buffers_->Stats().pop_stalls,
+                            0, free_buffers_->Stats().AverageOccupancy()};
+    StageStats write_back_stats{"write-back", 0, 0,
+                                free_buffers_->Stats().push_stalls, 0};
+    size_t output_pushes = 0, output_occupancy = 0;
+
+    stats_.clear();
+    stats_.push_back(factor_stats);
+    for (size_t stage_i = 0; stage_i < compute_stages_; stage_i++){
+        const RingStats& input = compute_inputs_[stage_i]->Stats();
+        const RingStats& output = compute_outputs_[stage_i]->Stats();
+
+        stats_.front().blocks += input.pushes;
+        stats_.front().output_stalls += input.push_stalls;
+        stats_.push_back(StageStats{
+            "compute " + std::to_string(stage_i),
+            compute_blocks_[stage_i],
+            input.pop_stalls,
+            output.push_stalls,
+            input.AverageOccupancy()
+        });
+        write_back_stats.blocks += output.pushes;
+        write_back_stats.input_stalls += output.pop_stalls;
+        output_pushes += output.pushes;
+        output_occupancy += output.occupancy_sum;
+    }
+    write_back_stats.input_occupancy = output_pushes ?
+            static_cast<double>(output_occupancy) / output_pushes : 0;
+    stats_.push_back(write_back_stats);
 }
 
 }
@@ -0,0 +1,154 @@
+#include "../includes/winograd_batched.h"
+
+namespace s21::winograd{
+
+namespace {
+
+using batch_kernel_type = void (*)(const_batch_type first,
+                                    const_batch_type second,
+                                    batch_type result,
+                                    size_type matrix_begin,
+                                    size_type matrix_end);
+
+/**
+ * Winograd multiplication of [Size]x[Size] matrices with every loop
+ * bound known at compile time
+ */
+template < size_type Size >
+struct FixedKernel{
+    static void Multiply(const_batch_type first, const_batch_type second,
+                        batch_type result, size_type matrix_begin,
+                        size_type matrix_end){
+        elements_type column_factors[Size];
+
+        for (size_type m = matrix_begin; m < matrix_end; m++){
+            const elements_type* a = first.Matrix(m);
+            const elements_type* b = second.Matrix(m);
+            elements_type* c = result.Matrix(m);
+
+            std::fill(column_factors, column_factors + Size, 0);
+            for (size_type k = 0; k + 1 < Size; k += 2){
+                const elements_type* b_even = b + k * second.ld;
+                const elements_type* b_odd = b_even + second.ld;
+
+                for (size_type j = 0; j < Size; j++){
+                    column_factors[j] += b_even[j] * b_odd[j];
+                }
+            }
+
+            for (size_type i = 0; i < Size; i++){
+                const elements_type* a_row = a + i * first.ld;
+                elements_type* c_row = c + i * result.ld;
+                elements_type acc[Size] = {};
+                elements_type row_factor = 0;
+
+                for (size_type k = 0; k + 1 < Size; k += 2){
+                    const elements_type a_even = a_row[k];
+                    const elements_type a_odd = a_row[k + 1];
+                    const elements_type* b_even = b + k * second.ld;
+                    const elements_type* b_odd = b_even + second.ld;
+
+                    row_factor += a_even * a_odd;
+                    for (size_type j = 0; j < Size; j++){
+                        acc[j] += (a_even + b_odd[j]) * (a_odd + b_even[j]);
+                    }
+                }
+                for (size_type j = 0; j < Size; j++){
+                    c_row[j] = acc[j] - (row_factor + column_factors[j]);
+                }
+            }
+        }
+    }
+};
+
+/**
+ * Any sizes: factors and rows by the row kernel
+ */
+void GenericKernel(const_batch_type first, const_batch_type second,
+                    batch_type result, size_type matrix_begin,
+                    size_type matrix_end){
+    factors_type row_factors, column_factors;
+
+    for (size_type m = matrix_begin; m < matrix_end; m++){
+        const elements_type* a = first.Matrix(m);
+        const elements_type* b = second.Matrix(m);
+        elements_type* c = result.Matrix(m);
+
+        CalculateRowFactors(a, first.rows, first.columns, first.ld,
+                            row_factors);
+        CalculateColumnFactors(b, second.rows, second.columns, second.ld,
+                                column_factors);
+        for (size_type i = 0; i < first.rows; i++){
+            if (first.columns % 2){
+                RowKernel<true>::Calculate(
+                    a + i * first.ld, b, second.ld, first.columns,
+                    second.columns, row_factors[i], column_factors.data(),
+                    c + i * result.ld
+                );
+            } else {
+                RowKernel<false>::Calculate(
+                    a + i * first.ld, b, second.ld, first.columns,
+                    second.columns, row_factors[i], column_factors.data(),
+                    c + i * result.ld
+                );
+            }
+        }
+    }
+}
+
+/**
+ * @return FixedKernel of [size] if it is one of [Size, Rest...]
+ * or GenericKernel otherwise
+ */
+template < size_type Size, size_type... Rest >
+batch_kernel_type SelectFixedKernel(size_type size){
+    if (size == Size) return FixedKernel<Size>::Multiply;
+    if constexpr (sizeof...(Rest) > 0){
+        return SelectFixedKernel<Rest...>(size);
+    } else {
+        return GenericKernel;
+    }
+}
+
+}
+
+bool MultiplyBatch(const_batch_type first,
+                    const_batch_type second,
+                    batch_type result,
+                    size_t threads_count){
+    if (first.count != second.count || first.count != result.count ||
+            first.columns != second.rows || first.rows != result.rows ||
+            second.columns != result.columns){
+        PRINT_ERROR(
+            __FILE__, __FUNCTION__, __LINE__,
+            "Invalid batches: Counts or sizes of matrices don't match"
+        );
+        return false;
+    }
+    if (!first.count || !first.rows || !first.columns || !second.columns){
+        return true;
+    }
+
+    const bool is_square = first.rows == first.columns &&
+                            first.columns == second.columns;
+    const batch_kernel_type kernel = is_square ?
+                        SelectFixedKernel<8, 16, 24, 32, 48, 64>(first.rows) :
+                        GenericKernel;
+    try{
+        ThreadPool::Instance().ParallelFor(
+            0, first.count,
+            [&](size_type matrix_begin, size_type matrix_end){
+                kernel(first, second, result, matrix_begin, matrix_end);
+            },
+            BATCH_CHUNK,
+            threads_count ? threads_count : 1
+        );
+    } catch(const std::exception &e){
+        std::string error = "Threads problems: ";
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__, error + e.what());
+        return false;
+    }
+    return true;
+}
+
+}
@@ -0,0 +1,228 @@
+#include "../includes/winograd_blocked.h"
+
+namespace s21::winograd{
+
+namespace {
+
+constexpr size_type PAIR_BYTES = 2 * PANEL_WIDTH * sizeof(elements_type);
+
+size_type RoundUp(size_type value, size_type multiple){
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+size_type RoundDown(size_type value, size_type multiple){
+    return std::max(multiple, value / multiple * multiple);
+}
+
+/**
+ * Running [kernel] on [rows]x[columns] tile [result_rows]. Full tiles
+ * are accumulated in place, edge ones through aligned full-size copy:
+ * rows beyond [rows] repeat the last valid one in [first_rows] and are
+ * not stored, so kernels need no bounds checks
+ */
+void RunMicroKernel(micro_kernel_type kernel,
+                    size_type pairs,
+                    const elements_type* const* first_rows,
+                    const elements_type* panel,
+                    size_type rows,
+                    size_type columns,
+                    elements_type* const* result_rows){
+    if (rows == MICRO_ROWS && columns == PANEL_WIDTH){
+        kernel(pairs, first_rows, panel, result_rows);
+        return;
+    }
+
+    alignas(MATRIX_ALIGNMENT)
+        elements_type tile[MICRO_ROWS * PANEL_WIDTH] = {};
+    elements_type* tile_rows[MICRO_ROWS];
+
+    for (size_type r = 0; r < MICRO_ROWS; r++){
+        tile_rows[r] = tile + r * PANEL_WIDTH;
+    }
+    for (size_type r = 0; r < rows; r++){
+        std::copy(result_rows[r], result_rows[r] + columns, tile_rows[r]);
+    }
+    kernel(pairs, first_rows, panel, tile_rows);
+    for (size_type r = 0; r < rows; r++){
+        std::copy(tile_rows[r], tile_rows[r] + columns, result_rows[r]);
+    }
+}
+
+/**
+ * Adding the odd inner element product and subtracting factors for
+ * [row_begin, row_end) rows and [column_begin, column_end) columns
+ */
+void FinishBlock(const elements_type* first,
+                size_type first_ld,
+                const PackedPanels& packed,
+                const factors_type& row_factors,
+                const factors_type& column_factors,
+                size_type row_begin, size_type row_end,
+                size_type column_begin, size_type column_end,
+                elements_type* const* result_rows){
+    for (size_type i = row_begin; i < row_end; i++){
+        elements_type* result_row = result_rows[i];
+
+        if (packed.inner_size % 2){
+            const elements_type a_last = first[i * first_ld +
+                                                packed.inner_size - 1];
+
+            for (size_type j = column_begin; j < column_end; j++){
+                result_row[j] += a_last * packed.odd_row[j];
+            }
+        }
+        for (size_type j = column_begin; j < column_end; j++){
+            result_row[j] -= row_factors[i] + column_factors[j];
+        }
+    }
+}
+
+}
+
+BlockingParams BlockingParams::FromCacheSizes(const CacheSizes& sizes){
+    BlockingParams blocking;
+
+    blocking.pairs_block = std::clamp<size_type>(
+        sizes.l1_data / 2 / PAIR_BYTES, 16, 1024
+    );
+    blocking.rows_block = RoundDown(std::clamp<size_type>(
+        sizes.l2 / 2 / (2 * blocking.pairs_block * sizeof(elements_type)),
+        MICRO_ROWS, 4096
+    ), MICRO_ROWS);
+    blocking.columns_block = RoundDown(std::clamp<size_type>(
+        sizes.l3 / 2 / (2 * blocking.pairs_block * sizeof(elements_type)),
+        PANEL_WIDTH, 65536
+    ), PANEL_WIDTH);
+    return blocking;
+}
+
+BlockingParams BlockingParams::Detect(){
+    return FromCacheSizes(DetectCacheSizes());
+}
+
+BlockingParams BlockingParams::Normalized() const{
+    return BlockingParams{
+        RoundUp(std::max<size_type>(rows_block, 1), MICRO_ROWS),
+        RoundUp(std::max<size_type>(columns_block, 1), PANEL_WIDTH),
+        std::max<size_type>(pairs_block, 1)
+    };
+}
+
+void PackSecondMatrix(const Matrix<elements_type>& second,
+                    PackedPanels& packed){
+    PackSecondMatrix(second.Data(), second.RowsSize(), second.ColumnsSize(),
+                    second.LeadingDimension(), packed);
+}
+
+void PackSecondMatrix(const elements_type* second, size_type rows,
+                    size_type columns, size_type ld,
+                    PackedPanels& packed){
+    const size_type panels = (columns + PANEL_WIDTH - 1) / PANEL_WIDTH;
+
+    packed.inner_size = rows;
+    packed.columns = columns;
+    packed.pairs = packed.inner_size / 2;
+    packed.data.assign(panels * packed.pairs * 2 * PANEL_WIDTH, 0);
+
+    for (size_type panel_i = 0; panel_i < panels; panel_i++){
+        const size_type column_begin = panel_i * PANEL_WIDTH;
+        const size_type width = std::min(
+            PANEL_WIDTH,
+            packed.columns - column_begin
+        );
+        elements_type* panel = packed.data.data() +
+                                panel_i * packed.pairs * 2 * PANEL_WIDTH;
+
+        for (size_type p = 0; p < packed.pairs; p++){
+            const elements_type* b_even = second + 2 * p * ld +
+                                            column_begin;
+            const elements_type* b_odd = b_even + ld;
+
+            std::copy(b_odd, b_odd + width, panel);
+            std::copy(b_even, b_even + width, panel + PANEL_WIDTH);
+            panel += 2 * PANEL_WIDTH;
+        }
+    }
+
+    if (packed.inner_size % 2){
+        const elements_type* b_last = second + (rows - 1) * ld;
+
+        packed.odd_row.assign(b_last, b_last + packed.columns);
+    } else {
+        packed.odd_row.clear();
+    }
+}
+
+void MultiplyBlocked(const elements_type* first,
+                    size_type first_ld,
+                    const PackedPanels& packed,
+                    const BlockingParams& blocking,
+                    const factors_type& row_factors,
+                    const factors_type& column_factors,
+                    size_type row_begin,
+                    size_type row_end,
+                    elements_type* const* result_rows,
+                    micro_kernel_type kernel){
+    const BlockingParams tiles = blocking.Normalized();
+    const elements_type* first_rows[MICRO_ROWS];
+
+    for (size_type jc = 0; jc < packed.columns; jc += tiles.columns_block){
+        const size_type jc_end = std::min(
+            jc + tiles.columns_block,
+            packed.columns
+        );
+
+        for (size_type i = row_begin; i < row_end; i++){
+            std::fill(result_rows[i] + jc, result_rows[i] + jc_end, 0);
+        }
+
+        for (size_type pc = 0; pc < packed.pairs; pc += tiles.pairs_block){
+            const size_type pairs = std::min(
+                tiles.pairs_block,
+                packed.pairs - pc
+            );
+
+            for (size_type ic = row_begin; ic < row_end;
+                    ic += tiles.rows_block){
+                const size_type ic_end = std::min(
+                    ic + tiles.rows_block,
+                    row_end
+                );
+
+                for (size_type jr = jc; jr < jc_end; jr += PANEL_WIDTH){
+                    const elements_type* panel =
+                        packed.Panel(jr / PANEL_WIDTH) +
+                        pc * 2 * PANEL_WIDTH;
+                    const size_type columns = std::min(
+                        PANEL_WIDTH,
+                        jc_end - jr
+                    );
+                    elements_type* tile_rows[MICRO_ROWS];
+
+                    for (size_type ir = ic; ir < ic_end; ir += MICRO_ROWS){
+                        const size_type rows = std::min(
+                            MICRO_ROWS,
+                            ic_end - ir
+                        );
+
+                        for (size_type r = 0; r < MICRO_ROWS; r++){
+                            const size_type row_i = ir + std::min(r,
+                                                                rows - 1);
+
+                            first_rows[r] = first + row_i * first_ld +
+                                            2 * pc;
+                            tile_rows[r] = result_rows[row_i] + jr;
+                        }
+                        RunMicroKernel(kernel, pairs, first_rows, panel,
+                                        rows, columns, tile_rows);
+                    }
+                }
+            }
+        }
+
+        FinishBlock(first, first_ld, packed, row_factors, column_factors,
+                    row_begin, row_end, jc, jc_end, result_rows);
+    }
+}
+
+}
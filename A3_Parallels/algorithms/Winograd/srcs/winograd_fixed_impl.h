@@ -0,0 +1,79 @@
+#ifndef WINOGRAD_FIXED_H
+#error 'winograd_fixed_impl.h' is not supposed to be included directly. \
+        Include 'winograd_fixed.h' instead.
+#endif
+
+namespace s21::winograd{
+
+template < class T, std::size_t Rows, std::size_t Inner,
+            std::size_t Columns >
+constexpr typename FixedWinograd<T, Rows, Inner, Columns>::result_type
+            FixedWinograd<T, Rows, Inner, Columns>::Multiply(
+                                                const first_type& first,
+                                                const second_type& second){
+    T column_factors[Columns] = {};
+    result_type result;
+
+    for (std::size_t j = 0; j < Columns; j++){
+        column_factors[j] = ColumnFactor_(second, j, pairs_type());
+    }
+    for (std::size_t i = 0; i < Rows; i++){
+        const T row_factor = RowFactor_(first, i, pairs_type());
+
+        for (std::size_t j = 0; j < Columns; j++){
+            T element = PairsSum_(first, second, i, j, pairs_type());
+
+            if constexpr (Inner % 2 != 0){
+                element += first[i][Inner - 1] * second[Inner - 1][j];
+            }
+            result[i][j] = element - (row_factor + column_factors[j]);
+        }
+    }
+    return result;
+}
+
+template < class T, std::size_t Rows, std::size_t Inner,
+            std::size_t Columns >
+template < std::size_t... Pairs >
+constexpr T FixedWinograd<T, Rows, Inner, Columns>::RowFactor_(
+                                        const first_type& first,
+                                        std::size_t row,
+                                        std::index_sequence<Pairs...>){
+    return (T() + ... + (first[row][2 * Pairs] * first[row][2 * Pairs + 1]));
+}
+
+template < class T, std::size_t Rows, std::size_t Inner,
+            std::size_t Columns >
+template < std::size_t... Pairs >
+constexpr T FixedWinograd<T, Rows, Inner, Columns>::ColumnFactor_(
+                                        const second_type& second,
+                                        std::size_t column,
+                                        std::index_sequence<Pairs...>){
+    return (T() + ... + (second[2 * Pairs][column] *
+                        second[2 * Pairs + 1][column]));
+}
+
+template < class T, std::size_t Rows, std::size_t Inner,
+            std::size_t Columns >
+template < std::size_t... Pairs >
+constexpr T FixedWinograd<T, Rows, Inner, Columns>::PairsSum_(
+                                        const first_type& first,
+                                        const second_type& second,
+                                        std::size_t row,
+                                        std::size_t column,
+                                        std::index_sequence<Pairs...>){
+    return (T() + ... + ((first[row][2 * Pairs] +
+                            second[2 * Pairs + 1][column]) *
+                        (first[row][2 * Pairs + 1] +
+                            second[2 * Pairs][column])));
+}
+
+template < class T, std::size_t Rows, std::size_t Inner,
+            std::size_t Columns >
+constexpr Matrix<T, Rows, Columns> MultiplyFixed(
+                                    const Matrix<T, Rows, Inner>& first,
+                                    const Matrix<T, Inner, Columns>& second){
+    return FixedWinograd<T, Rows, Inner, Columns>::Multiply(first, second);
+}
+
+}
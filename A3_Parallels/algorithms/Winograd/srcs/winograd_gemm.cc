@@ -0,0 +1,203 @@
+#include "../includes/winograd_gemm.h"
+
+namespace s21{
+
+WinogradGemm::WinogradGemm(size_t threads_count,
+                            blocking_type blocking,
+                            simd_level_type simd_level)
+                        : threads_count_(threads_count ? threads_count : 1),
+                            blocking_(blocking.Normalized()),
+                            kernel_(winograd::GetMicroKernel(simd_level)),
+                            first_(nullptr),
+                            first_ld_(0),
+                            alpha_(0),
+                            beta_(0),
+                            result_(nullptr),
+                            rows_block_(winograd::MICRO_ROWS),
+                            next_row_(0) { }
+
+bool WinogradGemm::Multiply(elements_type alpha,
+                            const matrix_type& first,
+                            Operation first_operation,
+                            const matrix_type& second,
+                            Operation second_operation,
+                            elements_type beta,
+                            matrix_type& result){
+    const bool is_first_transposed = first_operation ==
+                                        Operation::TRANSPOSED;
+    const bool is_second_transposed = second_operation ==
+                                        Operation::TRANSPOSED;
+    const row_size_type rows = is_first_transposed ?
+                                first.ColumnsSize() : first.RowsSize();
+    const column_size_type inner = is_first_transposed ?
+                                first.RowsSize() : first.ColumnsSize();
+    const row_size_type second_rows = is_second_transposed ?
+                                second.ColumnsSize() : second.RowsSize();
+    const column_size_type columns = is_second_transposed ?
+                                second.RowsSize() : second.ColumnsSize();
+
+    if (inner != second_rows || result.RowsSize() != rows ||
+            result.ColumnsSize() != columns){
+        PRINT_ERROR(
+            __FILE__, __FUNCTION__, __LINE__,
+            "Invalid matrices: Sizes of op(A), op(B) and C don't match"
+        );
+        return false;
+    }
+    if (!rows || !columns) return true;
+    if (!inner || alpha == 0){
+        ScaleResult_(result, beta);
+        return true;
+    }
+
+    if (is_first_transposed){
+        Transpose_(first, first_transposed_);
+        first_ = first_transposed_.data();
+        first_ld_ = inner;
+    } else {
+        first_ = first.Data();
+        first_ld_ = first.LeadingDimension();
+    }
+    winograd::CalculateRowFactors(first_, rows, inner, first_ld_,
+                                row_factors_);
+    if (is_second_transposed){
+        Transpose_(second, second_transposed_);
+        winograd::CalculateColumnFactors(second_transposed_.data(), inner,
+                                        columns, columns, column_factors_);
+        winograd::PackSecondMatrix(second_transposed_.data(), inner,
+                                    columns, columns, packed_second_);
+    } else {
+        winograd::CalculateColumnFactors(second, column_factors_);
+        winograd::PackSecondMatrix(second, packed_second_);
+    }
+
+    alpha_ = alpha;
+    beta_ = beta;
+    result_ = &result;
+    rows_block_ = std::clamp<row_size_type>(
+        rows / (threads_count_ * ROWS_PER_THREAD_BLOCKS),
+        winograd::MICRO_ROWS,
+        blocking_.rows_block
+    );
+    rows_block_ = rows_block_ / winograd::MICRO_ROWS * winograd::MICRO_ROWS;
+    next_row_ = 0;
+
+    const size_t threads_count = std::min<size_t>(
+        threads_count_,
+        (rows + rows_block_ - 1) / rows_block_
+    );
+
+    if (buffers_.size() < threads_count) buffers_.resize(threads_count);
+    for (size_t thread_i = 0; thread_i < threads_count; thread_i++){
+        ThreadBuffer& buffer = buffers_[thread_i];
+
+        if (buffer.data.size() < rows_block_ * columns){
+            buffer.data.resize(rows_block_ * columns);
+        }
+        buffer.rows.resize(rows);
+    }
+
+    try{
+        TaskGroup group;
+
+        for(size_t thread_i = 1; thread_i < threads_count; thread_i++){
+            group.Run([this, thread_i](){
+                RowsParallelism_(buffers_[thread_i]);
+            });
+        }
+        RowsParallelism_(buffers_.front());
+        group.Wait();
+    } catch(const std::exception &e){
+        std::string error = "Threads problems: ";
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__, error + e.what());
+        // Rows of the failed thread are left unfinished
+        first_ = nullptr;
+        result_ = nullptr;
+        return false;
+    }
+    first_ = nullptr;
+    result_ = nullptr;
+    return true;
+}
+
+bool WinogradGemm::Multiply(elements_type alpha, const matrix_type& first,
+                            const matrix_type& second, elements_type beta,
+                            matrix_type& result){
+    return Multiply(alpha, first, Operation::NORMAL, second,
+                    Operation::NORMAL, beta, result);
+}
+
+void WinogradGemm::Transpose_(const matrix_type& matrix,
+                            storage_type& transposed){
+    const row_size_type rows = matrix.RowsSize();
+    const column_size_type columns = matrix.ColumnsSize();
+
+    transposed.resize(rows * columns);
+    for (row_size_type i = 0; i < rows; i++){
+        const elements_type* row = matrix[i].data();
+
+        for (column_size_type j = 0; j < columns; j++){
+            transposed[j * rows + i] = row[j];
+        }
+    }
+}
+
+void WinogradGemm::ScaleResult_(matrix_type& result, elements_type beta){
+    for (row_size_type i = 0; i < result.RowsSize(); i++){
+        for (elements_type& element : result[i]){
+            element = beta == 0 ? 0 : beta * element;
+        }
+    }
+}
+
+void WinogradGemm::RowsParallelism_(ThreadBuffer& buffer){
+    const row_size_type rows = result_->RowsSize();
+    const column_size_type columns = result_->ColumnsSize();
+
+    while (true){
+        row_size_type block_begin = next_row_.fetch_add(
+            rows_block_,
+            std::memory_order_relaxed
+        );
+        if (block_begin >= rows) break;
+
+        row_size_type block_end = std::min(block_begin + rows_block_, rows);
+
+        for (row_size_type row_i = block_begin; row_i < block_end; row_i++){
+            buffer.rows[row_i] = buffer.data.data() +
+                                (row_i - block_begin) * columns;
+        }
+        winograd::MultiplyBlocked(first_, first_ld_, packed_second_,
+                                blocking_, row_factors_, column_factors_,
+                                block_begin, block_end, buffer.rows.data(),
+                                kernel_);
+        MergeBlock_(buffer, block_begin, block_end);
+    }
+}
+
+void WinogradGemm::MergeBlock_(const ThreadBuffer& buffer,
+                                row_size_type row_begin,
+                                row_size_type row_end){
+    const column_size_type columns = result_->ColumnsSize();
+
+    for (row_size_type row_i = row_begin; row_i < row_end; row_i++){
+        const elements_type* product = buffer.rows[row_i];
+        elements_type* result_row = (*result_)[row_i].data();
+
+        if (beta_ == 0){
+            for (column_size_type j = 0; j < columns; j++){
+                result_row[j] = alpha_ * product[j];
+            }
+        } else if (beta_ == 1){
+            for (column_size_type j = 0; j < columns; j++){
+                result_row[j] += alpha_ * product[j];
+            }
+        } else {
+            for (column_size_type j = 0; j < columns; j++){
+                result_row[j] = alpha_ * product[j] + beta_ * result_row[j];
+            }
+        }
+    }
+}
+
+}
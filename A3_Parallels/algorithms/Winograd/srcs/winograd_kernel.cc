@@ -0,0 +1,71 @@
+#include "../includes/winograd_kernel.h"
+
+namespace s21::winograd{
+
+void CalculateRowFactors(const Matrix<elements_type>& matrix,
+                        factors_type& factors){
+    CalculateRowFactors(matrix.Data(), matrix.RowsSize(),
+                        matrix.ColumnsSize(), matrix.LeadingDimension(),
+                        factors);
+}
+
+void CalculateColumnFactors(const Matrix<elements_type>& matrix,
+                            factors_type& factors){
+    CalculateColumnFactors(matrix.Data(), matrix.RowsSize(),
+                            matrix.ColumnsSize(), matrix.LeadingDimension(),
+                            factors);
+}
+
+void CalculateRowFactors(const elements_type* matrix, size_type rows,
+                        size_type columns, size_type ld,
+                        factors_type& factors){
+    factors.assign(rows, 0);
+    for (size_type i = 0; i < rows; i++){
+        const elements_type* row = matrix + i * ld;
+        elements_type factor = 0;
+
+        for (size_type k = 0; k + 1 < columns; k += 2){
+            factor += row[k] * row[k + 1];
+        }
+        factors[i] = factor;
+    }
+}
+
+void CalculateColumnFactors(const elements_type* matrix, size_type rows,
+                            size_type columns, size_type ld,
+                            factors_type& factors){
+    factors.assign(columns, 0);
+    for (size_type k = 0; k + 1 < rows; k += 2){
+        const elements_type* b_even = matrix + k * ld;
+        const elements_type* b_odd = b_even + ld;
+
+        for (size_type j = 0; j < columns; j++){
+            factors[j] += b_even[j] * b_odd[j];
+        }
+    }
+}
+
+void CalculateRow(const Matrix<elements_type>& first,
+                const Matrix<elements_type>& second,
+                size_type row_i,
+                const factors_type& row_factors,
+                const factors_type& column_factors,
+                elements_type* result_row){
+    size_type inner_size = first.ColumnsSize();
+
+    if (inner_size % 2){
+        RowKernel<true>::Calculate(
+            first[row_i].data(), second.Data(), second.LeadingDimension(),
+            inner_size, second.ColumnsSize(), row_factors[row_i],
+            column_factors.data(), result_row
+        );
+    } else {
+        RowKernel<false>::Calculate(
+            first[row_i].data(), second.Data(), second.LeadingDimension(),
+            inner_size, second.ColumnsSize(), row_factors[row_i],
+            column_factors.data(), result_row
+        );
+    }
+}
+
+}
@@ -0,0 +1,46 @@
+#ifndef WINOGRAD_KERNEL_H
+#error 'winograd_kernel_impl.h' is not supposed to be included directly. \
+        Include 'winograd_kernel.h' instead.
+#endif
+
+namespace s21::winograd{
+
+template < bool OddInnerSize >
+inline void RowKernel<OddInnerSize>::Calculate(
+                                        const elements_type* first_row,
+                                        const elements_type* second,
+                                        size_type second_ld,
+                                        size_type inner_size,
+                                        size_type columns,
+                                        elements_type row_factor,
+                                        const elements_type* column_factors,
+                                        elements_type* result_row){
+    std::fill(result_row, result_row + columns, 0);
+
+    // k-j order: rows of second matrix are streamed contiguously
+    for (size_type k = 0; k + 1 < inner_size; k += 2){
+        const elements_type a_even = first_row[k];
+        const elements_type a_odd = first_row[k + 1];
+        const elements_type* b_even = second + k * second_ld;
+        const elements_type* b_odd = b_even + second_ld;
+
+        for (size_type j = 0; j < columns; j++){
+            result_row[j] += (a_even + b_odd[j]) * (a_odd + b_even[j]);
+        }
+    }
+
+    if constexpr (OddInnerSize){
+        const elements_type a_last = first_row[inner_size - 1];
+        const elements_type* b_last = second + (inner_size - 1) * second_ld;
+
+        for (size_type j = 0; j < columns; j++){
+            result_row[j] += a_last * b_last[j];
+        }
+    }
+
+    for (size_type j = 0; j < columns; j++){
+        result_row[j] -= row_factor + column_factors[j];
+    }
+}
+
+}
@@ -0,0 +1,234 @@
+#include "../includes/winograd_out_of_core.h"
+
+namespace s21{
+
+WinogradOutOfCore::WinogradOutOfCore(size_type tile_size,
+                                    size_t threads_count,
+                                    size_t prefetch_depth,
+                                    blocking_type blocking,
+                                    simd_level_type simd_level)
+                        : tile_size_((std::max<size_type>(tile_size, 1) +
+                                        winograd::PANEL_WIDTH - 1) /
+                                    winograd::PANEL_WIDTH *
+                                    winograd::PANEL_WIDTH),
+                            threads_count_(threads_count ? threads_count : 1),
+                            blocking_(blocking.Normalized()),
+                            kernel_(winograd::GetMicroKernel(simd_level)),
+                            slots_(prefetch_depth ? prefetch_depth : 1),
+                            loaded_(slots_.size()),
+                            free_(slots_.size()),
+                            result_rows_(tile_size_),
+                            stats_{0, 0, 0} { }
+
+bool WinogradOutOfCore::Multiply(const std::string& first_filename,
+                                const std::string& second_filename,
+                                const std::string& result_filename){
+    stats_ = Stats{0, 0, 0};
+    try{
+        MappedMatrixFile first = MappedMatrixFile::Open(first_filename);
+        MappedMatrixFile second = MappedMatrixFile::Open(second_filename);
+
+        if (first.ElementType() != MatrixElementType::FLOAT64 ||
+                second.ElementType() != MatrixElementType::FLOAT64){
+            PRINT_ERROR(
+                __FILE__, __FUNCTION__, __LINE__,
+                "Invalid matrices: Only files of doubles can be multiplied"
+            );
+            return false;
+        }
+        if (first.ColumnsSize() != second.RowsSize()){
+            PRINT_ERROR(
+                __FILE__, __FUNCTION__, __LINE__,
+                "Invalid matrix: Rows count of first matrix doesn't "
+                "equal to columns count of second one"
+            );
+            return false;
+        }
+
+        MappedMatrixFile result = MappedMatrixFile::Create(
+            result_filename,
+            first.RowsSize(),
+            second.ColumnsSize(),
+            MatrixElementType::FLOAT64
+        );
+
+        accumulator_.resize(tile_size_ * tile_size_);
+        product_.resize(tile_size_ * tile_size_);
+        loaded_.Reset();
+        free_.Reset();
+        for (size_t slot_i = 0; slot_i < slots_.size(); slot_i++){
+            free_.Push(slot_i);
+        }
+
+        load_error_ = nullptr;
+
+        std::thread loader(&WinogradOutOfCore::Load_, this, std::cref(first),
+                            std::cref(second));
+
+        try{
+            Compute_(first.ColumnsSize(), result);
+        } catch(...){
+            // The loader may wait for a free slot which never comes
+            free_.Close();
+            loader.join();
+            throw;
+        }
+        loader.join();
+        if (load_error_) std::rethrow_exception(load_error_);
+        stats_.compute_stalls = loaded_.Stats().pop_stalls;
+        stats_.loader_stalls = free_.Stats().pop_stalls;
+    } catch(const ::s21::Exception &e){
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__, e.GetMessage());
+        return false;
+    } catch(const std::exception &e){
+        std::string error = "Threads problems: ";
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__, error + e.what());
+        return false;
+    }
+    return true;
+}
+
+const WinogradOutOfCore::Stats& WinogradOutOfCore::LastStats() const{
+    return stats_;
+}
+
+void WinogradOutOfCore::Load_(const MappedMatrixFile& first,
+                            const MappedMatrixFile& second){
+    const size_type rows = first.RowsSize();
+    const size_type inner = first.ColumnsSize();
+    const size_type columns = second.ColumnsSize();
+
+    try{
+        for (size_type row_i = 0; row_i < rows; row_i += tile_size_){
+        for (size_type column_i = 0; column_i < columns;
+                column_i += tile_size_){
+            for (size_type inner_i = 0; inner_i < inner;
+                    inner_i += tile_size_){
+                size_t slot_i;
+
+                if (!free_.Pop(slot_i)){
+                    loaded_.Close();
+                    return;
+                }
+
+                TileSlot& slot = slots_[slot_i];
+
+                slot.row_begin = row_i;
+                slot.row_end = std::min(row_i + tile_size_, rows);
+                slot.column_begin = column_i;
+                slot.column_end = std::min(column_i + tile_size_, columns);
+                slot.inner_begin = inner_i;
+                slot.inner_end = std::min(inner_i + tile_size_, inner);
+                LoadSlot_(first, second, slot);
+                loaded_.Push(slot_i);
+            }
+        }
+        }
+    } catch(...){
+        load_error_ = std::current_exception();
+    }
+    loaded_.Close();
+}
+
+void WinogradOutOfCore::LoadSlot_(const MappedMatrixFile& first,
+                                const MappedMatrixFile& second,
+                                TileSlot& slot){
+    const size_type rows = slot.row_end - slot.row_begin;
+    const size_type inner = slot.inner_end - slot.inner_begin;
+    const size_type columns = slot.column_end - slot.column_begin;
+    const elements_type* second_tile =
+                        second.Row<elements_type>(slot.inner_begin) +
+                        slot.column_begin;
+
+    // Reading the mapped tile here makes page faults happen in
+    // the loader thread instead of the multiplication one
+    slot.first.resize(rows * inner);
+    for (size_type row_i = 0; row_i < rows; row_i++){
+        std::memcpy(
+            slot.first.data() + row_i * inner,
+            first.Row<elements_type>(slot.row_begin + row_i) +
+                slot.inner_begin,
+            inner * sizeof(elements_type)
+        );
+    }
+    winograd::CalculateRowFactors(slot.first.data(), rows, inner, inner,
+                                slot.row_factors);
+    winograd::CalculateColumnFactors(second_tile, inner, columns,
+                                    second.LeadingDimension(),
+                                    slot.column_factors);
+    winograd::PackSecondMatrix(second_tile, inner, columns,
+                                second.LeadingDimension(), slot.packed);
+}
+
+void WinogradOutOfCore::MultiplySlot_(const TileSlot& slot){
+    const size_type rows = slot.row_end - slot.row_begin;
+    const size_type inner = slot.inner_end - slot.inner_begin;
+    size_type rows_per_thread = (rows + threads_count_ - 1) / threads_count_;
+
+    rows_per_thread = (rows_per_thread + winograd::MICRO_ROWS - 1) /
+                        winograd::MICRO_ROWS * winograd::MICRO_ROWS;
+    ThreadPool::Instance().ParallelFor(
+        0, rows,
+        [&](size_type row_begin, size_type row_end){
+            winograd::MultiplyBlocked(
+                slot.first.data(), inner, slot.packed, blocking_,
+                slot.row_factors, slot.column_factors, row_begin,
+                row_end, result_rows_.data(), kernel_
+            );
+        },
+        rows_per_thread,
+        threads_count_
+    );
+}
+
+void WinogradOutOfCore::Compute_(size_type inner,
+                                MappedMatrixFile& result){
+    const size_type columns = result.ColumnsSize();
+    size_t slot_i;
+
+    while (loaded_.Pop(slot_i)){
+        const TileSlot& slot = slots_[slot_i];
+        const size_type row_begin = slot.row_begin;
+        const size_type row_end = slot.row_end;
+        const size_type column_begin = slot.column_begin;
+        const size_type tile_columns = slot.column_end - slot.column_begin;
+        const bool is_first_step = slot.inner_begin == 0;
+        const bool is_last_step = slot.inner_end == inner;
+        elements_type* target = is_first_step ? accumulator_.data() :
+                                                product_.data();
+
+        for (size_type row_i = 0; row_i < row_end - row_begin; row_i++){
+            result_rows_[row_i] = target + row_i * tile_size_;
+        }
+        MultiplySlot_(slot);
+        free_.Push(slot_i);
+        stats_.tiles++;
+
+        if (!is_first_step){
+            for (size_type row_i = 0; row_i < row_end - row_begin; row_i++){
+                elements_type* accumulated = accumulator_.data() +
+                                            row_i * tile_size_;
+                const elements_type* product = product_.data() +
+                                                row_i * tile_size_;
+
+                for (size_type j = 0; j < tile_columns; j++){
+                    accumulated[j] += product[j];
+                }
+            }
+        }
+        if (!is_last_step) continue;
+
+        for (size_type row_i = row_begin; row_i < row_end; row_i++){
+            std::memcpy(
+                result.Row<elements_type>(row_i) + column_begin,
+                accumulator_.data() + (row_i - row_begin) * tile_size_,
+                tile_columns * sizeof(elements_type)
+            );
+        }
+        if (column_begin + tile_columns == columns){
+            result.Flush(row_begin, row_end);
+        }
+    }
+}
+
+}
@@ -0,0 +1,174 @@
+#include "../includes/winograd_prepared.h"
+
+namespace s21{
+
+WinogradPrepared::WinogradPrepared(size_t threads_count,
+                                    blocking_type blocking,
+                                    simd_level_type simd_level)
+                            : blocking_(blocking.Normalized()),
+                                kernel_(winograd::GetMicroKernel(simd_level)),
+                                is_prepared_(false),
+                                first_(nullptr),
+                                rows_per_worker_(0),
+                                generation_(0),
+                                workers_busy_(0),
+                                is_stopped_(false) {
+    threads_count = threads_count ? threads_count : 1;
+    try{
+        workers_.reserve(threads_count - 1);
+        for (size_t part_i = 1; part_i < threads_count; part_i++){
+            workers_.push_back(std::thread(
+                &WinogradPrepared::Worker_,
+                this,
+                part_i
+            ));
+        }
+    } catch(const std::exception &e){
+        std::string error = "Threads problems: ";
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__, error + e.what());
+    }
+}
+
+WinogradPrepared::~WinogradPrepared(){
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        is_stopped_ = true;
+    }
+    start_cv_.notify_all();
+    JoinThreads(workers_);
+}
+
+bool WinogradPrepared::Prepare(const matrix_type& second){
+    if (!second.RowsSize() || !second.ColumnsSize()){
+        PRINT_ERROR(
+            __FILE__, __FUNCTION__, __LINE__,
+            "Invalid matrix: Matrix is empty"
+        );
+        is_prepared_ = false;
+        return false;
+    }
+    winograd::CalculateColumnFactors(second, column_factors_);
+    winograd::PackSecondMatrix(second, packed_second_);
+    is_prepared_ = true;
+    return true;
+}
+
+bool WinogradPrepared::Multiply(const matrix_type& first,
+                                matrix_type& result){
+    if (!is_prepared_){
+        PRINT_ERROR(
+            __FILE__, __FUNCTION__, __LINE__,
+            "Invalid state: Second matrix isn't prepared"
+        );
+        return false;
+    }
+    if (first.ColumnsSize() != packed_second_.inner_size ||
+            result.RowsSize() != first.RowsSize() ||
+            result.ColumnsSize() != packed_second_.columns){
+        PRINT_ERROR(
+            __FILE__, __FUNCTION__, __LINE__,
+            "Invalid matrices: Sizes of matrices don't match "
+            "the prepared matrix"
+        );
+        return false;
+    }
+
+    winograd::CalculateRowFactors(first, row_factors_);
+    result_rows_.resize(first.RowsSize());
+    for (row_size_type row_i = 0; row_i < first.RowsSize(); row_i++){
+        result_rows_[row_i] = result[row_i].data();
+    }
+
+    const size_t parts = workers_.size() + 1;
+
+    rows_per_worker_ = (first.RowsSize() + parts - 1) / parts;
+    rows_per_worker_ = (rows_per_worker_ + winograd::MICRO_ROWS - 1) /
+                        winograd::MICRO_ROWS * winograd::MICRO_ROWS;
+    first_ = &first;
+    if (!workers_.empty()){
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            workers_busy_ = workers_.size();
+            generation_++;
+        }
+        start_cv_.notify_all();
+    }
+
+    CalculatePart_(0);
+
+    if (!workers_.empty()){
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        done_cv_.wait(lock, [this](){ return !workers_busy_; });
+    }
+    first_ = nullptr;
+    return true;
+}
+
+bool WinogradPrepared::IsPrepared() const{
+    return is_prepared_;
+}
+
+WinogradPrepared::row_size_type
+                            WinogradPrepared::PreparedRowsSize() const{
+    return is_prepared_ ? packed_second_.inner_size : 0;
+}
+
+WinogradPrepared::column_size_type
+                            WinogradPrepared::PreparedColumnsSize() const{
+    return is_prepared_ ? packed_second_.columns : 0;
+}
+
+WinogradPrepared::Buffers WinogradPrepared::KeptBuffers() const{
+    return Buffers{
+        row_factors_.data(), row_factors_.capacity(),
+        result_rows_.data(), result_rows_.capacity()
+    };
+}
+
+void WinogradPrepared::Worker_(size_t part_i){
+    size_t seen_generation = 0;
+
+    while (true){
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+
+            start_cv_.wait(lock, [this, seen_generation](){
+                return is_stopped_ || generation_ != seen_generation;
+            });
+            if (is_stopped_) return;
+            seen_generation = generation_;
+        }
+
+        CalculatePart_(part_i);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!--workers_busy_) done_cv_.notify_one();
+    }
+}
+
+void WinogradPrepared::CalculatePart_(size_t part_i){
+    const row_size_type rows_count = first_->RowsSize();
+    const row_size_type row_begin = std::min(part_i * rows_per_worker_,
+                                            rows_count);
+    const row_size_type row_end = std::min(row_begin + rows_per_worker_,
+                                            rows_count);
+
+    if (row_begin == row_end) return;
+    winograd::MultiplyBlocked(
+        first_->Data(),
+        first_->LeadingDimension(),
+        packed_second_,
+        blocking_,
+        row_factors_,
+        column_factors_,
+        row_begin,
+        row_end,
+        result_rows_.data(),
+        kernel_
+    );
+}
+
+}
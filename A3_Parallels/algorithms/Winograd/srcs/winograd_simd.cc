@@ -0,0 +1,225 @@
+#include "../includes/winograd_simd.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define WINOGRAD_X86
+#include <immintrin.h>
+#endif
+
+namespace s21::winograd{
+
+namespace {
+
+void ScalarKernel(size_type pairs,
+                const elements_type* const* first_rows,
+                const elements_type* panel,
+                elements_type* const* tile_rows){
+    for (size_type p = 0; p < pairs; p++){
+        const elements_type* b_odd = panel + p * 2 * PANEL_WIDTH;
+        const elements_type* b_even = b_odd + PANEL_WIDTH;
+
+        for (size_type r = 0; r < MICRO_ROWS; r++){
+            const elements_type a_even = first_rows[r][2 * p];
+            const elements_type a_odd = first_rows[r][2 * p + 1];
+            elements_type* tile_row = tile_rows[r];
+
+            for (size_type j = 0; j < PANEL_WIDTH; j++){
+                tile_row[j] += (a_even + b_odd[j]) * (a_odd + b_even[j]);
+            }
+        }
+    }
+}
+
+#ifdef WINOGRAD_X86
+
+__attribute__((target("sse2")))
+void Sse2Kernel(size_type pairs,
+                const elements_type* const* first_rows,
+                const elements_type* panel,
+                elements_type* const* tile_rows){
+    static_assert(PANEL_WIDTH == 8, "SSE2 kernel holds 4 registers per row");
+
+    for (size_type r = 0; r < MICRO_ROWS; r++){
+        const elements_type* a = first_rows[r];
+        elements_type* tile_row = tile_rows[r];
+        __m128d acc0 = _mm_loadu_pd(tile_row);
+        __m128d acc1 = _mm_loadu_pd(tile_row + 2);
+        __m128d acc2 = _mm_loadu_pd(tile_row + 4);
+        __m128d acc3 = _mm_loadu_pd(tile_row + 6);
+
+        // One row at a time: 4 accumulators fit into 16 xmm registers
+        // together with the panel slice and broadcasted elements
+        for (size_type p = 0; p < pairs; p++){
+            const elements_type* b_odd = panel + p * 2 * PANEL_WIDTH;
+            const elements_type* b_even = b_odd + PANEL_WIDTH;
+            const __m128d a_even = _mm_set1_pd(a[2 * p]);
+            const __m128d a_odd = _mm_set1_pd(a[2 * p + 1]);
+
+            acc0 = _mm_add_pd(acc0, _mm_mul_pd(
+                _mm_add_pd(a_even, _mm_load_pd(b_odd)),
+                _mm_add_pd(a_odd, _mm_load_pd(b_even))));
+            acc1 = _mm_add_pd(acc1, _mm_mul_pd(
+                _mm_add_pd(a_even, _mm_load_pd(b_odd + 2)),
+                _mm_add_pd(a_odd, _mm_load_pd(b_even + 2))));
+            acc2 = _mm_add_pd(acc2, _mm_mul_pd(
+                _mm_add_pd(a_even, _mm_load_pd(b_odd + 4)),
+                _mm_add_pd(a_odd, _mm_load_pd(b_even + 4))));
+            acc3 = _mm_add_pd(acc3, _mm_mul_pd(
+                _mm_add_pd(a_even, _mm_load_pd(b_odd + 6)),
+                _mm_add_pd(a_odd, _mm_load_pd(b_even + 6))));
+        }
+
+        _mm_storeu_pd(tile_row, acc0);
+        _mm_storeu_pd(tile_row + 2, acc1);
+        _mm_storeu_pd(tile_row + 4, acc2);
+        _mm_storeu_pd(tile_row + 6, acc3);
+    }
+}
+
+__attribute__((target("avx2,fma")))
+void Avx2Kernel(size_type pairs,
+                const elements_type* const* first_rows,
+                const elements_type* panel,
+                elements_type* const* tile_rows){
+    static_assert(MICRO_ROWS == 4 && PANEL_WIDTH == 8,
+                "AVX2 kernel keeps 4x2 accumulators");
+
+    __m256d acc[MICRO_ROWS][2];
+
+    for (size_type r = 0; r < MICRO_ROWS; r++){
+        acc[r][0] = _mm256_loadu_pd(tile_rows[r]);
+        acc[r][1] = _mm256_loadu_pd(tile_rows[r] + 4);
+    }
+
+    for (size_type p = 0; p < pairs; p++){
+        const elements_type* b_odd = panel + p * 2 * PANEL_WIDTH;
+        const elements_type* b_even = b_odd + PANEL_WIDTH;
+        const __m256d b_odd0 = _mm256_load_pd(b_odd);
+        const __m256d b_odd1 = _mm256_load_pd(b_odd + 4);
+        const __m256d b_even0 = _mm256_load_pd(b_even);
+        const __m256d b_even1 = _mm256_load_pd(b_even + 4);
+
+        for (size_type r = 0; r < MICRO_ROWS; r++){
+            const __m256d a_even = _mm256_broadcast_sd(first_rows[r] + 2 * p);
+            const __m256d a_odd = _mm256_broadcast_sd(
+                first_rows[r] + 2 * p + 1
+            );
+
+            acc[r][0] = _mm256_fmadd_pd(
+                _mm256_add_pd(a_even, b_odd0),
+                _mm256_add_pd(a_odd, b_even0),
+                acc[r][0]
+            );
+            acc[r][1] = _mm256_fmadd_pd(
+                _mm256_add_pd(a_even, b_odd1),
+                _mm256_add_pd(a_odd, b_even1),
+                acc[r][1]
+            );
+        }
+    }
+
+    for (size_type r = 0; r < MICRO_ROWS; r++){
+        _mm256_storeu_pd(tile_rows[r], acc[r][0]);
+        _mm256_storeu_pd(tile_rows[r] + 4, acc[r][1]);
+    }
+}
+
+__attribute__((target("avx512f")))
+void Avx512Kernel(size_type pairs,
+                const elements_type* const* first_rows,
+                const elements_type* panel,
+                elements_type* const* tile_rows){
+    static_assert(MICRO_ROWS == 4 && PANEL_WIDTH == 8,
+                "AVX-512 kernel keeps one accumulator per row");
+
+    __m512d acc0 = _mm512_loadu_pd(tile_rows[0]);
+    __m512d acc1 = _mm512_loadu_pd(tile_rows[1]);
+    __m512d acc2 = _mm512_loadu_pd(tile_rows[2]);
+    __m512d acc3 = _mm512_loadu_pd(tile_rows[3]);
+    const elements_type* a0 = first_rows[0];
+    const elements_type* a1 = first_rows[1];
+    const elements_type* a2 = first_rows[2];
+    const elements_type* a3 = first_rows[3];
+
+    for (size_type p = 0; p < pairs; p++){
+        const __m512d b_odd = _mm512_load_pd(panel + p * 2 * PANEL_WIDTH);
+        const __m512d b_even = _mm512_load_pd(
+            panel + p * 2 * PANEL_WIDTH + PANEL_WIDTH
+        );
+
+        acc0 = _mm512_fmadd_pd(
+            _mm512_add_pd(_mm512_set1_pd(a0[2 * p]), b_odd),
+            _mm512_add_pd(_mm512_set1_pd(a0[2 * p + 1]), b_even), acc0);
+        acc1 = _mm512_fmadd_pd(
+            _mm512_add_pd(_mm512_set1_pd(a1[2 * p]), b_odd),
+            _mm512_add_pd(_mm512_set1_pd(a1[2 * p + 1]), b_even), acc1);
+        acc2 = _mm512_fmadd_pd(
+            _mm512_add_pd(_mm512_set1_pd(a2[2 * p]), b_odd),
+            _mm512_add_pd(_mm512_set1_pd(a2[2 * p + 1]), b_even), acc2);
+        acc3 = _mm512_fmadd_pd(
+            _mm512_add_pd(_mm512_set1_pd(a3[2 * p]), b_odd),
+            _mm512_add_pd(_mm512_set1_pd(a3[2 * p + 1]), b_even), acc3);
+    }
+
+    _mm512_storeu_pd(tile_rows[0], acc0);
+    _mm512_storeu_pd(tile_rows[1], acc1);
+    _mm512_storeu_pd(tile_rows[2], acc2);
+    _mm512_storeu_pd(tile_rows[3], acc3);
+}
+
+#endif
+
+}
+
+bool IsSimdLevelSupported(SimdLevel level){
+#ifdef WINOGRAD_X86
+    switch (level){
+        case SimdLevel::SCALAR:
+            return true;
+        case SimdLevel::SSE2:
+            return __builtin_cpu_supports("sse2");
+        case SimdLevel::AVX2:
+            return __builtin_cpu_supports("avx2") &&
+                    __builtin_cpu_supports("fma");
+        case SimdLevel::AVX512:
+            return __builtin_cpu_supports("avx512f");
+    }
+    return false;
+#else
+    return level == SimdLevel::SCALAR;
+#endif
+}
+
+SimdLevel DetectSimdLevel(){
+    for (SimdLevel level : {SimdLevel::AVX512, SimdLevel::AVX2,
+                            SimdLevel::SSE2}){
+        if (IsSimdLevelSupported(level)) return level;
+    }
+    return SimdLevel::SCALAR;
+}
+
+micro_kernel_type GetMicroKernel(SimdLevel level){
+#ifdef WINOGRAD_X86
+    if (level == SimdLevel::AVX512 && IsSimdLevelSupported(level)){
+        return Avx512Kernel;
+    }
+    if (level >= SimdLevel::AVX2 && IsSimdLevelSupported(SimdLevel::AVX2)){
+        return Avx2Kernel;
+    }
+    if (level >= SimdLevel::SSE2 && IsSimdLevelSupported(SimdLevel::SSE2)){
+        return Sse2Kernel;
+    }
+#endif
+    return ScalarKernel;
+}
+
+std::string SimdLevelName(SimdLevel level){
+    switch (level){
+        case SimdLevel::SCALAR: return "scalar";
+        case SimdLevel::SSE2: return "SSE2";
+        case SimdLevel::AVX2: return "AVX2+FMA";
+        case SimdLevel::AVX512: return "AVX-512";
+    }
+    return "unknown";
+}
+
+}
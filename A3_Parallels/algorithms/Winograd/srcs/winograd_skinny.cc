@@ -0,0 +1,290 @@
+#include "../includes/winograd_skinny.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define WINOGRAD_X86
+#include <immintrin.h>
+#endif
+
+namespace s21::winograd{
+
+namespace {
+
+/**
+ * Writing [Columns] results from pair products [sums] of [first_row]
+ */
+template < size_type Columns >
+void FinishRow(const elements_type* first_row,
+                const SkinnyColumns& packed,
+                elements_type row_factor,
+                const elements_type* sums,
+                elements_type* result_row){
+    for (size_type c = 0; c < Columns; c++){
+        elements_type value = sums[c];
+
+        if (packed.inner_size % 2){
+            value += first_row[packed.inner_size - 1] * packed.odd_row[c];
+        }
+        result_row[c] = value - (row_factor + packed.factors[c]);
+    }
+}
+
+/**
+ * Adding pair products of pairs [pair_begin, packed.pairs) to
+ * [row_factor] and [sums]
+ */
+template < size_type Columns >
+void ScalarTail(const elements_type* first_row,
+                const SkinnyColumns& packed,
+                size_type pair_begin,
+                elements_type& row_factor,
+                elements_type* sums){
+    for (size_type p = pair_begin; p < packed.pairs; p++){
+        const elements_type a_even = first_row[2 * p];
+        const elements_type a_odd = first_row[2 * p + 1];
+
+        row_factor += a_even * a_odd;
+        for (size_type c = 0; c < Columns; c++){
+            const elements_type* swapped = packed.Column(c) + 2 * p;
+
+            sums[c] += (a_even + swapped[0]) * (a_odd + swapped[1]);
+        }
+    }
+}
+
+template < size_type Columns >
+void ScalarSkinnyKernel(const elements_type* first_row,
+                        const SkinnyColumns& packed,
+                        elements_type* result_row){
+    elements_type row_factor = 0;
+    elements_type sums[Columns] = {};
+
+    ScalarTail<Columns>(first_row, packed, 0, row_factor, sums);
+    FinishRow<Columns>(first_row, packed, row_factor, sums, result_row);
+}
+
+#ifdef WINOGRAD_X86
+
+// Every SIMD kernel multiplies vector v = (s0, s1, s2, s3, ...) by its
+// copy with neighbours swapped, so each lane pair holds s0*s1 twice and
+// only even lanes are summed in the end
+
+template < size_type Columns >
+__attribute__((target("sse2")))
+void Sse2SkinnyKernel(const elements_type* first_row,
+                    const SkinnyColumns& packed,
+                    elements_type* result_row){
+    __m128d row_acc = _mm_setzero_pd();
+    __m128d acc[Columns];
+    size_type p = 0;
+
+    for (size_type c = 0; c < Columns; c++) acc[c] = _mm_setzero_pd();
+    for (; p < packed.pairs; p++){
+        const __m128d a = _mm_loadu_pd(first_row + 2 * p);
+
+        row_acc = _mm_add_pd(row_acc,
+                            _mm_mul_pd(a, _mm_shuffle_pd(a, a, 1)));
+        for (size_type c = 0; c < Columns; c++){
+            const __m128d s = _mm_add_pd(
+                a,
+                _mm_loadu_pd(packed.Column(c) + 2 * p)
+            );
+
+            acc[c] = _mm_add_pd(acc[c],
+                                _mm_mul_pd(s, _mm_shuffle_pd(s, s, 1)));
+        }
+    }
+
+    elements_type sums[Columns];
+
+    for (size_type c = 0; c < Columns; c++) sums[c] = _mm_cvtsd_f64(acc[c]);
+    FinishRow<Columns>(first_row, packed, _mm_cvtsd_f64(row_acc), sums,
+                        result_row);
+}
+
+__attribute__((target("avx2")))
+elements_type EvenLanesSum(__m256d v){
+    alignas(32) elements_type lanes[4];
+
+    _mm256_store_pd(lanes, v);
+    return lanes[0] + lanes[2];
+}
+
+template < size_type Columns >
+__attribute__((target("avx2,fma")))
+void Avx2SkinnyKernel(const elements_type* first_row,
+                    const SkinnyColumns& packed,
+                    elements_type* result_row){
+    __m256d row_acc = _mm256_setzero_pd();
+    __m256d acc[Columns];
+    size_type p = 0;
+
+    for (size_type c = 0; c < Columns; c++) acc[c] = _mm256_setzero_pd();
+    for (; p + 2 <= packed.pairs; p += 2){
+        const __m256d a = _mm256_loadu_pd(first_row + 2 * p);
+
+        row_acc = _mm256_fmadd_pd(a, _mm256_permute_pd(a, 0x5), row_acc);
+        for (size_type c = 0; c < Columns; c++){
+            const __m256d s = _mm256_add_pd(
+                a,
+                _mm256_loadu_pd(packed.Column(c) + 2 * p)
+            );
+
+            acc[c] = _mm256_fmadd_pd(s, _mm256_permute_pd(s, 0x5), acc[c]);
+        }
+    }
+
+    elements_type row_factor = EvenLanesSum(row_acc);
+    elements_type sums[Columns];
+
+    for (size_type c = 0; c < Columns; c++) sums[c] = EvenLanesSum(acc[c]);
+    ScalarTail<Columns>(first_row, packed, p, row_factor, sums);
+    FinishRow<Columns>(first_row, packed, row_factor, sums, result_row);
+}
+
+__attribute__((target("avx512f")))
+elements_type EvenLanesSum(__m512d v){
+    alignas(64) elements_type lanes[8];
+
+    _mm512_store_pd(lanes, v);
+    return (lanes[0] + lanes[2]) + (lanes[4] + lanes[6]);
+}
+
+template < size_type Columns >
+__attribute__((target("avx512f")))
+void Avx512SkinnyKernel(const elements_type* first_row,
+                        const SkinnyColumns& packed,
+                        elements_type* result_row){
+    __m512d row_acc = _mm512_setzero_pd();
+    __m512d acc[Columns];
+    size_type p = 0;
+
+    for (size_type c = 0; c < Columns; c++) acc[c] = _mm512_setzero_pd();
+    for (; p + 4 <= packed.pairs; p += 4){
+        const __m512d a = _mm512_loadu_pd(first_row + 2 * p);
+
+        row_acc = _mm512_fmadd_pd(a, _mm512_shuffle_pd(a, a, 0x55), row_acc);
+        for (size_type c = 0; c < Columns; c++){
+            const __m512d s = _mm512_add_pd(
+                a,
+                _mm512_loadu_pd(packed.Column(c) + 2 * p)
+            );
+
+            acc[c] = _mm512_fmadd_pd(s, _mm512_shuffle_pd(s, s, 0x55), acc[c]);
+        }
+    }
+
+    elements_type row_factor = EvenLanesSum(row_acc);
+    elements_type sums[Columns];
+
+    for (size_type c = 0; c < Columns; c++) sums[c] = EvenLanesSum(acc[c]);
+    ScalarTail<Columns>(first_row, packed, p, row_factor, sums);
+    FinishRow<Columns>(first_row, packed, row_factor, sums, result_row);
+}
+
+#endif
+
+/**
+ * @return [Kernel] instantiated for [columns], which is at most
+ * SKINNY_MAX_COLUMNS
+ */
+template < template < size_type > class Kernel >
+skinny_kernel_type SelectColumns(size_type columns){
+    static_assert(SKINNY_MAX_COLUMNS == 4, "Kernels are listed up to 4");
+
+    switch (columns){
+        case 1: return Kernel<1>::Calculate;
+        case 2: return Kernel<2>::Calculate;
+        case 3: return Kernel<3>::Calculate;
+        default: return Kernel<4>::Calculate;
+    }
+}
+
+// Kernels wrapped into classes to be passed to SelectColumns
+
+template < size_type Columns >
+struct Scalar{
+    static constexpr skinny_kernel_type Calculate =
+                                        ScalarSkinnyKernel<Columns>;
+};
+
+#ifdef WINOGRAD_X86
+
+template < size_type Columns >
+struct Sse2{
+    static constexpr skinny_kernel_type Calculate = Sse2SkinnyKernel<Columns>;
+};
+
+template < size_type Columns >
+struct Avx2{
+    static constexpr skinny_kernel_type Calculate = Avx2SkinnyKernel<Columns>;
+};
+
+template < size_type Columns >
+struct Avx512{
+    static constexpr skinny_kernel_type Calculate =
+                                        Avx512SkinnyKernel<Columns>;
+};
+
+#endif
+
+}
+
+void PackSkinnyMatrix(const Matrix<elements_type>& second,
+                    SkinnyColumns& packed){
+    packed.inner_size = second.RowsSize();
+    packed.columns = std::min(second.ColumnsSize(), SKINNY_MAX_COLUMNS);
+    packed.pairs = packed.inner_size / 2;
+    packed.data.resize(packed.columns * packed.pairs * 2);
+    packed.factors.assign(packed.columns, 0);
+
+    for (size_type c = 0; c < packed.columns; c++){
+        elements_type* column = packed.data.data() + c * packed.pairs * 2;
+
+        for (size_type p = 0; p < packed.pairs; p++){
+            const elements_type b_even = second[2 * p][c];
+            const elements_type b_odd = second[2 * p + 1][c];
+
+            column[2 * p] = b_odd;
+            column[2 * p + 1] = b_even;
+            packed.factors[c] += b_even * b_odd;
+        }
+    }
+
+    if (packed.inner_size % 2){
+        const auto& b_last = second[packed.inner_size - 1];
+
+        packed.odd_row.assign(b_last.begin(),
+                            b_last.begin() + packed.columns);
+    } else {
+        packed.odd_row.clear();
+    }
+}
+
+skinny_kernel_type GetSkinnyKernel(SimdLevel level, size_type columns){
+#ifdef WINOGRAD_X86
+    if (level == SimdLevel::AVX512 && IsSimdLevelSupported(level)){
+        return SelectColumns<Avx512>(columns);
+    }
+    if (level >= SimdLevel::AVX2 && IsSimdLevelSupported(SimdLevel::AVX2)){
+        return SelectColumns<Avx2>(columns);
+    }
+    if (level >= SimdLevel::SSE2 && IsSimdLevelSupported(SimdLevel::SSE2)){
+        return SelectColumns<Sse2>(columns);
+    }
+#endif
+    return SelectColumns<Scalar>(columns);
+}
+
+void MultiplySkinny(const elements_type* first,
+                    size_type first_ld,
+                    const SkinnyColumns& packed,
+                    size_type row_begin,
+                    size_type row_end,
+                    elements_type* const* result_rows,
+                    skinny_kernel_type kernel){
+    for (size_type i = row_begin; i < row_end; i++){
+        kernel(first + i * first_ld, packed, result_rows[i]);
+    }
+}
+
+}
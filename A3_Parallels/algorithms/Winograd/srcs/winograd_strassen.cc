@@ -0,0 +1,258 @@
+#include "../includes/winograd_strassen.h"
+
+namespace s21::winograd{
+
+StrassenMultiplier::StrassenMultiplier(size_type cutoff,
+                                        size_t threads_count,
+                                        const BlockingParams& blocking,
+                                        micro_kernel_type kernel)
+                            : cutoff_(std::max<size_type>(cutoff, 1)),
+                                threads_count_(threads_count ? threads_count : 1),
+                                blocking_(blocking.Normalized()),
+                                kernel_(kernel),
+                                levels_(0) { }
+
+size_type StrassenMultiplier::Levels(size_type rows, size_type inner,
+                                    size_type columns) const{
+    size_type levels = 0;
+
+    while (levels < STRASSEN_MAX_LEVELS && rows > cutoff_ &&
+            inner > cutoff_ && columns > cutoff_){
+        rows = (rows + 1) / 2;
+        inner = (inner + 1) / 2;
+        columns = (columns + 1) / 2;
+        levels++;
+    }
+    return levels;
+}
+
+void StrassenMultiplier::Multiply(const Matrix<elements_type>& first,
+                                const Matrix<elements_type>& second,
+                                elements_type* const* result_rows){
+    const size_type rows = first.RowsSize();
+    const size_type inner = first.ColumnsSize();
+    const size_type columns = second.ColumnsSize();
+    const bool is_parallel = threads_count_ > 1;
+
+    levels_ = Levels(rows, inner, columns);
+    scratches_.resize(is_parallel ? STRASSEN_PRODUCTS : 1);
+    if (!levels_){
+        LeafScratch& scratch = scratches_.front();
+
+        CalculateRowFactors(first, scratch.row_factors);
+        CalculateColumnFactors(second, scratch.column_factors);
+        PackSecondMatrix(second, scratch.packed);
+        MultiplyBlocked(first.Data(), first.LeadingDimension(),
+                        scratch.packed, blocking_, scratch.row_factors,
+                        scratch.column_factors, 0, rows, result_rows,
+                        kernel_);
+        return;
+    }
+
+    const size_type granularity = size_type(1) << levels_;
+    auto pad = [granularity](size_type size){
+        return (size + granularity - 1) / granularity * granularity;
+    };
+    const size_type padded_rows = pad(rows);
+    const size_type padded_inner = pad(inner);
+    const size_type padded_columns = pad(columns);
+    const bool pad_first = padded_rows != rows || padded_inner != inner;
+    const bool pad_second = padded_inner != inner ||
+                            padded_columns != columns;
+    const size_type temporaries = WorkspaceSize_(
+        0, padded_rows, padded_inner, padded_columns
+    );
+    const size_type required = temporaries +
+                        (pad_first ? padded_rows * padded_inner : 0) +
+                        (pad_second ? padded_inner * padded_columns : 0) +
+                        padded_rows * padded_columns;
+
+    if (workspace_.size() < required) workspace_.resize(required);
+
+    elements_type* free_space = workspace_.data() + temporaries;
+    ConstView a{first.Data(), first.LeadingDimension()};
+    ConstView b{second.Data(), second.LeadingDimension()};
+    View c{free_space, padded_columns};
+
+    free_space += padded_rows * padded_columns;
+    if (pad_first){
+        View padded{free_space, padded_inner};
+
+        CopyPadded_(rows, inner, a, padded_rows, padded_inner, padded);
+        a = padded;
+        free_space += padded_rows * padded_inner;
+    }
+    if (pad_second){
+        View padded{free_space, padded_columns};
+
+        CopyPadded_(inner, columns, b, padded_inner, padded_columns, padded);
+        b = padded;
+    }
+
+    Recurse_(0, padded_rows, padded_inner, padded_columns, a, b, c,
+            workspace_.data(), scratches_.front());
+
+    for (size_type i = 0; i < rows; i++){
+        std::copy(c.data + i * c.ld, c.data + i * c.ld + columns,
+                    result_rows[i]);
+    }
+}
+
+size_type StrassenMultiplier::WorkspaceSize_(size_type level,
+                                            size_type rows,
+                                            size_type inner,
+                                            size_type columns) const{
+    if (level == levels_) return 0;
+
+    const size_type half_rows = rows / 2;
+    const size_type half_inner = inner / 2;
+    const size_type half_columns = columns / 2;
+    const size_type children = level == 0 && threads_count_ > 1 ?
+                                STRASSEN_PRODUCTS : 1;
+
+    return 4 * half_rows * half_inner + 4 * half_inner * half_columns +
+            STRASSEN_PRODUCTS * half_rows * half_columns +
+            children * WorkspaceSize_(level + 1, half_rows, half_inner,
+                                    half_columns);
+}
+
+void StrassenMultiplier::Recurse_(size_type level, size_type rows,
+                                size_type inner, size_type columns,
+                                ConstView a, ConstView b, View c,
+                                elements_type* workspace,
+                                LeafScratch& scratch){
+    if (level == levels_){
+        Leaf_(rows, inner, columns, a, b, c, scratch);
+        return;
+    }
+
+    const size_type m = rows / 2;
+    const size_type k = inner / 2;
+    const size_type n = columns / 2;
+    const ConstView a11 = a.Block(0, 0), a12 = a.Block(0, k),
+                    a21 = a.Block(m, 0), a22 = a.Block(m, k);
+    const ConstView b11 = b.Block(0, 0), b12 = b.Block(0, n),
+                    b21 = b.Block(k, 0), b22 = b.Block(k, n);
+    View s[4], t[4], p[STRASSEN_PRODUCTS];
+
+    for (View& view : s){
+        view = View{workspace, k};
+        workspace += m * k;
+    }
+    for (View& view : t){
+        view = View{workspace, n};
+        workspace += k * n;
+    }
+    for (View& view : p){
+        view = View{workspace, n};
+        workspace += m * n;
+    }
+
+    Combine_<1>(m, k, a21, a22, s[0]);
+    Combine_<-1>(m, k, s[0], a11, s[1]);
+    Combine_<-1>(m, k, a11, a21, s[2]);
+    Combine_<-1>(m, k, a12, s[1], s[3]);
+    Combine_<-1>(k, n, b12, b11, t[0]);
+    Combine_<-1>(k, n, b22, t[0], t[1]);
+    Combine_<-1>(k, n, b22, b12, t[2]);
+    Combine_<-1>(k, n, t[1], b21, t[3]);
+
+    const ConstView operands[STRASSEN_PRODUCTS][2] = {
+        {a11, b11}, {a12, b21}, {s[3], b22}, {a22, t[3]},
+        {s[0], t[0]}, {s[1], t[1]}, {s[2], t[2]}
+    };
+    const size_type child_workspace = WorkspaceSize_(level + 1, m, k, n);
+
+    if (level == 0 && threads_count_ > 1){
+        try{
+            ThreadPool::Instance().ParallelFor(
+                0, STRASSEN_PRODUCTS,
+                [&](size_type product_begin, size_type product_end){
+                    for (size_type product_i = product_begin;
+                            product_i < product_end; product_i++){
+                        Recurse_(level + 1, m, k, n, operands[product_i][0],
+                                operands[product_i][1], p[product_i],
+                                workspace + product_i * child_workspace,
+                                scratches_[product_i]);
+                    }
+                },
+                1,
+                threads_count_
+            );
+        } catch(const std::exception &e){
+            std::string error = "Threads problems: ";
+            PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__, error + e.what());
+        }
+    } else {
+        for (size_type product_i = 0; product_i < STRASSEN_PRODUCTS;
+                product_i++){
+            Recurse_(level + 1, m, k, n, operands[product_i][0],
+                    operands[product_i][1], p[product_i], workspace,
+                    scratch);
+        }
+    }
+
+    // U2 = P1 + P6, U3 = U2 + P7, U4 = U2 + P5
+    Combine_<1>(m, n, p[0], p[5], p[5]);
+    Combine_<1>(m, n, p[5], p[6], p[6]);
+    Combine_<1>(m, n, p[5], p[4], p[5]);
+    // C11 = P1 + P2, C12 = U4 + P3, C21 = U3 - P4, C22 = U3 + P5
+    Combine_<1>(m, n, p[0], p[1], c.Block(0, 0));
+    Combine_<1>(m, n, p[5], p[2], c.Block(0, n));
+    Combine_<-1>(m, n, p[6], p[3], c.Block(m, 0));
+    Combine_<1>(m, n, p[6], p[4], c.Block(m, n));
+}
+
+void StrassenMultiplier::Leaf_(size_type rows, size_type inner,
+                                size_type columns, ConstView a, ConstView b,
+                                View c, LeafScratch& scratch){
+    CalculateRowFactors(a.data, rows, inner, a.ld, scratch.row_factors);
+    CalculateColumnFactors(b.data, inner, columns, b.ld,
+                            scratch.column_factors);
+    PackSecondMatrix(b.data, inner, columns, b.ld, scratch.packed);
+    scratch.result_rows.resize(rows);
+    for (size_type i = 0; i < rows; i++){
+        scratch.result_rows[i] = c.data + i * c.ld;
+    }
+    MultiplyBlocked(a.data, a.ld, scratch.packed, blocking_,
+                    scratch.row_factors, scratch.column_factors, 0, rows,
+                    scratch.result_rows.data(), kernel_);
+}
+
+void StrassenMultiplier::CopyPadded_(size_type rows, size_type columns,
+                                    ConstView source, size_type padded_rows,
+                                    size_type padded_columns,
+                                    View destination){
+    for (size_type i = 0; i < padded_rows; i++){
+        elements_type* row = destination.data + i * destination.ld;
+
+        if (i < rows){
+            const elements_type* source_row = source.data + i * source.ld;
+
+            std::copy(source_row, source_row + columns, row);
+            std::fill(row + columns, row + padded_columns, 0);
+        } else {
+            std::fill(row, row + padded_columns, 0);
+        }
+    }
+}
+
+template < int Sign >
+void StrassenMultiplier::Combine_(size_type rows, size_type columns,
+                                ConstView a, ConstView b, View c){
+    for (size_type i = 0; i < rows; i++){
+        const elements_type* a_row = a.data + i * a.ld;
+        const elements_type* b_row = b.data + i * b.ld;
+        elements_type* c_row = c.data + i * c.ld;
+
+        for (size_type j = 0; j < columns; j++){
+            if constexpr (Sign > 0){
+                c_row[j] = a_row[j] + b_row[j];
+            } else {
+                c_row[j] = a_row[j] - b_row[j];
+            }
+        }
+    }
+}
+
+}
@@ -0,0 +1,245 @@
+#include <set>
+#include <random>
+#include <string>
+#include <fstream>
+#include <iomanip>
+
+#include "../../cli/includes/timer.h"
+#include "../../algorithms/Winograd/includes/winograd.h"
+
+namespace s21::bench{
+
+const int DEFAULT_SIZE = 2048;
+const int DEFAULT_REPEATS = 1;
+
+/**
+ * @return count of physical cores (hyper-threading siblings are counted
+ * once) or hardware_concurrency if topology isn't available
+ */
+unsigned PhysicalCoresCount(){
+    std::set<std::string> siblings;
+    unsigned logical = std::max(1u, std::thread::hardware_concurrency());
+
+    for (unsigned cpu = 0; cpu < logical; cpu++){
+        std::ifstream file(
+            "/sys/devices/system/cpu/cpu" + std::to_string(cpu) +
+            "/topology/thread_siblings_list"
+        );
+        std::string line;
+        if (!file.is_open() || !std::getline(file, line)) return logical;
+        siblings.insert(line);
+    }
+    return siblings.size();
+}
+
+Matrix<double> RandomMatrix(int rows, int columns){
+    std::mt19937 gen(rows * 31 + columns);
+    std::uniform_int_distribution<> distrib(-100, 100);
+    Matrix<double> mtrx(rows, columns);
+
+    for (int row = 0; row < rows; row++){
+        for (double& elem : mtrx[row]){
+            elem = distrib(gen);
+        }
+    }
+    return mtrx;
+}
+
+/**
+ * @return the best of [repeats] durations of [algo] run in microseconds
+ */
+long long Measure(WinogradParent& algo, const Matrix<double>& A,
+                    const Matrix<double>& B, int repeats,
+                    MatrixResult<double>& result){
+    long long best = -1;
+
+    for (int i = 0; i < repeats; i++){
+        Timer timer;
+
+        timer.Start();
+        result = algo.WinogradMultiplication(A, B);
+        timer.End();
+        if (best < 0 || timer.GetDuration() < best) best = timer.GetDuration();
+    }
+    return best;
+}
+
+}
+
+/**
+ * Usage: bench_winograd.out [size] [repeats] [max_threads]
+ * Multiplies two random [size]x[size] matrices by WinogradParallel with
+ * 1, 2, 4, ... threads up to the physical cores count and prints
+ * speedup relatively to the single thread run, then compares single thread
+ * row kernel with the cache-blocked one for every supported SIMD kernel
+ * and with Strassen-Winograd recursion for several cutoffs, and prints
+ * pipeline stages' counters and times of second matrices with up to
+ * SKINNY_MAX_COLUMNS columns against a naive loop
+ */
+int main(int argc, char** argv){
+    using namespace ::s21::bench;
+
+    int size = argc > 1 ? std::stoi(argv[1]) : DEFAULT_SIZE;
+    int repeats = argc > 2 ? std::stoi(argv[2]) : DEFAULT_REPEATS;
+    unsigned max_threads = argc > 3 ?
+                            std::stoi(argv[3]) :
+                            PhysicalCoresCount();
+
+    ::s21::Matrix<double> A = RandomMatrix(size, size);
+    ::s21::Matrix<double> B = RandomMatrix(size, size);
+    ::s21::MatrixResult<double> reference;
+    long long single_duration = 0;
+
+    std::cout
+        << "WinogradParallel " << size << "x" << size
+        << ", physical cores: " << PhysicalCoresCount() << std::endl
+        << "threads\ttime, ms\tspeedup\tefficiency" << std::endl;
+
+    std::vector<unsigned> threads_counts;
+    for (unsigned threads = 1; threads < max_threads; threads *= 2){
+        threads_counts.push_back(threads);
+    }
+    threads_counts.push_back(std::max(1u, max_threads));
+
+    for (unsigned threads : threads_counts){
+        ::s21::WinogradParallel algo(threads);
+        ::s21::MatrixResult<double> result;
+        long long duration = Measure(algo, A, B, repeats, result);
+
+        if (threads == 1){
+            single_duration = duration;
+            reference = std::move(result);
+        } else if (result.matrix_array != reference.matrix_array){
+            std::cerr << "Result mismatch on " << threads << " threads"
+                        << std::endl;
+            return 1;
+        }
+
+        double speedup = static_cast<double>(single_duration) / duration;
+        std::cout
+            << threads << '\t'
+            << std::fixed << std::setprecision(1) << duration / 1000.0 << '\t'
+            << std::setprecision(2) << speedup << '\t'
+            << speedup / threads << std::endl;
+    }
+
+    const ::s21::winograd::BlockingParams blocking =
+                                    ::s21::winograd::BlockingParams::Detect();
+
+    std::cout
+        << "WinogradBlocked (rows " << blocking.rows_block
+        << ", columns " << blocking.columns_block
+        << ", pairs " << blocking.pairs_block << ")" << std::endl
+        << "kernel\ttime, ms\tspeedup of single thread" << std::endl;
+    for (::s21::winograd::SimdLevel level : {
+            ::s21::winograd::SimdLevel::SCALAR,
+            ::s21::winograd::SimdLevel::SSE2,
+            ::s21::winograd::SimdLevel::AVX2,
+            ::s21::winograd::SimdLevel::AVX512
+    }){
+        if (!::s21::winograd::IsSimdLevelSupported(level)) continue;
+
+        ::s21::WinogradBlocked blocked(1, blocking, level);
+        ::s21::MatrixResult<double> result;
+        long long duration = Measure(blocked, A, B, repeats, result);
+
+        // Integer matrices are multiplied exactly by every kernel
+        if (result.matrix_array != reference.matrix_array){
+            std::cerr << "Result mismatch of WinogradBlocked "
+                        << ::s21::winograd::SimdLevelName(level) << std::endl;
+            return 1;
+        }
+        std::cout
+            << ::s21::winograd::SimdLevelName(level) << '\t'
+            << std::setprecision(1) << duration / 1000.0 << '\t'
+            << std::setprecision(2)
+            << static_cast<double>(single_duration) / duration << std::endl;
+    }
+
+    std::cout << "WinogradStrassen" << std::endl
+                << "cutoff\ttime, ms\tspeedup of single thread" << std::endl;
+    for (unsigned cutoff : {128u, 256u, 512u, 1024u}){
+        ::s21::WinogradStrassen strassen(max_threads, cutoff, blocking);
+        ::s21::MatrixResult<double> result;
+        long long duration = Measure(strassen, A, B, repeats, result);
+
+        if (result.matrix_array != reference.matrix_array){
+            std::cerr << "Result mismatch of WinogradStrassen" << std::endl;
+            return 1;
+        }
+        std::cout
+            << cutoff << '\t'
+            << std::setprecision(1) << duration / 1000.0 << '\t'
+            << std::setprecision(2)
+            << static_cast<double>(single_duration) / duration << std::endl;
+    }
+
+    std::cout << "WinograPipelineParallel" << std::endl;
+    for (unsigned compute_stages = 1; compute_stages <= max_threads;
+            compute_stages *= 2){
+        ::s21::WinograPipelineParallel pipeline(compute_stages);
+        ::s21::MatrixResult<double> result;
+        long long duration = Measure(pipeline, A, B, repeats, result);
+
+        if (result.matrix_array != reference.matrix_array){
+            std::cerr << "Result mismatch of WinograPipelineParallel"
+                        << std::endl;
+            return 1;
+        }
+        std::cout
+            << compute_stages << " compute stages: "
+            << std::setprecision(1) << duration / 1000.0 << " ms" << std::endl
+            << "\tstage\tblocks\tinput stalls\toutput stalls\toccupancy"
+            << std::endl;
+        for (const auto& stage : pipeline.Stats()){
+            std::cout
+                << '\t' << stage.role << '\t' << stage.blocks
+                << '\t' << stage.input_stalls << '\t' << stage.output_stalls
+                << '\t' << std::setprecision(2) << stage.input_occupancy
+                << std::endl;
+        }
+    }
+
+    std::cout << "Skinny second matrix, " << size << " rows" << std::endl
+                << "columns\tnaive, ms\tWinogradParallel, ms" << std::endl;
+    for (unsigned columns = 1;
+            columns <= ::s21::winograd::SKINNY_MAX_COLUMNS; columns++){
+        ::s21::Matrix<double> B_skinny = RandomMatrix(size, columns);
+        ::s21::Matrix<double> naive(size, columns);
+        ::s21::WinogradParallel algo(max_threads);
+        ::s21::MatrixResult<double> result;
+        long long naive_duration = -1;
+
+        for (int i = 0; i < repeats; i++){
+            ::s21::Timer timer;
+
+            timer.Start();
+            for (int row = 0; row < size; row++){
+                for (unsigned column = 0; column < columns; column++){
+                    double sum = 0;
+
+                    for (int k = 0; k < size; k++){
+                        sum += A[row][k] * B_skinny[k][column];
+                    }
+                    naive[row][column] = sum;
+                }
+            }
+            timer.End();
+            if (naive_duration < 0 || timer.GetDuration() < naive_duration){
+                naive_duration = timer.GetDuration();
+            }
+        }
+
+        long long duration = Measure(algo, A, B_skinny, repeats, result);
+
+        if (result.matrix_array != naive.ToVector()){
+            std::cerr << "Result mismatch of skinny multiplication"
+                        << std::endl;
+            return 1;
+        }
+        std::cout
+            << columns << '\t'
+            << std::setprecision(2) << naive_duration / 1000.0 << '\t'
+            << duration / 1000.0 << std::endl;
+    }
+}
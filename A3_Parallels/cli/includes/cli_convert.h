@@ -0,0 +1,46 @@
+#ifndef CLI_CONVERT_H
+#define CLI_CONVERT_H
+
+#include <string>
+
+#include "cli.h"
+#include "../../matrix/includes/matrix.h"
+#include "../../matrix/includes/sparse_matrix.h"
+
+namespace s21{
+
+/**
+ * Converter between the text adjacency matrix format and the binary
+ * matrix file format (see matrix_file.h), and between the Matrix Market
+ * format and the binary sparse matrix one
+ */
+class CliConvert : public CLI{
+public:
+    CliConvert() = default;
+    CliConvert(const CliConvert&) = delete;
+    CliConvert(CliConvert&&) = delete;
+    ~CliConvert() = default;
+
+    void run();
+
+private:
+    /**
+     * Converting text [source] into binary [destination] or back
+     */
+    template < class T >
+    void Convert_(bool to_binary, const std::string& source,
+                    const std::string& destination) const;
+
+    /**
+     * Converting Matrix Market [source] into binary sparse [destination]
+     * or back
+     */
+    template < class T >
+    void ConvertSparse_(bool to_binary, const std::string& source,
+                        const std::string& destination) const;
+
+};
+
+}
+
+#endif
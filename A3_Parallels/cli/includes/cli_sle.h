@@ -3,6 +3,9 @@
 
 #include "cli.h"
 #include "../../algorithms/SLE/includes/sle_gaussian.h"
+#include "../../algorithms/SLE/includes/sle_cholesky.h"
+#include "../../algorithms/SLE/includes/sle_krylov.h"
+#include "../../algorithms/SLE/includes/sle_mixed.h"
 
 namespace s21{
 
@@ -15,6 +18,23 @@ public:
 
     void run();
 
+private:
+    /**
+     * Solving sparse SLE of Matrix Market ("*.mtx") or binary sparse
+     * matrix [filepath] by Krylov solvers
+     */
+    void RunSparse_(const std::string& filepath) const;
+
+    /**
+     * @return true if [filepath] keeps a sparse matrix
+     */
+    static bool IsSparseFile_(const std::string& filepath);
+
+    /**
+     * @return true if [filepath] is in the Matrix Market format
+     */
+    static bool IsMatrixMarketFile_(const std::string& filepath);
+
 };
 
 }
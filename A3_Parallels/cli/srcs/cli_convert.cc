@@ -0,0 +1,75 @@
+#include "../includes/cli_convert.h"
+
+namespace s21{
+
+void CliConvert::run(){
+    try {
+        PrintMsg_("Choose conversion:\n\t1 - text to binary\n"
+                    "\t2 - binary to text\n"
+                    "\t3 - Matrix Market to sparse binary\n"
+                    "\t4 - sparse binary to Matrix Market");
+        const int direction = ReadNum_();
+        if (direction < 1 || direction > 4) {
+            throw CliException("Unknown conversion");
+        }
+
+        PrintMsg_("Choose elements type:\n\t1 - int (graphs)\n"
+                    "\t2 - double (SLE, Winograd)");
+        const int elements_type = ReadNum_();
+        if (elements_type != 1 && elements_type != 2) {
+            throw CliException("Unknown elements type");
+        }
+
+        PrintMsg_("Enter source filepath");
+        const std::string source = ReadLine_();
+        PrintMsg_("Enter destination filepath");
+        const std::string destination = ReadLine_();
+
+        const bool to_binary = direction % 2;
+        Timer timer;
+
+        timer.Start();
+        if (direction > 2 && elements_type == 1) {
+            ConvertSparse_<int>(to_binary, source, destination);
+        } else if (direction > 2) {
+            ConvertSparse_<double>(to_binary, source, destination);
+        } else if (elements_type == 1) {
+            Convert_<int>(to_binary, source, destination);
+        } else {
+            Convert_<double>(to_binary, source, destination);
+        }
+        timer.End();
+
+        PrintMsg_("Converted in " +
+                    std::to_string(timer.GetDuration() / 1000) + " ms");
+    } catch (Exception& e) {
+        PrintMsg_(e.GetMessage());
+    }
+}
+
+template < class T >
+void CliConvert::Convert_(bool to_binary, const std::string& source,
+                            const std::string& destination) const{
+    if (to_binary) {
+        Matrix<T>::LoadFromFile(source).SaveToBinaryFile(destination);
+    } else {
+        Matrix<T>::MapFromFile(source).SaveToFile(destination);
+    }
+}
+
+template < class T >
+void CliConvert::ConvertSparse_(bool to_binary, const std::string& source,
+                                const std::string& destination) const{
+    if (to_binary) {
+        SparseMatrix<T>::LoadFromFile(source).SaveToBinaryFile(destination);
+    } else {
+        SparseMatrix<T>::MapFromFile(source).SaveToFile(destination);
+    }
+}
+
+}
+
+int main(){
+    ::s21::CliConvert cli;
+    cli.run();
+}
@@ -7,6 +7,12 @@ void CliSle::run(){
         // Load graph from file
         PrintMsg_("Enter matrix filepath");
         const std::string filepath = ReadLine_();
+
+        if (IsSparseFile_(filepath)){
+            RunSparse_(filepath);
+            return;
+        }
+
         Sle<double> mtrx = Sle<double>::LoadFromFile(filepath);
         
         // Get algo iters count
@@ -18,10 +24,12 @@ void CliSle::run(){
         }
 
         // Execute
-        SleGaussianUsual sle_usual(mtrx);
-        SleGaussianParellel sle_parallel(mtrx);
-        SleResult result_usual, result_parallel;
+        SleResult result_usual, result_parallel, result_blocked;
+        SleResult result_tiled, result_mixed, result_cholesky;
         long long duration_usual = 0, duration_parallel = 0;
+        long long duration_blocked = 0, duration_tiled = 0;
+        long long duration_mixed = 0, duration_cholesky = 0;
+        const bool is_spd_candidate = SleCholesky::IsSpdCandidate(mtrx);
 
         auto run_algo = [](
             SleGaussianParent& sle,
@@ -44,7 +52,12 @@ void CliSle::run(){
             std::cout
                 << '\t' << title << std::endl
                 << "Vertices: " << std::endl
-                << sle_result.equation_roots << std::endl
+                << sle_result.equation_roots << std::endl;
+            if (!sle_result.residual_history.empty()){
+                std::cout << "Residual: "
+                            << sle_result.residual_history.back() << std::endl;
+            }
+            std::cout
                 << "Execution time: " << (time / 1000) << " ms" << std::endl;
         };
 
@@ -52,24 +65,115 @@ void CliSle::run(){
         for (int i = 0; i < iters_count; i++){
             SleGaussianUsual sle_usual(mtrx);
             SleGaussianParellel sle_parallel(mtrx);
+            SleGaussianBlocked sle_blocked(mtrx);
+            SleGaussianTiled sle_tiled(mtrx);
             long long duration_usual_tmp, duration_parallel_tmp;
+            long long duration_blocked_tmp, duration_tiled_tmp;
 
             run_algo(sle_usual, result_usual, duration_usual_tmp);
             run_algo(sle_parallel, result_parallel, duration_parallel_tmp);
+            run_algo(sle_blocked, result_blocked, duration_blocked_tmp);
+            run_algo(sle_tiled, result_tiled, duration_tiled_tmp);
 
             duration_usual += duration_usual_tmp;
             duration_parallel += duration_parallel_tmp;
+            duration_blocked += duration_blocked_tmp;
+            duration_tiled += duration_tiled_tmp;
+
+            SleMixedLu sle_mixed(mtrx);
+            Timer timer;
+
+            timer.Start();
+            result_mixed = sle_mixed.Solve();
+            timer.End();
+            duration_mixed += timer.GetDuration();
+
+            if (!is_spd_candidate) continue;
+
+            SleCholesky sle_cholesky(mtrx);
+
+            timer.Start();
+            result_cholesky = sle_cholesky.Solve();
+            timer.End();
+            duration_cholesky += timer.GetDuration();
         }
 
         // Print results
         print_res("Single thread", result_usual, duration_usual);
         print_res("Multiple threads", result_parallel, duration_parallel);
+        print_res("Blocked LU", result_blocked, duration_blocked);
+        print_res("Tiled LU", result_tiled, duration_tiled);
+        print_res("Mixed LU", result_mixed, duration_mixed);
+        if (is_spd_candidate){
+            print_res("Cholesky", result_cholesky, duration_cholesky);
+        }
 
     } catch (Exception& e) {
         PrintMsg_(e.GetMessage());
     }
 }
 
+void CliSle::RunSparse_(const std::string& filepath) const{
+    using sparse_type = SparseMatrix<double>;
+
+    const sparse_type mtrx = IsMatrixMarketFile_(filepath) ?
+                                sparse_type::LoadFromFile(filepath)
+                                : sparse_type::MapFromFile(filepath);
+
+    PrintMsg_("Enter algorithm iters count");
+
+    const int iters_count = ReadNum_();
+
+    if (iters_count < 1) {
+        throw CliException("Iterations count cannot be non-positive");
+    }
+
+    SleResult result;
+    long long duration = 0;
+
+    for (int i = 0; i < iters_count; i++){
+        SleKrylov sle_krylov(mtrx);
+        Timer timer;
+
+        timer.Start();
+        result = sle_krylov.Solve();
+        timer.End();
+        duration += timer.GetDuration();
+    }
+    std::cout
+        << '\t' << "Krylov" << std::endl
+        << "Vertices: " << std::endl
+        << result.equation_roots << std::endl
+        << "Iterations: " << (result.residual_history.empty() ? 0 :
+                                result.residual_history.size() - 1)
+        << std::endl;
+    if (!result.residual_history.empty()){
+        std::cout << "Residual: " << result.residual_history.back()
+                    << std::endl;
+    }
+    std::cout
+        << "Execution time: " << (duration / 1000.0) << " ms" << std::endl;
+}
+
+bool CliSle::IsSparseFile_(const std::string& filepath){
+    if (IsMatrixMarketFile_(filepath)) return true;
+
+    std::ifstream file(filepath, std::ios::binary);
+    char magic[sizeof(SPARSE_MATRIX_FILE_MAGIC)] = {};
+
+    file.read(magic, sizeof(magic));
+    return file && std::equal(magic, magic + sizeof(magic),
+                                SPARSE_MATRIX_FILE_MAGIC);
+}
+
+bool CliSle::IsMatrixMarketFile_(const std::string& filepath){
+    const std::string extension = ".mtx";
+
+    return filepath.size() >= extension.size() &&
+            !filepath.compare(filepath.size() - extension.size(),
+                                extension.size(), extension);
+}
+
 }
 
 int main(){
@@ -46,10 +46,13 @@ void CliWinograd::run(){
             << std::endl;
 
         // Execute
-        MatrixResult<double> result_usual, result_parallel, result_pipeline;
+        MatrixResult<double> result_usual, result_parallel, result_pipeline,
+                                result_blocked, result_strassen;
         long long duration_usual = 0, 
                     duration_parallel = 0, 
-                    duration_pipeline = 0;
+                    duration_pipeline = 0,
+                    duration_blocked = 0,
+                    duration_strassen = 0;
         
         auto run_algo = [&A, &B](
             WinogradParent& algo, 
@@ -87,23 +90,33 @@ void CliWinograd::run(){
             WinogradUsual win_usual;
             WinogradParallel win_parallel(threads_count);
             WinograPipelineParallel win_pipeline;
+            WinogradBlocked win_blocked(threads_count);
+            WinogradStrassen win_strassen(threads_count);
             long long duration_usual_tmp,
                         duration_parallel_tmp,
-                        duration_pipeline_tmp;
+                        duration_pipeline_tmp,
+                        duration_blocked_tmp,
+                        duration_strassen_tmp;
 
             run_algo(win_usual, result_usual, duration_usual_tmp);
             run_algo(win_parallel, result_parallel, duration_parallel_tmp);
             run_algo(win_pipeline, result_pipeline, duration_pipeline_tmp);
+            run_algo(win_blocked, result_blocked, duration_blocked_tmp);
+            run_algo(win_strassen, result_strassen, duration_strassen_tmp);
 
             duration_usual += duration_usual_tmp;
             duration_parallel += duration_parallel_tmp;
             duration_pipeline += duration_pipeline_tmp;
+            duration_blocked += duration_blocked_tmp;
+            duration_strassen += duration_strassen_tmp;
         }
 
         // Print results
         print_res("Single thread", result_usual, duration_usual);
         print_res("Multiple threads", result_parallel, duration_parallel);
         print_res("Pipeline parallels", result_pipeline, duration_pipeline);
+        print_res("Cache blocked", result_blocked, duration_blocked);
+        print_res("Strassen-Winograd", result_strassen, duration_strassen);
 
     } catch (Exception& e) {
         PrintMsg_(e.GetMessage());
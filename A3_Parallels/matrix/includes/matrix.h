@@ -2,18 +2,35 @@
 #define MATRIX_H
 
 #include <stdexcept>
+#include <algorithm>
 #include <iostream>
 #include <fstream>
+#include <iomanip>
 #include <utility>
 #include <vector>
+#include <limits>
 
+#include "matrix_storage.h"
+#include "matrix_file.h"
+#include "matrix_text.h"
 #include "../../utils/includes/utils.h"
 #include "../../utils/includes/exception.h"
 
 namespace s21{
 
+// Size of Matrix which is known only at runtime
+constexpr std::size_t DYNAMIC_SIZE = std::numeric_limits<std::size_t>::max();
+
+/**
+ * Matrix of [Rows]x[Columns] size known at compile time, see matrix_fixed.h.
+ * Matrix<T> is the runtime-sized one
+ */
+template < class T, std::size_t Rows = DYNAMIC_SIZE,
+            std::size_t Columns = DYNAMIC_SIZE >
+class Matrix;
+
 template < class T >
-class Matrix{
+class Matrix<T, DYNAMIC_SIZE, DYNAMIC_SIZE>{
 public:
     template < typename Type >
     friend std::ostream& ::operator<<(
@@ -22,23 +39,34 @@ public:
     );
 
     using value_type                = T;
+    using pointer                   = value_type*;
+    using const_pointer             = const value_type*;
     using row_matrix_type           = std::vector<value_type>;
     using matrix_type               = std::vector<row_matrix_type>;
+    using storage_type              = std::vector<
+                                        value_type,
+                                        AlignedAllocator<value_type>>;
     using column_size_type          = typename row_matrix_type::size_type;
     using row_size_type             = typename matrix_type::size_type;
-    using reference                 = typename matrix_type::reference;
-    using const_reference           = typename matrix_type::const_reference;
-    using iterator_type             = typename matrix_type::iterator;
-    using const_iterator_type       = typename matrix_type::const_iterator;
-    using reverse_iterator_type     = typename matrix_type::reverse_iterator;
+    using reference                 = RowSpan<value_type>;
+    using const_reference           = RowSpan<const value_type>;
+    using iterator_type             = MatrixRowIterator<value_type>;
+    using const_iterator_type       = MatrixRowIterator<const value_type>;
+    using reverse_iterator_type     = std::reverse_iterator<iterator_type>;
     using reverse_const_iterator_type
-                                = typename matrix_type::const_reverse_iterator;
+                                = std::reverse_iterator<const_iterator_type>;
 
     Matrix() = delete;
-    Matrix(const Matrix& other) = default;
-    Matrix(Matrix&& other) = default;
+    Matrix(const Matrix& other);
+    Matrix(Matrix&& other);
     Matrix(const matrix_type& inp_matrix);
     Matrix(matrix_type&& inp_matrix);
+
+    /**
+     * Creating [rows]x[columns] matrix filled with [value]
+     */
+    Matrix(row_size_type rows, column_size_type columns,
+            const value_type& value = value_type());
     virtual ~Matrix() = default;
 
     Matrix& operator=(const Matrix& other);
@@ -66,6 +94,53 @@ public:
      */
     column_size_type ColumnsSize() const;
 
+    /**
+     * @return the distance in elements between beginnings of two
+     * neighbouring rows (columns count padded to MATRIX_ALIGNMENT bytes)
+     */
+    column_size_type LeadingDimension() const;
+
+    /**
+     * @return pointer to the first element of the first row.
+     * Every row starts on a MATRIX_ALIGNMENT-byte boundary
+     */
+    pointer Data();
+
+    /**
+     * @return const pointer to the first element of the first row
+     */
+    const_pointer Data() const;
+
+    /**
+     * @return span over the [pos] row
+     */
+    reference Row(row_size_type pos);
+
+    /**
+     * @return const span over the [pos] row
+     */
+    const_reference Row(row_size_type pos) const;
+
+    /**
+     * @return true if elements are kept in a mapped binary file
+     */
+    bool IsMapped() const;
+
+    /**
+     * Swapping contents of [first] and [second] rows
+     */
+    void SwapRows(row_size_type first, row_size_type second);
+
+    /**
+     * Removing [col] column, the following columns are shifted left
+     */
+    void EraseColumn(column_size_type col);
+
+    /**
+     * @return copy of Matrix as a vector of rows
+     */
+    matrix_type ToVector() const;
+
     /**
      * @return the reference to the last row in Matrix
      */
@@ -123,20 +198,67 @@ public:
      */
     static Matrix<T> LoadFromFile(const std::string& filename);
 
+    /**
+     * Save matrix into a file [filename] in the adjacency matrix format
+     * @throw MatrixException if the file can't be written
+     */
+    void SaveToFile(const std::string& filename) const;
+
+    /**
+     * Map a binary matrix file [filename] (see matrix_file.h) without
+     * copying its elements: rows are read from the disk on first access.
+     * Changes of the matrix stay in memory and never reach the file
+     * @return new Matrix<T> object
+     * @throw MatrixException if the file is invalid or keeps other type
+     */
+    static Matrix<T> MapFromFile(const std::string& filename);
+
+    /**
+     * Save matrix into a binary matrix file [filename] (see matrix_file.h)
+     * @throw MatrixException if the file can't be created
+     */
+    void SaveToBinaryFile(const std::string& filename) const;
+
 protected:
-    matrix_type matrix_;
+    storage_type data_;
+    // First element: data_ beginning or the mapped file rows
+    pointer elements_ = nullptr;
+    MappedMatrixFile mapping_;
+    row_size_type rows_;
+    column_size_type columns_;
+    column_size_type stride_;
 
-    static Matrix<T> LoadMatrixFromFile_(
-        std::ifstream& input_file_stream,
-        int rows_count,
-        int columns_count
-    );
+    /**
+     * Replacing storage of current Matrix with a copy of [other]'s one
+     */
+    void CopyStorage_(const Matrix& other);
 
     /**
-     * Checking validity of matrix_
-     * @return true if matrix_ is valid
-     * @return false if matrix_ is not valid
-     * @attention the method frees the matrix_ if it's not validity
+     * Taking storage of [other], [other] becomes empty
+     */
+    void MoveStorage_(Matrix&& other);
+
+    /**
+     * Parsing elements of text [file] (see matrix_text.h) into a new
+     * matrix of its header size, checking they are non-negative if
+     * [is_non_negative]
+     * @throw MatrixTextException on invalid elements
+     */
+    static Matrix<T> LoadMatrixFromFile_(const MatrixTextFile& file,
+                                        bool is_non_negative = false);
+
+    /**
+     * Matrix viewing rows of [file] opened in COPY_ON_WRITE mode. Rows
+     * are copied only if the file layout isn't MATRIX_ALIGNMENT-aligned
+     * @throw MatrixException if [file] keeps other elements type
+     */
+    static Matrix<T> MapMatrixFromFile_(MappedMatrixFile&& file);
+
+    /**
+     * Checking validity of Matrix
+     * @return true if Matrix is valid
+     * @return false if Matrix is not valid
+     * @attention the method frees the Matrix if it's not validity
      */
     bool IsMatrixValid_();
 
@@ -158,15 +280,34 @@ private:
      * @throw MatrixException if current matrix is not empty
     */
     void ThrowOnNonEmptyMatrix_() const;
+
+    /**
+     * Dropping the mapped file and pointing elements_ to data_
+     */
+    void UseOwnStorage_();
+
+    /**
+     * Copying rows of [inp_matrix] into the flat storage
+     * @throw MatrixException if rows have different sizes
+     */
+    void FillFromVector_(const matrix_type& inp_matrix);
 };
 
 }
 
 template <typename Type>
 std::ostream& operator<<(std::ostream& out, const ::s21::Matrix<Type>& matrix){
-    return out << matrix.matrix_;
+    for (size_t row = 0; row < matrix.RowsSize(); row++){
+        for (const Type& elem : matrix[row]){
+            out << elem << "\t";
+        }
+        if (row + 1 != matrix.RowsSize()) out << std::endl;
+    }
+
+    return out;
 }
 
 #include "../srcs/matrix_impl.h"
+#include "matrix_fixed.h"
 
 #endif
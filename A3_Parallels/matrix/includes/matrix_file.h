@@ -0,0 +1,282 @@
+#ifndef MATRIX_FILE_H
+#define MATRIX_FILE_H
+
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+#include "matrix_storage.h"
+#include "../../utils/includes/utils.h"
+#include "../../utils/includes/exception.h"
+
+namespace s21{
+
+// First bytes of every binary matrix file
+constexpr char MATRIX_FILE_MAGIC[8] = {'S', '2', '1', 'M', 'T', 'R', 'X', 0};
+constexpr std::uint32_t MATRIX_FILE_VERSION = 1;
+// Elements start on a page boundary, so mapped rows keep MATRIX_ALIGNMENT
+constexpr std::uint64_t MATRIX_FILE_DATA_ALIGNMENT = 4096;
+
+enum class MatrixElementType : std::uint8_t{
+    INT32 = 1,
+    INT64 = 2,
+    FLOAT32 = 3,
+    FLOAT64 = 4
+};
+
+enum class MatrixEndianness : std::uint8_t{
+    LITTLE = 1,
+    BIG = 2
+};
+
+/**
+ * Header of a binary matrix file. Rows follow it at [data_offset] bytes
+ * from the file beginning, every row takes [leading_dimension] elements
+ * and starts on [alignment]-byte boundary, padding is zero
+ */
+struct MatrixFileHeader{
+    char magic[8];
+    std::uint32_t version;
+    MatrixElementType element_type;
+    MatrixEndianness endianness;
+    std::uint16_t reserved;
+    std::uint64_t rows;
+    std::uint64_t columns;
+    std::uint64_t leading_dimension;
+    std::uint64_t alignment;
+    std::uint64_t data_offset;
+    std::uint64_t padding;
+};
+
+static_assert(sizeof(MatrixFileHeader) == 64,
+                "Header layout must not depend on the compiler");
+
+// First bytes of every binary sparse matrix file
+constexpr char SPARSE_MATRIX_FILE_MAGIC[8] = {'S', '2', '1', 'S', 'P', 'R',
+                                                'S', 0};
+constexpr std::uint32_t SPARSE_MATRIX_FILE_VERSION = 1;
+
+/**
+ * Header of a binary sparse matrix file keeping CSR arrays: [rows] + 1
+ * uint64 row offsets, [non_zeros] uint32 column indices and [non_zeros]
+ * values, every array starts at its byte offset from the file beginning
+ * on a MATRIX_ALIGNMENT-byte boundary
+ */
+struct SparseMatrixFileHeader{
+    char magic[8];
+    std::uint32_t version;
+    MatrixElementType element_type;
+    MatrixEndianness endianness;
+    std::uint16_t reserved;
+    std::uint64_t rows;
+    std::uint64_t columns;
+    std::uint64_t non_zeros;
+    std::uint64_t row_offsets_offset;
+    std::uint64_t column_indices_offset;
+    std::uint64_t values_offset;
+};
+
+static_assert(sizeof(SparseMatrixFileHeader) == 64,
+                "Header layout must not depend on the compiler");
+
+/**
+ * @return size of one element of [type] in bytes
+ */
+std::size_t MatrixElementSize(MatrixElementType type);
+
+/**
+ * @return byte order of the running machine
+ */
+MatrixEndianness HostEndianness();
+
+/**
+ * @return element type of [T]
+ */
+template < class T >
+constexpr MatrixElementType MatrixElementTypeOf();
+
+/**
+ * Binary matrix file mapped into memory. Rows are accessed straight in
+ * the mapping, so only touched pages are read from the disk and matrices
+ * larger than RAM can be processed by parts
+ */
+class MappedMatrixFile{
+public:
+    using size_type         = std::uint64_t;
+
+    enum class Mode{
+        READ,
+        READ_WRITE,
+        // Pages are writable, but changes aren't written to the file
+        COPY_ON_WRITE
+    };
+
+    MappedMatrixFile() = default;
+    MappedMatrixFile(const MappedMatrixFile&) = delete;
+    MappedMatrixFile(MappedMatrixFile&& other) noexcept;
+    ~MappedMatrixFile();
+
+    MappedMatrixFile& operator=(const MappedMatrixFile&) = delete;
+    MappedMatrixFile& operator=(MappedMatrixFile&& other) noexcept;
+
+    /**
+     * Creating (or replacing) [filename] with zero [rows]x[columns]
+     * matrix of [element_type] and mapping it for reading and writing
+     * @throw MatrixFileException if the file can't be created
+     */
+    static MappedMatrixFile Create(const std::string& filename,
+                                    size_type rows, size_type columns,
+                                    MatrixElementType element_type);
+
+    /**
+     * Mapping existing [filename] in [mode]
+     * @throw MatrixFileException if the file can't be opened or its
+     * header is invalid, has other byte order or doesn't match file size
+     */
+    static MappedMatrixFile Open(const std::string& filename,
+                                Mode mode = Mode::READ);
+
+    bool IsOpen() const;
+    const MatrixFileHeader& Header() const;
+    size_type RowsSize() const;
+    size_type ColumnsSize() const;
+    size_type LeadingDimension() const;
+    MatrixElementType ElementType() const;
+
+    /**
+     * @return pointer to the first element of [row_i] row
+     */
+    template < class T >
+    const T* Row(size_type row_i) const;
+
+    /**
+     * @return pointer to the first element of [row_i] row
+     * @attention the file must be mapped in READ_WRITE or COPY_ON_WRITE
+     * mode
+     */
+    template < class T >
+    T* Row(size_type row_i);
+
+    /**
+     * Starting write-back of rows [row_begin, row_end) to the disk
+     * without waiting for it
+     */
+    void Flush(size_type row_begin, size_type row_end) const;
+
+    /**
+     * Writing all changes to the disk and unmapping the file
+     */
+    void Close();
+
+private:
+    int descriptor_ = -1;
+    Mode mode_ = Mode::READ;
+    unsigned char* mapping_ = nullptr;
+    std::size_t mapping_size_ = 0;
+    MatrixFileHeader header_ = {};
+
+    /**
+     * Mapping rows range to page-aligned [begin, end) byte offsets
+     */
+    void RowsRange_(size_type row_begin, size_type row_end,
+                    std::size_t& begin, std::size_t& end) const;
+
+    class MatrixFileException : public ::s21::Exception{
+    public:
+        MatrixFileException() = delete;
+        MatrixFileException(const std::string& msg);
+        MatrixFileException(MatrixFileException&&) = delete;
+        ~MatrixFileException() = default;
+
+        MatrixFileException& operator=(const MatrixFileException&) = delete;
+        MatrixFileException& operator=(MatrixFileException&&) = delete;
+
+        std::string GetMessage() const;
+    };
+};
+
+/**
+ * Binary sparse matrix file mapped into memory, CSR arrays are used
+ * straight in the mapping
+ */
+class MappedSparseMatrixFile{
+public:
+    using size_type         = std::uint64_t;
+    using offset_type       = std::uint64_t;
+    using index_type        = std::uint32_t;
+
+    MappedSparseMatrixFile() = default;
+    MappedSparseMatrixFile(const MappedSparseMatrixFile&) = delete;
+    MappedSparseMatrixFile(MappedSparseMatrixFile&& other) noexcept;
+    ~MappedSparseMatrixFile();
+
+    MappedSparseMatrixFile& operator=(const MappedSparseMatrixFile&)
+                                                                = delete;
+    MappedSparseMatrixFile& operator=(MappedSparseMatrixFile&& other)
+                                                                noexcept;
+
+    /**
+     * Creating (or replacing) [filename] with zero arrays of
+     * [rows]x[columns] matrix of [non_zeros] elements of [element_type]
+     * and mapping it for reading and writing
+     * @throw SparseFileException if the file can't be created
+     */
+    static MappedSparseMatrixFile Create(const std::string& filename,
+                                        size_type rows, size_type columns,
+                                        size_type non_zeros,
+                                        MatrixElementType element_type);
+
+    /**
+     * Mapping existing [filename]. Pages are writable, but changes aren't
+     * written to the file
+     * @throw SparseFileException if the file can't be opened or its
+     * header is invalid, has other byte order or doesn't match file size.
+     * Contents of the arrays aren't checked
+     */
+    static MappedSparseMatrixFile Open(const std::string& filename);
+
+    bool IsOpen() const;
+    const SparseMatrixFileHeader& Header() const;
+
+    offset_type* RowOffsets() const;
+    index_type* ColumnIndices() const;
+
+    /**
+     * @return pointer to the first value
+     */
+    template < class T >
+    T* Values() const;
+
+    /**
+     * Writing all changes of a created file to the disk and unmapping
+     * the file
+     */
+    void Close();
+
+private:
+    int descriptor_ = -1;
+    bool is_shared_ = false;
+    unsigned char* mapping_ = nullptr;
+    std::size_t mapping_size_ = 0;
+    SparseMatrixFileHeader header_ = {};
+
+    class SparseFileException : public ::s21::Exception{
+    public:
+        SparseFileException() = delete;
+        SparseFileException(const std::string& msg);
+        SparseFileException(SparseFileException&&) = delete;
+        ~SparseFileException() = default;
+
+        SparseFileException& operator=(const SparseFileException&) = delete;
+        SparseFileException& operator=(SparseFileException&&) = delete;
+
+        std::string GetMessage() const;
+    };
+};
+
+}
+
+#include "../srcs/matrix_file_impl.h"
+
+#endif
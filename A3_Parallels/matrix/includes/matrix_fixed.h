@@ -0,0 +1,89 @@
+#ifndef MATRIX_FIXED_H
+#define MATRIX_FIXED_H
+
+#include <initializer_list>
+#include <cstddef>
+#include <array>
+
+#include "matrix.h"
+
+namespace s21{
+
+/**
+ * [Rows]x[Columns] matrix stored in std::array, usable in constant
+ * expressions. Conversions from and to Matrix<T> are explicit
+ */
+template < class T, std::size_t Rows, std::size_t Columns >
+class Matrix{
+    static_assert(Rows != DYNAMIC_SIZE && Columns != DYNAMIC_SIZE,
+                "Matrix sizes must be either both fixed or both dynamic");
+    static_assert(Rows > 0 && Columns > 0, "Fixed Matrix can't be empty");
+
+public:
+    using value_type                = T;
+    using pointer                   = value_type*;
+    using const_pointer             = const value_type*;
+    using storage_type              = std::array<value_type, Rows * Columns>;
+    using row_size_type             = std::size_t;
+    using column_size_type          = std::size_t;
+    using dynamic_matrix_type       = Matrix<value_type>;
+    using rows_list_type            = std::initializer_list<
+                                        std::initializer_list<value_type>>;
+
+    /**
+     * Creating matrix filled with value_type()
+     */
+    constexpr Matrix();
+
+    /**
+     * Creating matrix from the list of rows
+     * @throw MatrixException if [rows] aren't [Rows]x[Columns]
+     */
+    constexpr Matrix(rows_list_type rows);
+
+    /**
+     * Copying [other] of the same size
+     * @throw MatrixException if sizes of [other] differ
+     */
+    explicit Matrix(const dynamic_matrix_type& other);
+
+    /**
+     * @return runtime-sized copy
+     */
+    explicit operator dynamic_matrix_type() const;
+
+    constexpr pointer operator[](row_size_type pos);
+    constexpr const_pointer operator[](row_size_type pos) const;
+
+    constexpr bool operator==(const Matrix& other) const;
+    constexpr bool operator!=(const Matrix& other) const;
+
+    static constexpr row_size_type RowsSize() { return Rows; }
+    static constexpr column_size_type ColumnsSize() { return Columns; }
+    static constexpr column_size_type LeadingDimension() { return Columns; }
+
+    constexpr pointer Data();
+    constexpr const_pointer Data() const;
+
+private:
+    storage_type data_;
+
+    class MatrixException : public ::s21::Exception{
+    public:
+        MatrixException() = delete;
+        MatrixException(const std::string& msg);
+        MatrixException(MatrixException&&) = delete;
+        ~MatrixException() = default;
+
+        MatrixException& operator=(const MatrixException&) = delete;
+        MatrixException& operator=(MatrixException&&) = delete;
+
+        std::string GetMessage() const;
+    };
+};
+
+}
+
+#include "../srcs/matrix_fixed_impl.h"
+
+#endif
@@ -0,0 +1,203 @@
+#ifndef MATRIX_STORAGE_H
+#define MATRIX_STORAGE_H
+
+#include <stdexcept>
+#include <iterator>
+#include <cstddef>
+#include <numeric>
+#include <type_traits>
+#include <limits>
+#include <new>
+
+namespace s21{
+
+// Alignment of Matrix rows in bytes (one cache line / one AVX-512 register)
+constexpr std::size_t MATRIX_ALIGNMENT = 64;
+
+/**
+ * Allocator returning memory aligned to [Alignment] bytes
+ */
+template < class T, std::size_t Alignment = MATRIX_ALIGNMENT >
+class AlignedAllocator{
+public:
+    using value_type    = T;
+    using size_type     = std::size_t;
+
+    template < class U >
+    struct rebind{
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+    template < class U >
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept { }
+
+    T* allocate(size_type n);
+    void deallocate(T* ptr, size_type n) noexcept;
+};
+
+template < class T, class U, std::size_t Alignment >
+bool operator==(const AlignedAllocator<T, Alignment>&,
+                const AlignedAllocator<U, Alignment>&){
+    return true;
+}
+
+template < class T, class U, std::size_t Alignment >
+bool operator!=(const AlignedAllocator<T, Alignment>&,
+                const AlignedAllocator<U, Alignment>&){
+    return false;
+}
+
+/**
+ * Non-owning view of one contiguous Matrix row
+ */
+template < class T >
+class RowSpan{
+public:
+    using value_type                = std::remove_cv_t<T>;
+    using element_type              = T;
+    using size_type                 = std::size_t;
+    using pointer                   = T*;
+    using reference                 = T&;
+    using iterator                  = T*;
+    using reverse_iterator          = std::reverse_iterator<iterator>;
+
+    RowSpan() = default;
+    RowSpan(pointer data, size_type size) : data_(data), size_(size) { }
+    template < class U,
+        class = std::enable_if_t<std::is_convertible_v<U*, T*>> >
+    RowSpan(const RowSpan<U>& other) : data_(other.data()),
+                                        size_(other.size()) { }
+
+    reference operator[](size_type pos) const { return data_[pos]; }
+
+    /**
+     * @return element on [pos] position
+     * @throw std::out_of_range if [pos] is not inside the row
+     */
+    reference at(size_type pos) const;
+
+    pointer data() const { return data_; }
+    size_type size() const { return size_; }
+    bool empty() const { return !size_; }
+
+    reference front() const { return data_[0]; }
+    reference back() const { return data_[size_ - 1]; }
+
+    iterator begin() const { return data_; }
+    iterator end() const { return data_ + size_; }
+    reverse_iterator rbegin() const { return reverse_iterator(end()); }
+    reverse_iterator rend() const { return reverse_iterator(begin()); }
+
+private:
+    pointer data_ = nullptr;
+    size_type size_ = 0;
+};
+
+/**
+ * Random access iterator over the rows of a flat row-major storage
+ * with [stride] elements between beginnings of neighbouring rows
+ */
+template < class T >
+class MatrixRowIterator{
+public:
+    struct ArrowProxy{
+        RowSpan<T> row;
+
+        const RowSpan<T>* operator->() const { return &row; }
+    };
+
+    using iterator_category         = std::random_access_iterator_tag;
+    using value_type                = RowSpan<T>;
+    using difference_type           = std::ptrdiff_t;
+    using reference                 = RowSpan<T>;
+    using pointer                   = ArrowProxy;
+
+    MatrixRowIterator() = default;
+    MatrixRowIterator(T* row, std::size_t columns, std::size_t stride)
+        : row_(row), columns_(columns), stride_(stride) { }
+    template < class U,
+        class = std::enable_if_t<std::is_convertible_v<U*, T*>> >
+    MatrixRowIterator(const MatrixRowIterator<U>& other)
+        : row_(other.Base()), columns_(other.Columns()),
+            stride_(other.Stride()) { }
+
+    reference operator*() const { return RowSpan<T>(row_, columns_); }
+    pointer operator->() const { return ArrowProxy{**this}; }
+    reference operator[](difference_type n) const { return *(*this + n); }
+
+    MatrixRowIterator& operator++() { row_ += stride_; return *this; }
+    MatrixRowIterator& operator--() { row_ -= stride_; return *this; }
+    MatrixRowIterator operator++(int);
+    MatrixRowIterator operator--(int);
+    MatrixRowIterator& operator+=(difference_type n);
+    MatrixRowIterator& operator-=(difference_type n);
+
+    friend MatrixRowIterator operator+(MatrixRowIterator it,
+                                        difference_type n){
+        return it += n;
+    }
+    friend MatrixRowIterator operator+(difference_type n,
+                                        MatrixRowIterator it){
+        return it += n;
+    }
+    friend MatrixRowIterator operator-(MatrixRowIterator it,
+                                        difference_type n){
+        return it -= n;
+    }
+    friend difference_type operator-(const MatrixRowIterator& lhs,
+                                    const MatrixRowIterator& rhs){
+        return lhs.stride_ ? (lhs.row_ - rhs.row_) /
+                            static_cast<difference_type>(lhs.stride_) : 0;
+    }
+    friend bool operator==(const MatrixRowIterator& lhs,
+                            const MatrixRowIterator& rhs){
+        return lhs.row_ == rhs.row_;
+    }
+    friend bool operator!=(const MatrixRowIterator& lhs,
+                            const MatrixRowIterator& rhs){
+        return lhs.row_ != rhs.row_;
+    }
+    friend bool operator<(const MatrixRowIterator& lhs,
+                            const MatrixRowIterator& rhs){
+        return lhs.row_ < rhs.row_;
+    }
+    friend bool operator>(const MatrixRowIterator& lhs,
+                            const MatrixRowIterator& rhs){
+        return rhs < lhs;
+    }
+    friend bool operator<=(const MatrixRowIterator& lhs,
+                            const MatrixRowIterator& rhs){
+        return !(rhs < lhs);
+    }
+    friend bool operator>=(const MatrixRowIterator& lhs,
+                            const MatrixRowIterator& rhs){
+        return !(lhs < rhs);
+    }
+
+    T* Base() const { return row_; }
+    std::size_t Columns() const { return columns_; }
+    std::size_t Stride() const { return stride_; }
+
+private:
+    T* row_ = nullptr;
+    std::size_t columns_ = 0;
+    std::size_t stride_ = 0;
+};
+
+/**
+ * @return row length padded up so that every row of [T] elements
+ * starts on a [Alignment]-byte boundary
+ */
+template < class T, std::size_t Alignment = MATRIX_ALIGNMENT >
+constexpr std::size_t PaddedStride(std::size_t columns){
+    constexpr std::size_t granularity =
+                            Alignment / std::gcd(Alignment, sizeof(T));
+    return (columns + granularity - 1) / granularity * granularity;
+}
+
+}
+
+#include "../srcs/matrix_storage_impl.h"
+
+#endif
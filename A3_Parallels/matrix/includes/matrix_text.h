@@ -0,0 +1,158 @@
+#ifndef MATRIX_TEXT_H
+#define MATRIX_TEXT_H
+
+#include <type_traits>
+#include <system_error>
+#include <functional>
+#include <algorithm>
+#include <charconv>
+#include <limits>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <thread>
+
+#include "../../utils/includes/utils.h"
+#include "../../utils/includes/exception.h"
+
+namespace s21{
+
+/**
+ * Text matrix file ("rows columns" header followed by whitespace separated
+ * elements) mapped into memory. Elements are parsed by std::from_chars in
+ * line-aligned chunks, one chunk per thread: the first pass counts
+ * elements of every chunk, so the second one knows where each chunk's
+ * elements go and writes them straight into the matrix
+ */
+class MatrixTextFile{
+public:
+    using size_type         = std::size_t;
+
+    // Smaller chunks aren't worth a thread
+    static constexpr size_type MIN_CHUNK_SIZE = size_type(1) << 20;
+
+    /**
+     * Mapping [filename] and parsing its header
+     * @throw MatrixTextException if the file can't be read or its header
+     * isn't two integers
+     */
+    explicit MatrixTextFile(const std::string& filename);
+    MatrixTextFile(const MatrixTextFile&) = delete;
+    ~MatrixTextFile();
+
+    MatrixTextFile& operator=(const MatrixTextFile&) = delete;
+
+    /**
+     * @return rows count from the header, may be non-positive
+     */
+    long long RowsCount() const;
+
+    /**
+     * @return columns count from the header, may be non-positive
+     */
+    long long ColumnsCount() const;
+
+    /**
+     * Parsing RowsCount() x ColumnsCount() elements into rows of [data]
+     * of [leading_dimension] elements by up to [threads_count] threads
+     * @throw MatrixTextException with line and column of the first invalid
+     * or negative (if [is_non_negative]) element, or if elements count
+     * differs from the header one
+     */
+    template < class T >
+    void ParseElements(T* data, size_type leading_dimension,
+                        bool is_non_negative = false,
+                        size_t threads_count =
+                            std::thread::hardware_concurrency()) const;
+
+private:
+    // Elements between line starts [begin, end)
+    struct Chunk{
+        const char* begin;
+        const char* end;
+        // Index of the first element of the chunk in the matrix
+        size_type first_element;
+        size_type elements;
+        // First error in the chunk, nullptr if there is no one
+        const char* error_position;
+        std::string error;
+    };
+
+    std::string filename_;
+    int descriptor_;
+    const char* begin_;
+    const char* end_;
+    // First character after the header
+    const char* elements_begin_;
+    long long rows_count_;
+    long long columns_count_;
+
+    /**
+     * Splitting elements into up to [chunks_count] line-aligned chunks
+     */
+    std::vector<Chunk> SplitChunks_(size_t chunks_count) const;
+
+    /**
+     * Counting elements of [chunk]
+     */
+    static void CountChunk_(Chunk& chunk);
+
+    /**
+     * Calling [process] for every chunk of [chunks], one thread per chunk
+     */
+    template < class Function >
+    static void ForEachChunk_(std::vector<Chunk>& chunks, Function process);
+
+    /**
+     * Parsing elements of [chunk] into [data]
+     */
+    template < class T >
+    void ParseChunk_(Chunk& chunk, T* data, size_type leading_dimension,
+                    bool is_non_negative) const;
+
+    /**
+     * Parsing a number at [begin] into [value]. Integer [value] takes
+     * numbers with a fraction or an exponent truncated
+     */
+    template < class T >
+    static std::from_chars_result ParseNumber_(const char* begin,
+                                                const char* end, T& value);
+
+    /**
+     * @throw MatrixTextException with [msg] and location of [position]
+     */
+    [[noreturn]] void ThrowAt_(const char* position,
+                                const std::string& msg) const;
+
+    /**
+     * Unmapping and closing the file
+     */
+    void Close_();
+
+    class MatrixTextException : public ::s21::Exception{
+    public:
+        MatrixTextException() = delete;
+        MatrixTextException(const std::string& msg);
+        MatrixTextException(MatrixTextException&&) = delete;
+        ~MatrixTextException() = default;
+
+        MatrixTextException& operator=(const MatrixTextException&) = delete;
+        MatrixTextException& operator=(MatrixTextException&&) = delete;
+
+        std::string GetMessage() const;
+    };
+};
+
+/**
+ * @return true if [c] separates elements of a text matrix file: a space
+ * or any other ASCII control character
+ */
+constexpr bool IsMatrixTextSpace(char c){
+    return static_cast<unsigned char>(c) <= ' ';
+}
+
+}
+
+#include "../srcs/matrix_text_impl.h"
+
+#endif
@@ -43,6 +43,15 @@ public:
      */
     static Sle<T> LoadFromFile(const std::string& filename);
 
+    /**
+     * Map SLE from a binary matrix file [filename] without copying it,
+     * see Matrix<T>::MapFromFile
+     * @return new SLE<T> object
+     * @throw SleException on invalid SLE size
+     * @throw MatrixException on invalid file
+     */
+    static Sle<T> MapFromFile(const std::string& filename);
+
 private:
     class SleException : public ::s21::Exception{
     public:
@@ -0,0 +1,262 @@
+#ifndef SPARSE_MATRIX_H
+#define SPARSE_MATRIX_H
+
+#include <type_traits>
+#include <algorithm>
+#include <charconv>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <utility>
+#include <string>
+#include <vector>
+#include <limits>
+
+#include "matrix.h"
+#include "matrix_file.h"
+#include "matrix_storage.h"
+#include "../../utils/includes/exception.h"
+#include "../../utils/includes/thread_pool.h"
+
+namespace s21{
+
+/**
+ * Sparse matrix in the compressed sparse row (CSR) format: nonzeros of
+ * every row are kept one after another sorted by their columns, so the
+ * memory is proportional to the count of nonzeros instead of the size.
+ * CSR arrays of the transposed matrix are the compressed sparse column
+ * (CSC) arrays of this one, see Transpose() and FromCsc(). Arrays are
+ * either owned or kept in a mapped binary file, see MapFromFile()
+ */
+template < class T >
+class SparseMatrix{
+public:
+    using value_type                = T;
+    using size_type                 = std::size_t;
+    using offset_type               = MappedSparseMatrixFile::offset_type;
+    using index_type                = MappedSparseMatrixFile::index_type;
+    using offsets_type              = std::vector<offset_type>;
+    using indices_type              = std::vector<index_type>;
+    using values_type               = std::vector<value_type>;
+    using offsets_span_type         = RowSpan<const offset_type>;
+    using indices_span_type         = RowSpan<const index_type>;
+    using values_span_type          = RowSpan<value_type>;
+    using const_values_span_type    = RowSpan<const value_type>;
+    using dense_type                = Matrix<value_type>;
+
+    /**
+     * Nonzero [value] with [row][column] coordinates
+     */
+    struct Triplet{
+        size_type row;
+        size_type column;
+        value_type value;
+    };
+
+    // Rows of the product claimed by a thread at once
+    static constexpr size_type ROWS_BLOCK = 512;
+
+    /**
+     * Creating [rows]x[columns] matrix of zeros
+     * @throw SparseMatrixException if [columns] don't fit index_type
+     */
+    SparseMatrix(size_type rows, size_type columns);
+
+    /**
+     * Creating [rows]x[columns] matrix from CSR arrays: nonzeros of row i
+     * are [values] and [column_indices] from [row_offsets][i] up to
+     * [row_offsets][i + 1]
+     * @throw SparseMatrixException if the arrays are inconsistent or
+     * columns of a row aren't strictly increasing
+     */
+    SparseMatrix(size_type rows, size_type columns, offsets_type row_offsets,
+                indices_type column_indices, values_type values);
+
+    /**
+     * Copies always own their arrays, even of a mapped matrix
+     */
+    SparseMatrix(const SparseMatrix& other);
+
+    /**
+     * [other] becomes 0x0 matrix
+     */
+    SparseMatrix(SparseMatrix&& other);
+    ~SparseMatrix() = default;
+
+    SparseMatrix& operator=(const SparseMatrix& other);
+    SparseMatrix& operator=(SparseMatrix&& other);
+
+    /**
+     * @return [rows]x[columns] matrix of [triplets] given in any order,
+     * values of repeated coordinates are summed
+     * @throw SparseMatrixException if a triplet is out of the matrix
+     */
+    static SparseMatrix<T> FromTriplets(size_type rows, size_type columns,
+                                        std::vector<Triplet> triplets);
+
+    /**
+     * @return [rows]x[columns] matrix given by CSC arrays: nonzeros of
+     * column j are [values] and [row_indices] from [column_offsets][j] up
+     * to [column_offsets][j + 1]
+     * @throw SparseMatrixException if the arrays are inconsistent or
+     * rows of a column aren't strictly increasing
+     */
+    static SparseMatrix<T> FromCsc(size_type rows, size_type columns,
+                                    offsets_type column_offsets,
+                                    indices_type row_indices,
+                                    values_type values);
+
+    /**
+     * @return nonzeros of [dense], rows are split between threads of
+     * [pool]
+     * @throw SparseMatrixException if columns of [dense] don't fit
+     * index_type
+     */
+    static SparseMatrix<T> FromDense(const dense_type& dense,
+                                    ThreadPool& pool = ThreadPool::Instance());
+
+    /**
+     * Load matrix from a file [filename] in the Matrix Market coordinate
+     * format: "%%MatrixMarket matrix coordinate <field> <symmetry>" banner
+     * (real, double, integer or pattern field, general, symmetric or
+     * skew-symmetric symmetry; general real if it's missing), lines of
+     * "%" comments, "rows columns entries" line and lines of 1-based
+     * "row column value" entries. Stored triangle of a symmetric matrix
+     * is mirrored, values of repeated entries are summed
+     * @return new SparseMatrix<T> object
+     * @throw SparseMatrixException with the line of the first error
+     */
+    static SparseMatrix<T> LoadFromFile(const std::string& filename);
+
+    /**
+     * Save matrix into a file [filename] in the Matrix Market coordinate
+     * general format
+     * @throw SparseMatrixException if the file can't be written
+     */
+    void SaveToFile(const std::string& filename) const;
+
+    /**
+     * Map a binary sparse matrix file [filename] (see matrix_file.h)
+     * without copying its arrays. Changes of the values stay in memory
+     * and never reach the file
+     * @return new SparseMatrix<T> object
+     * @throw SparseMatrixException if the file is invalid, keeps other
+     * type or its arrays are inconsistent
+     */
+    static SparseMatrix<T> MapFromFile(const std::string& filename);
+
+    /**
+     * Save matrix into a binary sparse matrix file [filename]
+     * @throw SparseMatrixException if the file can't be created
+     */
+    void SaveToBinaryFile(const std::string& filename) const;
+
+    size_type RowsSize() const;
+    size_type ColumnsSize() const;
+    size_type NonZerosCount() const;
+
+    /**
+     * @return true if arrays are kept in a mapped binary file
+     */
+    bool IsMapped() const;
+
+    offsets_span_type RowOffsets() const;
+    indices_span_type ColumnIndices() const;
+    const_values_span_type Values() const;
+
+    /**
+     * Access to values for changing them without changing the pattern
+     */
+    values_span_type Values();
+
+    /**
+     * @return value of the cell with [row][column] coordinates
+     */
+    value_type At(size_type row, size_type column) const;
+
+    /**
+     * @return elements of the main diagonal, zeros included
+     */
+    values_type Diagonal() const;
+
+    /**
+     * @return transposed matrix, its CSR arrays are CSC arrays of this one
+     */
+    SparseMatrix<T> Transpose() const;
+
+    /**
+     * @return dense copy of the matrix
+     */
+    dense_type ToDense() const;
+
+    /**
+     * [y] = this * [x] with rows blocks split between threads of [pool]
+     */
+    void Multiply(const value_type* x, value_type* y,
+                    ThreadPool& pool = ThreadPool::Instance()) const;
+
+    /**
+     * @return this * [dense]. Every row of the product is a sum of rows
+     * of [dense] scaled by nonzeros of the row, rows blocks are split
+     * between threads of [pool]
+     * @throw SparseMatrixException if [dense] rows count differs from
+     * columns count of the matrix
+     */
+    dense_type Multiply(const dense_type& dense,
+                        ThreadPool& pool = ThreadPool::Instance()) const;
+
+private:
+    class SparseMatrixException : public ::s21::Exception{
+    public:
+        SparseMatrixException() = delete;
+        SparseMatrixException(const std::string& msg);
+        SparseMatrixException(SparseMatrixException&&) = delete;
+        ~SparseMatrixException() = default;
+
+        SparseMatrixException& operator=(const SparseMatrixException&)
+                                                                = delete;
+        SparseMatrixException& operator=(SparseMatrixException&&) = delete;
+
+        std::string GetMessage() const;
+    };
+
+    size_type rows_;
+    size_type columns_;
+    offsets_type row_offsets_;
+    indices_type column_indices_;
+    values_type values_;
+    // Arrays of a mapped matrix, the vectors above are empty then
+    MappedSparseMatrixFile mapping_;
+
+    /**
+     * Empty matrix to be filled by the factories
+     */
+    SparseMatrix();
+
+    /**
+     * Making the moved-out matrix 0x0
+     */
+    void Clear_();
+
+    /**
+     * Parsing Matrix Market [text] of [filename]
+     * @throw SparseMatrixException with the line of the first error
+     */
+    static SparseMatrix<T> ParseMatrixMarket_(const std::string& filename,
+                                            const std::string& text);
+
+    /**
+     * @throw SparseMatrixException if CSR arrays are inconsistent
+     */
+    void Validate_() const;
+};
+
+}
+
+#include "../srcs/sparse_matrix_impl.h"
+
+#endif
@@ -0,0 +1,451 @@
+#include "../includes/matrix_file.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstring>
+#include <cerrno>
+#include <limits>
+#include <utility>
+
+namespace s21{
+
+namespace {
+
+std::size_t PageSize(){
+    static const std::size_t page_size = sysconf(_SC_PAGESIZE);
+
+    return page_size;
+}
+
+std::string SystemError(const std::string& msg, const std::string& filename){
+    return msg + " '" + filename + "': " + std::strerror(errno);
+}
+
+std::uint64_t RoundUp(std::uint64_t value, std::uint64_t step){
+    return (value + step - 1) / step * step;
+}
+
+static_assert(sizeof(MatrixFileHeader) == sizeof(SparseMatrixFileHeader),
+                "Arrays of both files start after the same header size");
+
+/**
+ * @return true if [count] elements of [element_size] bytes starting at
+ * [offset] are inside [file_size] bytes after the header and aligned for
+ * the elements
+ */
+bool IsArrayInFile(std::uint64_t offset, std::uint64_t count,
+                    std::uint64_t element_size, std::uint64_t file_size){
+    return offset >= sizeof(MatrixFileHeader) &&
+            offset % element_size == 0 && offset <= file_size &&
+            count <= (file_size - offset) / element_size;
+}
+
+}
+
+std::size_t MatrixElementSize(MatrixElementType type){
+    switch (type){
+        case MatrixElementType::INT32: return sizeof(std::int32_t);
+        case MatrixElementType::INT64: return sizeof(std::int64_t);
+        case MatrixElementType::FLOAT32: return sizeof(float);
+        case MatrixElementType::FLOAT64: return sizeof(double);
+    }
+    return 0;
+}
+
+MatrixEndianness HostEndianness(){
+    const std::uint16_t probe = 1;
+    unsigned char first_byte;
+
+    std::memcpy(&first_byte, &probe, 1);
+    return first_byte ? MatrixEndianness::LITTLE : MatrixEndianness::BIG;
+}
+
+MappedMatrixFile::MappedMatrixFile(MappedMatrixFile&& other) noexcept{
+    *this = std::move(other);
+}
+
+MappedMatrixFile::~MappedMatrixFile(){
+    Close();
+}
+
+MappedMatrixFile& MappedMatrixFile::operator=(
+                                        MappedMatrixFile&& other) noexcept{
+    if (this != &other){
+        Close();
+        std::swap(descriptor_, other.descriptor_);
+        std::swap(mode_, other.mode_);
+        std::swap(mapping_, other.mapping_);
+        std::swap(mapping_size_, other.mapping_size_);
+        std::swap(header_, other.header_);
+    }
+    return *this;
+}
+
+MappedMatrixFile MappedMatrixFile::Create(const std::string& filename,
+                                        size_type rows, size_type columns,
+                                        MatrixElementType element_type){
+    const std::size_t element_size = MatrixElementSize(element_type);
+
+    if (!rows || !columns || !element_size){
+        throw MatrixFileException(
+            "Invalid matrix: Sizes must be positive and type known"
+        );
+    }
+
+    MatrixFileHeader header = {};
+
+    std::memcpy(header.magic, MATRIX_FILE_MAGIC, sizeof(header.magic));
+    header.version = MATRIX_FILE_VERSION;
+    header.element_type = element_type;
+    header.endianness = HostEndianness();
+    header.rows = rows;
+    header.columns = columns;
+    header.alignment = MATRIX_ALIGNMENT;
+    header.leading_dimension = (columns * element_size + MATRIX_ALIGNMENT - 1)
+                                / MATRIX_ALIGNMENT * MATRIX_ALIGNMENT /
+                                element_size;
+    header.data_offset = MATRIX_FILE_DATA_ALIGNMENT;
+
+    MappedMatrixFile file;
+    const std::size_t file_size = header.data_offset +
+                                rows * header.leading_dimension * element_size;
+
+    file.descriptor_ = ::open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC,
+                                0644);
+    if (file.descriptor_ < 0){
+        throw MatrixFileException(SystemError("Cannot create file", filename));
+    }
+    if (::ftruncate(file.descriptor_, file_size)){
+        throw MatrixFileException(SystemError("Cannot resize file", filename));
+    }
+
+    void* mapping = ::mmap(nullptr, file_size, PROT_READ | PROT_WRITE,
+                            MAP_SHARED, file.descriptor_, 0);
+
+    if (mapping == MAP_FAILED){
+        throw MatrixFileException(SystemError("Cannot map file", filename));
+    }
+    file.mode_ = Mode::READ_WRITE;
+    file.mapping_ = static_cast<unsigned char*>(mapping);
+    file.mapping_size_ = file_size;
+    file.header_ = header;
+    std::memcpy(file.mapping_, &header, sizeof(header));
+    return file;
+}
+
+MappedMatrixFile MappedMatrixFile::Open(const std::string& filename,
+                                        Mode mode){
+    MappedMatrixFile file;
+    struct stat file_stat;
+
+    file.descriptor_ = ::open(filename.c_str(),
+                            mode == Mode::READ_WRITE ? O_RDWR : O_RDONLY);
+    if (file.descriptor_ < 0){
+        throw MatrixFileException(SystemError("Cannot open file", filename));
+    }
+    if (::fstat(file.descriptor_, &file_stat) ||
+            static_cast<std::size_t>(file_stat.st_size) <
+                sizeof(MatrixFileHeader)){
+        throw MatrixFileException("Invalid file: No header in " + filename);
+    }
+
+    const std::size_t file_size = file_stat.st_size;
+    void* mapping = ::mmap(
+        nullptr, file_size,
+        mode == Mode::READ ? PROT_READ : PROT_READ | PROT_WRITE,
+        mode == Mode::COPY_ON_WRITE ? MAP_PRIVATE : MAP_SHARED,
+        file.descriptor_, 0
+    );
+
+    if (mapping == MAP_FAILED){
+        throw MatrixFileException(SystemError("Cannot map file", filename));
+    }
+    file.mode_ = mode;
+    file.mapping_ = static_cast<unsigned char*>(mapping);
+    file.mapping_size_ = file_size;
+    std::memcpy(&file.header_, file.mapping_, sizeof(MatrixFileHeader));
+
+    const MatrixFileHeader& header = file.header_;
+    const std::size_t element_size = MatrixElementSize(header.element_type);
+
+    if (std::memcmp(header.magic, MATRIX_FILE_MAGIC, sizeof(header.magic))){
+        throw MatrixFileException("Invalid file: Not a matrix file");
+    }
+    if (header.version != MATRIX_FILE_VERSION){
+        throw MatrixFileException("Invalid file: Unsupported version");
+    }
+    if (header.endianness != HostEndianness()){
+        throw MatrixFileException("Invalid file: Byte order differs from "
+                                    "the machine one");
+    }
+    if (!element_size || !header.rows || !header.columns ||
+            header.leading_dimension < header.columns ||
+            header.data_offset % MATRIX_ALIGNMENT){
+        throw MatrixFileException("Invalid file: Broken header");
+    }
+    if (header.leading_dimension >
+                std::numeric_limits<std::uint64_t>::max() / header.rows ||
+            !IsArrayInFile(header.data_offset,
+                            header.rows * header.leading_dimension,
+                            element_size, file_size)){
+        throw MatrixFileException("Invalid file: File is shorter than "
+                                    "its matrix");
+    }
+    return file;
+}
+
+bool MappedMatrixFile::IsOpen() const{
+    return mapping_ != nullptr;
+}
+
+const MatrixFileHeader& MappedMatrixFile::Header() const{
+    return header_;
+}
+
+MappedMatrixFile::size_type MappedMatrixFile::RowsSize() const{
+    return header_.rows;
+}
+
+MappedMatrixFile::size_type MappedMatrixFile::ColumnsSize() const{
+    return header_.columns;
+}
+
+MappedMatrixFile::size_type MappedMatrixFile::LeadingDimension() const{
+    return header_.leading_dimension;
+}
+
+MatrixElementType MappedMatrixFile::ElementType() const{
+    return header_.element_type;
+}
+
+void MappedMatrixFile::Flush(size_type row_begin, size_type row_end) const{
+    std::size_t begin, end;
+
+    if (mode_ != Mode::READ_WRITE) return;
+    RowsRange_(row_begin, row_end, begin, end);
+    if (begin < end) ::msync(mapping_ + begin, end - begin, MS_ASYNC);
+}
+
+void MappedMatrixFile::Close(){
+    if (mapping_){
+        if (mode_ == Mode::READ_WRITE){
+            ::msync(mapping_, mapping_size_, MS_SYNC);
+        }
+        ::munmap(mapping_, mapping_size_);
+    }
+    if (descriptor_ >= 0) ::close(descriptor_);
+    descriptor_ = -1;
+    mapping_ = nullptr;
+    mapping_size_ = 0;
+    header_ = MatrixFileHeader{};
+}
+
+void MappedMatrixFile::RowsRange_(size_type row_begin, size_type row_end,
+                                std::size_t& begin, std::size_t& end) const{
+    const std::size_t row_bytes = header_.leading_dimension *
+                                    MatrixElementSize(header_.element_type);
+
+    row_end = std::min(row_end, header_.rows);
+    if (!mapping_ || row_begin >= row_end){
+        begin = end = 0;
+        return;
+    }
+    begin = (header_.data_offset + row_begin * row_bytes) / PageSize() *
+            PageSize();
+    end = std::min(mapping_size_, header_.data_offset + row_end * row_bytes);
+}
+
+MappedMatrixFile::MatrixFileException::MatrixFileException(
+                                                const std::string& msg)
+    : ::s21::Exception(msg) {
+
+}
+
+std::string MappedMatrixFile::MatrixFileException::GetMessage() const{
+    return ::s21::Exception::msg_;
+}
+
+MappedSparseMatrixFile::MappedSparseMatrixFile(
+                                MappedSparseMatrixFile&& other) noexcept{
+    *this = std::move(other);
+}
+
+MappedSparseMatrixFile::~MappedSparseMatrixFile(){
+    Close();
+}
+
+MappedSparseMatrixFile& MappedSparseMatrixFile::operator=(
+                                MappedSparseMatrixFile&& other) noexcept{
+    if (this != &other){
+        Close();
+        std::swap(descriptor_, other.descriptor_);
+        std::swap(is_shared_, other.is_shared_);
+        std::swap(mapping_, other.mapping_);
+        std::swap(mapping_size_, other.mapping_size_);
+        std::swap(header_, other.header_);
+    }
+    return *this;
+}
+
+MappedSparseMatrixFile MappedSparseMatrixFile::Create(
+                                        const std::string& filename,
+                                        size_type rows, size_type columns,
+                                        size_type non_zeros,
+                                        MatrixElementType element_type){
+    const std::size_t element_size = MatrixElementSize(element_type);
+
+    if (!rows || !columns || !element_size){
+        throw SparseFileException(
+            "Invalid matrix: Sizes must be positive and type known"
+        );
+    }
+
+    SparseMatrixFileHeader header = {};
+
+    std::memcpy(header.magic, SPARSE_MATRIX_FILE_MAGIC, sizeof(header.magic));
+    header.version = SPARSE_MATRIX_FILE_VERSION;
+    header.element_type = element_type;
+    header.endianness = HostEndianness();
+    header.rows = rows;
+    header.columns = columns;
+    header.non_zeros = non_zeros;
+    header.row_offsets_offset = RoundUp(sizeof(header), MATRIX_ALIGNMENT);
+    header.column_indices_offset = RoundUp(
+        header.row_offsets_offset + (rows + 1) * sizeof(offset_type),
+        MATRIX_ALIGNMENT
+    );
+    header.values_offset = RoundUp(
+        header.column_indices_offset + non_zeros * sizeof(index_type),
+        MATRIX_ALIGNMENT
+    );
+
+    MappedSparseMatrixFile file;
+    const std::size_t file_size = header.values_offset +
+                                    non_zeros * element_size;
+
+    file.descriptor_ = ::open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC,
+                                0644);
+    if (file.descriptor_ < 0){
+        throw SparseFileException(SystemError("Cannot create file", filename));
+    }
+    if (::ftruncate(file.descriptor_, file_size)){
+        throw SparseFileException(SystemError("Cannot resize file", filename));
+    }
+
+    void* mapping = ::mmap(nullptr, file_size, PROT_READ | PROT_WRITE,
+                            MAP_SHARED, file.descriptor_, 0);
+
+    if (mapping == MAP_FAILED){
+        throw SparseFileException(SystemError("Cannot map file", filename));
+    }
+    file.is_shared_ = true;
+    file.mapping_ = static_cast<unsigned char*>(mapping);
+    file.mapping_size_ = file_size;
+    file.header_ = header;
+    std::memcpy(file.mapping_, &header, sizeof(header));
+    return file;
+}
+
+MappedSparseMatrixFile MappedSparseMatrixFile::Open(
+                                                const std::string& filename){
+    MappedSparseMatrixFile file;
+    struct stat file_stat;
+
+    file.descriptor_ = ::open(filename.c_str(), O_RDONLY);
+    if (file.descriptor_ < 0){
+        throw SparseFileException(SystemError("Cannot open file", filename));
+    }
+    if (::fstat(file.descriptor_, &file_stat) ||
+            static_cast<std::size_t>(file_stat.st_size) <
+                sizeof(SparseMatrixFileHeader)){
+        throw SparseFileException("Invalid file: No header in " + filename);
+    }
+
+    const std::size_t file_size = file_stat.st_size;
+    void* mapping = ::mmap(nullptr, file_size, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE, file.descriptor_, 0);
+
+    if (mapping == MAP_FAILED){
+        throw SparseFileException(SystemError("Cannot map file", filename));
+    }
+    file.mapping_ = static_cast<unsigned char*>(mapping);
+    file.mapping_size_ = file_size;
+    std::memcpy(&file.header_, file.mapping_, sizeof(SparseMatrixFileHeader));
+
+    const SparseMatrixFileHeader& header = file.header_;
+    const std::size_t element_size = MatrixElementSize(header.element_type);
+
+    if (std::memcmp(header.magic, SPARSE_MATRIX_FILE_MAGIC,
+                    sizeof(header.magic))){
+        throw SparseFileException("Invalid file: Not a sparse matrix file");
+    }
+    if (header.version != SPARSE_MATRIX_FILE_VERSION){
+        throw SparseFileException("Invalid file: Unsupported version");
+    }
+    if (header.endianness != HostEndianness()){
+        throw SparseFileException("Invalid file: Byte order differs from "
+                                    "the machine one");
+    }
+    if (!element_size || !header.rows || !header.columns ||
+            header.rows == std::numeric_limits<size_type>::max()){
+        throw SparseFileException("Invalid file: Broken header");
+    }
+    if (!IsArrayInFile(header.row_offsets_offset, header.rows + 1,
+                        sizeof(offset_type), file_size) ||
+            !IsArrayInFile(header.column_indices_offset, header.non_zeros,
+                            sizeof(index_type), file_size) ||
+            !IsArrayInFile(header.values_offset, header.non_zeros,
+                            element_size, file_size)){
+        throw SparseFileException("Invalid file: File is shorter than "
+                                    "its matrix");
+    }
+    return file;
+}
+
+bool MappedSparseMatrixFile::IsOpen() const{
+    return mapping_ != nullptr;
+}
+
+const SparseMatrixFileHeader& MappedSparseMatrixFile::Header() const{
+    return header_;
+}
+
+MappedSparseMatrixFile::offset_type*
+                                MappedSparseMatrixFile::RowOffsets() const{
+    return reinterpret_cast<offset_type*>(mapping_ +
+                                            header_.row_offsets_offset);
+}
+
+MappedSparseMatrixFile::index_type*
+                                MappedSparseMatrixFile::ColumnIndices() const{
+    return reinterpret_cast<index_type*>(mapping_ +
+                                            header_.column_indices_offset);
+}
+
+void MappedSparseMatrixFile::Close(){
+    if (mapping_){
+        if (is_shared_) ::msync(mapping_, mapping_size_, MS_SYNC);
+        ::munmap(mapping_, mapping_size_);
+    }
+    if (descriptor_ >= 0) ::close(descriptor_);
+    descriptor_ = -1;
+    is_shared_ = false;
+    mapping_ = nullptr;
+    mapping_size_ = 0;
+    header_ = SparseMatrixFileHeader{};
+}
+
+MappedSparseMatrixFile::SparseFileException::SparseFileException(
+                                                const std::string& msg)
+    : ::s21::Exception(msg) {
+
+}
+
+std::string MappedSparseMatrixFile::SparseFileException::GetMessage() const{
+    return ::s21::Exception::msg_;
+}
+
+}
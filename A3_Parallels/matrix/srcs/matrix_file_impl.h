@@ -0,0 +1,52 @@
+#ifndef MATRIX_FILE_H
+#error 'matrix_file_impl.h' is not supposed to be included directly. \
+        Include 'matrix_file.h' instead.
+#endif
+
+namespace s21{
+
+template < class T >
+constexpr MatrixElementType MatrixElementTypeOf(){
+    static_assert(std::is_same_v<T, std::int32_t> ||
+                    std::is_same_v<T, std::int64_t> ||
+                    std::is_same_v<T, float> || std::is_same_v<T, double>,
+                    "Binary matrix files keep int32, int64, float or double");
+
+    if constexpr (std::is_same_v<T, std::int32_t>){
+        return MatrixElementType::INT32;
+    } else if constexpr (std::is_same_v<T, std::int64_t>){
+        return MatrixElementType::INT64;
+    } else if constexpr (std::is_same_v<T, float>){
+        return MatrixElementType::FLOAT32;
+    } else {
+        return MatrixElementType::FLOAT64;
+    }
+}
+
+template < class T >
+const T* MappedMatrixFile::Row(size_type row_i) const{
+    if (MatrixElementTypeOf<T>() != header_.element_type){
+        throw MatrixFileException("Requested type differs from file one");
+    }
+    return reinterpret_cast<const T*>(
+        mapping_ + header_.data_offset +
+        row_i * header_.leading_dimension * sizeof(T)
+    );
+}
+
+template < class T >
+T* MappedMatrixFile::Row(size_type row_i){
+    return const_cast<T*>(
+        static_cast<const MappedMatrixFile*>(this)->Row<T>(row_i)
+    );
+}
+
+template < class T >
+T* MappedSparseMatrixFile::Values() const{
+    if (MatrixElementTypeOf<T>() != header_.element_type){
+        throw SparseFileException("Requested type differs from file one");
+    }
+    return reinterpret_cast<T*>(mapping_ + header_.values_offset);
+}
+
+}
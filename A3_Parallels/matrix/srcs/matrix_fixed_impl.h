@@ -0,0 +1,104 @@
+#ifndef MATRIX_FIXED_H
+#error 'matrix_fixed_impl.h' is not supposed to be included directly. \
+        Include 'matrix_fixed.h' instead.
+#endif
+
+namespace s21{
+
+template < class T, std::size_t Rows, std::size_t Columns >
+constexpr Matrix<T, Rows, Columns>::Matrix() : data_{} { }
+
+template < class T, std::size_t Rows, std::size_t Columns >
+constexpr Matrix<T, Rows, Columns>::Matrix(rows_list_type rows) : data_{}{
+    if (rows.size() != Rows){
+        throw MatrixException("Invalid rows count");
+    }
+
+    row_size_type row_i = 0;
+    for (const std::initializer_list<value_type>& row : rows){
+        if (row.size() != Columns){
+            throw MatrixException("Invalid columns count");
+        }
+
+        column_size_type col_i = 0;
+        for (const value_type& elem : row){
+            data_[row_i * Columns + col_i++] = elem;
+        }
+        row_i++;
+    }
+}
+
+template < class T, std::size_t Rows, std::size_t Columns >
+Matrix<T, Rows, Columns>::Matrix(const dynamic_matrix_type& other) : data_{}{
+    if (other.RowsSize() != Rows || other.ColumnsSize() != Columns){
+        throw MatrixException(
+            "Invalid matrix: Size differs from the fixed one"
+        );
+    }
+    for (row_size_type row_i = 0; row_i < Rows; row_i++){
+        std::copy(other[row_i].begin(), other[row_i].end(),
+                    data_.begin() + row_i * Columns);
+    }
+}
+
+template < class T, std::size_t Rows, std::size_t Columns >
+Matrix<T, Rows, Columns>::operator dynamic_matrix_type() const{
+    dynamic_matrix_type dynamic(Rows, Columns);
+
+    for (row_size_type row_i = 0; row_i < Rows; row_i++){
+        std::copy(data_.begin() + row_i * Columns,
+                    data_.begin() + (row_i + 1) * Columns,
+                    dynamic[row_i].begin());
+    }
+    return dynamic;
+}
+
+template < class T, std::size_t Rows, std::size_t Columns >
+constexpr typename Matrix<T, Rows, Columns>::pointer
+                Matrix<T, Rows, Columns>::operator[](row_size_type pos){
+    return data_.data() + pos * Columns;
+}
+
+template < class T, std::size_t Rows, std::size_t Columns >
+constexpr typename Matrix<T, Rows, Columns>::const_pointer
+            Matrix<T, Rows, Columns>::operator[](row_size_type pos) const{
+    return data_.data() + pos * Columns;
+}
+
+template < class T, std::size_t Rows, std::size_t Columns >
+constexpr bool Matrix<T, Rows, Columns>::operator==(
+                                                const Matrix& other) const{
+    for (std::size_t i = 0; i < Rows * Columns; i++){
+        if (data_[i] != other.data_[i]) return false;
+    }
+    return true;
+}
+
+template < class T, std::size_t Rows, std::size_t Columns >
+constexpr bool Matrix<T, Rows, Columns>::operator!=(
+                                                const Matrix& other) const{
+    return !(*this == other);
+}
+
+template < class T, std::size_t Rows, std::size_t Columns >
+constexpr typename Matrix<T, Rows, Columns>::pointer
+                                    Matrix<T, Rows, Columns>::Data(){
+    return data_.data();
+}
+
+template < class T, std::size_t Rows, std::size_t Columns >
+constexpr typename Matrix<T, Rows, Columns>::const_pointer
+                                    Matrix<T, Rows, Columns>::Data() const{
+    return data_.data();
+}
+
+template < class T, std::size_t Rows, std::size_t Columns >
+Matrix<T, Rows, Columns>::MatrixException::MatrixException(
+                            const std::string& msg) : ::s21::Exception(msg) { }
+
+template < class T, std::size_t Rows, std::size_t Columns >
+std::string Matrix<T, Rows, Columns>::MatrixException::GetMessage() const{
+    return ::s21::Exception::msg_;
+}
+
+}
@@ -6,20 +6,45 @@
 namespace s21{
 
 template< class T >
-Matrix<T>::Matrix(const matrix_type& inp_matrix) : matrix_(inp_matrix){
-    
+Matrix<T>::Matrix(const Matrix& other) : rows_(0), columns_(0), stride_(0){
+    CopyStorage_(other);
 }
 
 template< class T >
-Matrix<T>::Matrix(matrix_type&& inp_matrix) : matrix_(std::move(inp_matrix)){ 
-    
+Matrix<T>::Matrix(Matrix&& other) : rows_(0), columns_(0), stride_(0){
+    MoveStorage_(std::move(other));
+}
+
+template< class T >
+Matrix<T>::Matrix(const matrix_type& inp_matrix)
+    : rows_(0), columns_(0), stride_(0){
+    FillFromVector_(inp_matrix);
+}
+
+template< class T >
+Matrix<T>::Matrix(matrix_type&& inp_matrix)
+    : rows_(0), columns_(0), stride_(0){
+    FillFromVector_(inp_matrix);
+    inp_matrix.clear();
+}
+
+template< class T >
+Matrix<T>::Matrix(row_size_type rows, column_size_type columns,
+                    const value_type& value)
+    : rows_(rows), columns_(columns),
+        stride_(PaddedStride<value_type>(columns ? columns : 1)){
+    data_.assign(rows_ * stride_, value_type());
+    elements_ = data_.data();
+    for (row_size_type row = 0; row < rows_; row++){
+        std::fill_n(elements_ + row * stride_, columns_, value);
+    }
 }
 
 template< class T >
 Matrix<T>& Matrix<T>::operator=(const Matrix<T>& other){
     if (this == &other) return *this;
     ThrowOnNonEmptyMatrix_();
-    matrix_ = other.matrix_;
+    CopyStorage_(other);
     return *this;
 }
 
@@ -27,170 +52,285 @@ template< class T >
 Matrix<T>& Matrix<T>::operator=(Matrix<T>&& other){
     if (this == &other) return *this;
     ThrowOnNonEmptyMatrix_();
-    matrix_ = std::move(other.matrix_);
+    MoveStorage_(std::move(other));
     return *this;
 }
 
 template< class T >
 typename Matrix<T>::reference Matrix<T>::operator[](row_size_type pos){
-    return matrix_.operator[](pos);
+    return reference(elements_ + pos * stride_, columns_);
 }
 
 template< class T >
 typename Matrix<T>::const_reference Matrix<T>::operator[](
                                                     row_size_type pos) const{
-    return matrix_.operator[](pos);
+    return const_reference(elements_ + pos * stride_, columns_);
 }
 
 template< class T >
 typename Matrix<T>::value_type Matrix<T>::At(row_size_type row, 
                                             column_size_type col){
-    return matrix_[row][col];
+    return elements_[row * stride_ + col];
 }
 
 template< class T >
 typename Matrix<T>::value_type Matrix<T>::At(row_size_type row, 
                                             column_size_type col) const{
-    return matrix_[row][col];
+    return elements_[row * stride_ + col];
 }
 
 template< class T >
 typename Matrix<T>::row_size_type Matrix<T>::RowsSize() const{
-    return matrix_.size();
+    return rows_;
 }
 
 template< class T >
 typename Matrix<T>::reference Matrix<T>::Back(){
-    return matrix_.back();
+    return operator[](rows_ - 1);
 }
 
 template< class T >
 typename Matrix<T>::const_reference Matrix<T>::Back() const{
-    return matrix_.back();
+    return operator[](rows_ - 1);
 }
 
 template< class T >
 typename Matrix<T>::column_size_type Matrix<T>::ColumnsSize() const{
-    return matrix_.size() ? matrix_.begin()->size() : 0;
+    return rows_ ? columns_ : 0;
+}
+
+template< class T >
+typename Matrix<T>::column_size_type Matrix<T>::LeadingDimension() const{
+    return stride_;
+}
+
+template< class T >
+typename Matrix<T>::pointer Matrix<T>::Data(){
+    return elements_;
+}
+
+template< class T >
+typename Matrix<T>::const_pointer Matrix<T>::Data() const{
+    return elements_;
+}
+
+template< class T >
+typename Matrix<T>::reference Matrix<T>::Row(row_size_type pos){
+    return operator[](pos);
+}
+
+template< class T >
+typename Matrix<T>::const_reference Matrix<T>::Row(row_size_type pos) const{
+    return operator[](pos);
+}
+
+template< class T >
+bool Matrix<T>::IsMapped() const{
+    return mapping_.IsOpen();
+}
+
+template< class T >
+void Matrix<T>::SwapRows(row_size_type first, row_size_type second){
+    if (first == second) return;
+    std::swap_ranges(
+        elements_ + first * stride_,
+        elements_ + first * stride_ + columns_,
+        elements_ + second * stride_
+    );
+}
+
+template< class T >
+void Matrix<T>::EraseColumn(column_size_type col){
+    for (row_size_type row = 0; row < rows_; row++){
+        pointer row_ptr = elements_ + row * stride_;
+        std::move(row_ptr + col + 1, row_ptr + columns_, row_ptr + col);
+        row_ptr[columns_ - 1] = value_type();
+    }
+    columns_--;
+}
+
+template< class T >
+typename Matrix<T>::matrix_type Matrix<T>::ToVector() const{
+    matrix_type result;
+
+    result.reserve(rows_);
+    for (const_iterator_type row_it = Begin(); row_it != End(); ++row_it){
+        result.emplace_back(row_it->begin(), row_it->end());
+    }
+    return result;
 }
 
 template< class T >
 typename Matrix<T>::iterator_type Matrix<T>::Begin(){
-    return matrix_.begin();
+    return iterator_type(elements_, columns_, stride_);
 }
 
 template< class T >
 typename Matrix<T>::const_iterator_type Matrix<T>::Begin() const{
-    return matrix_.begin();
+    return const_iterator_type(elements_, columns_, stride_);
 }
 
 template< class T >
 typename Matrix<T>::iterator_type Matrix<T>::End(){
-    return matrix_.end();
+    return Begin() + rows_;
 }
 
 template< class T >
 typename Matrix<T>::const_iterator_type Matrix<T>::End() const{
-    return matrix_.end();
+    return Begin() + rows_;
 }
 
 template< class T >
 typename Matrix<T>::reverse_iterator_type Matrix<T>::Rbegin(){
-    return matrix_.rbegin();
+    return reverse_iterator_type(End());
 }
 
 template< class T >
 typename Matrix<T>::reverse_const_iterator_type Matrix<T>::Rbegin() const{
-    return matrix_.rbegin();
+    return reverse_const_iterator_type(End());
 }
 
 template< class T >
 typename Matrix<T>::reverse_iterator_type Matrix<T>::Rend(){
-    return matrix_.rend();
+    return reverse_iterator_type(Begin());
 }
 
 template< class T >
 typename Matrix<T>::reverse_const_iterator_type Matrix<T>::Rend() const{
-    return matrix_.rend();
+    return reverse_const_iterator_type(Begin());
 }
 
 template< class T >
 Matrix<T> Matrix<T>::LoadFromFile(const std::string& filename){
-    // std::ifstream file_stream;
-    int rows_count, columns_count;
+    try{
+        const MatrixTextFile file(filename);
 
-    // Open file
-    std::ifstream input_file_stream;
-    input_file_stream.open(filename);
-    if (!input_file_stream.is_open()){
+        if (file.RowsCount() < 1 || file.ColumnsCount() < 1){
+            throw MatrixException(
+                "Columns or rows count cannot be non-positive"
+            );
+        }
+        return LoadMatrixFromFile_(file);
+    } catch(const MatrixException&){
+        throw;
+    } catch(const ::s21::Exception& e){
+        throw MatrixException(e.GetMessage());
+    }
+}
+
+template< class T >
+Matrix<T> Matrix<T>::LoadMatrixFromFile_(const MatrixTextFile& file,
+                                        bool is_non_negative){
+    Matrix<T> new_mtrx(file.RowsCount(), file.ColumnsCount());
+
+    file.ParseElements(new_mtrx.Data(), new_mtrx.LeadingDimension(),
+                        is_non_negative);
+    return new_mtrx;
+}
+
+template< class T >
+void Matrix<T>::SaveToFile(const std::string& filename) const{
+    std::ofstream output_file_stream;
+
+    output_file_stream.open(filename);
+    if (!output_file_stream.is_open()){
         throw MatrixException("Cannot open file: " + filename);
     }
 
-    // Read rows and columns count
-    input_file_stream >> rows_count;
-    input_file_stream >> columns_count;
-    if (rows_count < 1 || columns_count < 1){
-        throw MatrixException("Columns or rows count cannot be non-positive");
+    output_file_stream
+        << std::setprecision(std::numeric_limits<value_type>::max_digits10)
+        << rows_ << ' ' << columns_ << std::endl;
+    for (const_iterator_type row_it = Begin(); row_it != End(); ++row_it){
+        for (const value_type& elem : *row_it){
+            output_file_stream << elem << ' ';
+        }
+        output_file_stream << '\n';
     }
+    if (!output_file_stream.flush()){
+        throw MatrixException("Cannot write file: " + filename);
+    }
+}
 
-    return Matrix<T>(LoadMatrixFromFile_(
-                        input_file_stream,
-                        rows_count,
-                        columns_count
-                    ));
-}
-
-template< class T >
-Matrix<T> Matrix<T>::LoadMatrixFromFile_(
-    std::ifstream& input_file_stream,
-    int rows_count,
-    int columns_count
-){
-    matrix_type new_mtrx;
-    new_mtrx.reserve(rows_count);
-    for (int row = 0; row < rows_count; row++){
-        row_matrix_type new_row;
-        new_row.reserve(columns_count);
-        for (int column = 0; column < columns_count; column++){
-            T var;
-            input_file_stream >> var;
-            new_row.push_back(std::move(var));
+template< class T >
+Matrix<T> Matrix<T>::MapFromFile(const std::string& filename){
+    try{
+        return MapMatrixFromFile_(MappedMatrixFile::Open(
+            filename,
+            MappedMatrixFile::Mode::COPY_ON_WRITE
+        ));
+    } catch(const MatrixException&){
+        throw;
+    } catch(const ::s21::Exception& e){
+        throw MatrixException(e.GetMessage());
+    }
+}
+
+template< class T >
+void Matrix<T>::SaveToBinaryFile(const std::string& filename) const{
+    try{
+        MappedMatrixFile file = MappedMatrixFile::Create(
+            filename, rows_, columns_, MatrixElementTypeOf<value_type>()
+        );
+
+        for (row_size_type row = 0; row < rows_; row++){
+            std::copy_n(elements_ + row * stride_, columns_,
+                        file.Row<value_type>(row));
         }
-        new_mtrx.push_back(std::move(new_row));
+    } catch(const ::s21::Exception& e){
+        throw MatrixException(e.GetMessage());
     }
+}
 
-    return Matrix<T>(std::move(new_mtrx));
+template< class T >
+Matrix<T> Matrix<T>::MapMatrixFromFile_(MappedMatrixFile&& file){
+    if (file.ElementType() != MatrixElementTypeOf<value_type>()){
+        throw MatrixException("Invalid file: Matrix keeps other elements");
+    }
+
+    const MatrixFileHeader& header = file.Header();
+    const std::size_t row_bytes = header.leading_dimension * sizeof(T);
+    Matrix<T> new_mtrx(0, 0);
+
+    new_mtrx.rows_ = header.rows;
+    new_mtrx.columns_ = header.columns;
+    if (header.data_offset % MATRIX_ALIGNMENT || row_bytes % MATRIX_ALIGNMENT){
+        // Written by some other tool: rows can't be used in place
+        new_mtrx.stride_ = PaddedStride<value_type>(new_mtrx.columns_);
+        new_mtrx.data_.assign(new_mtrx.rows_ * new_mtrx.stride_,
+                                value_type());
+        new_mtrx.elements_ = new_mtrx.data_.data();
+        for (row_size_type row = 0; row < new_mtrx.rows_; row++){
+            std::copy_n(file.Row<value_type>(row), new_mtrx.columns_,
+                        new_mtrx.elements_ + row * new_mtrx.stride_);
+        }
+        return new_mtrx;
+    }
+
+    new_mtrx.stride_ = header.leading_dimension;
+    new_mtrx.elements_ = file.Row<value_type>(0);
+    new_mtrx.mapping_ = std::move(file);
+    return new_mtrx;
 }
 
 template< class T >
 bool Matrix<T>::IsMatrixValid_(){
-    if (!matrix_.size()){
+    if (!rows_){
         PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
                         "Invalid matrix: Matrix rows size must be positive");
-        matrix_.clear();
+        UseOwnStorage_();
+        data_.clear();
+        rows_ = columns_ = stride_ = 0;
         return false;
     }
 
-    column_size_type columns_count;
-
-    columns_count = matrix_.begin()->size();
-    if (!columns_count){
+    if (!columns_){
         PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__,
                         "Invalid matrix: Matrix columns size must be positive");
-        matrix_.clear();
+        UseOwnStorage_();
+        data_.clear();
+        rows_ = columns_ = stride_ = 0;
         return false;
     }
-
-    for (iterator_type row_it = matrix_.begin();
-        row_it != matrix_.end();
-        ++row_it
-    ){
-        if (row_it->size() != columns_count){
-            PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__, "Invalid matrix");
-            matrix_.clear();
-            return false;
-        }
-    }
     return true;
 }
 
@@ -207,7 +347,62 @@ std::string Matrix<T>::MatrixException::GetMessage() const{
 
 template< class T >
 void Matrix<T>::ThrowOnNonEmptyMatrix_() const{
-    if (matrix_.size()) throw MatrixException("Matrix is not empty");
+    if (rows_) throw MatrixException("Matrix is not empty");
+}
+
+template< class T >
+void Matrix<T>::CopyStorage_(const Matrix& other){
+    // Copies of a mapped matrix own their elements
+    UseOwnStorage_();
+    data_.assign(other.elements_,
+                other.elements_ + other.rows_ * other.stride_);
+    elements_ = data_.data();
+    rows_ = other.rows_;
+    columns_ = other.columns_;
+    stride_ = other.stride_;
+}
+
+template< class T >
+void Matrix<T>::MoveStorage_(Matrix&& other){
+    data_ = std::move(other.data_);
+    // Mapping address doesn't change on move
+    mapping_ = std::move(other.mapping_);
+    elements_ = mapping_.IsOpen() ? other.elements_ : data_.data();
+    other.elements_ = nullptr;
+    rows_ = std::exchange(other.rows_, 0);
+    columns_ = std::exchange(other.columns_, 0);
+    stride_ = std::exchange(other.stride_, 0);
+    other.data_.clear();
+}
+
+template< class T >
+void Matrix<T>::UseOwnStorage_(){
+    mapping_.Close();
+    elements_ = data_.data();
+}
+
+template< class T >
+void Matrix<T>::FillFromVector_(const matrix_type& inp_matrix){
+    rows_ = inp_matrix.size();
+    columns_ = rows_ ? inp_matrix.begin()->size() : 0;
+    stride_ = PaddedStride<value_type>(columns_ ? columns_ : 1);
+    UseOwnStorage_();
+    data_.assign(rows_ * stride_, value_type());
+    elements_ = data_.data();
+
+    for (row_size_type row = 0; row < rows_; row++){
+        if (inp_matrix[row].size() != columns_){
+            rows_ = columns_ = stride_ = 0;
+            data_.clear();
+            elements_ = data_.data();
+            throw MatrixException("Invalid matrix: rows have different sizes");
+        }
+        std::copy(
+            inp_matrix[row].begin(),
+            inp_matrix[row].end(),
+            elements_ + row * stride_
+        );
+    }
 }
 
 } // namespace s21
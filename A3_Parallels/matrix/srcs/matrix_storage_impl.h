@@ -0,0 +1,56 @@
+#ifndef MATRIX_STORAGE_H
+#error 'matrix_storage_impl.h' is not supposed to be included directly. \
+        Include 'matrix_storage.h' instead.
+#endif
+
+namespace s21{
+
+template < class T, std::size_t Alignment >
+T* AlignedAllocator<T, Alignment>::allocate(size_type n){
+    if (n > std::numeric_limits<size_type>::max() / sizeof(T)){
+        throw std::bad_array_new_length();
+    }
+    return static_cast<T*>(::operator new(
+        n * sizeof(T),
+        std::align_val_t(Alignment)
+    ));
+}
+
+template < class T, std::size_t Alignment >
+void AlignedAllocator<T, Alignment>::deallocate(T* ptr, size_type) noexcept{
+    ::operator delete(ptr, std::align_val_t(Alignment));
+}
+
+template < class T >
+typename RowSpan<T>::reference RowSpan<T>::at(size_type pos) const{
+    if (pos >= size_) throw std::out_of_range("RowSpan::at");
+    return data_[pos];
+}
+
+template < class T >
+MatrixRowIterator<T> MatrixRowIterator<T>::operator++(int){
+    MatrixRowIterator<T> tmp(*this);
+    ++(*this);
+    return tmp;
+}
+
+template < class T >
+MatrixRowIterator<T> MatrixRowIterator<T>::operator--(int){
+    MatrixRowIterator<T> tmp(*this);
+    --(*this);
+    return tmp;
+}
+
+template < class T >
+MatrixRowIterator<T>& MatrixRowIterator<T>::operator+=(difference_type n){
+    row_ += n * static_cast<difference_type>(stride_);
+    return *this;
+}
+
+template < class T >
+MatrixRowIterator<T>& MatrixRowIterator<T>::operator-=(difference_type n){
+    row_ -= n * static_cast<difference_type>(stride_);
+    return *this;
+}
+
+}
@@ -0,0 +1,168 @@
+#include "../includes/matrix_text.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+
+namespace s21{
+
+MatrixTextFile::MatrixTextFile(const std::string& filename)
+    : filename_(filename), descriptor_(-1), begin_(nullptr), end_(nullptr),
+        elements_begin_(nullptr), rows_count_(0), columns_count_(0){
+    struct stat file_stat;
+
+    descriptor_ = ::open(filename.c_str(), O_RDONLY);
+    if (descriptor_ < 0){
+        throw MatrixTextException("Cannot open file: " + filename);
+    }
+    if (::fstat(descriptor_, &file_stat) || file_stat.st_size <= 0){
+        Close_();
+        throw MatrixTextException("Invalid file: Empty file " + filename);
+    }
+
+    void* mapping = ::mmap(nullptr, file_stat.st_size, PROT_READ,
+                            MAP_PRIVATE, descriptor_, 0);
+
+    if (mapping == MAP_FAILED){
+        Close_();
+        throw MatrixTextException("Cannot map file: " + filename);
+    }
+    begin_ = static_cast<const char*>(mapping);
+    end_ = begin_ + file_stat.st_size;
+
+    const char* position = begin_;
+    auto parse_size = [&](long long& size){
+        while (position != end_ && IsMatrixTextSpace(*position)) ++position;
+
+        const std::from_chars_result result = std::from_chars(
+            position, end_, size
+        );
+
+        if (result.ec != std::errc() || (result.ptr != end_ &&
+                                        !IsMatrixTextSpace(*result.ptr))){
+            ThrowAt_(position, "Invalid matrix size");
+        }
+        position = result.ptr;
+    };
+
+    try{
+        parse_size(rows_count_);
+        parse_size(columns_count_);
+    } catch(const ::s21::Exception&){
+        Close_();
+        throw;
+    }
+    elements_begin_ = position;
+}
+
+MatrixTextFile::~MatrixTextFile(){
+    Close_();
+}
+
+long long MatrixTextFile::RowsCount() const{
+    return rows_count_;
+}
+
+long long MatrixTextFile::ColumnsCount() const{
+    return columns_count_;
+}
+
+std::vector<MatrixTextFile::Chunk> MatrixTextFile::SplitChunks_(
+                                                size_t chunks_count) const{
+    const size_type size = end_ - elements_begin_;
+    std::vector<Chunk> chunks;
+    const char* begin = elements_begin_;
+
+    chunks.reserve(chunks_count);
+    for (size_t chunk_i = 1; chunk_i <= chunks_count; chunk_i++){
+        const char* end = elements_begin_ + size * chunk_i / chunks_count;
+
+        // Moving the border to the next line start
+        if (end < begin) end = begin;
+        if (end != end_){
+            const void* line_end = std::memchr(end, '\n', end_ - end);
+
+            end = line_end ? static_cast<const char*>(line_end) + 1 : end_;
+        }
+        if (end == begin) continue;
+        chunks.push_back(Chunk{begin, end, 0, 0, nullptr, std::string()});
+        begin = end;
+    }
+    if (chunks.empty()){
+        chunks.push_back(Chunk{end_, end_, 0, 0, nullptr, std::string()});
+    }
+    return chunks;
+}
+
+void MatrixTextFile::CountChunk_(Chunk& chunk){
+    const size_type size = chunk.end - chunk.begin;
+    const char* data = chunk.begin;
+    size_type elements = 0;
+    // The character before a chunk is a line end or the header end
+    bool is_previous_space = true;
+    size_type i = 0;
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    // 8 characters at once: 0x80 marks non-space bytes, an element starts
+    // at a marked byte which follows an unmarked one
+    constexpr std::uint64_t ONES = 0x0101010101010101ULL;
+    constexpr std::uint64_t HIGH_BITS = ONES * 0x80;
+    constexpr std::uint64_t LOW_BITS = ONES * 0x7F;
+    std::uint64_t previous = 0;
+
+    for (; i + sizeof(std::uint64_t) <= size; i += sizeof(std::uint64_t)){
+        std::uint64_t word;
+
+        std::memcpy(&word, data + i, sizeof(word));
+
+        const std::uint64_t marks = (((word & LOW_BITS) + ONES * (0x7F - ' '))
+                                    | word) & HIGH_BITS;
+
+        elements += __builtin_popcountll(marks & ~((marks << 8) | previous));
+        previous = marks >> 56;
+    }
+    is_previous_space = !previous;
+#endif
+    for (; i < size; i++){
+        const bool is_space = IsMatrixTextSpace(data[i]);
+
+        elements += is_previous_space && !is_space;
+        is_previous_space = is_space;
+    }
+    chunk.elements = elements;
+}
+
+void MatrixTextFile::ThrowAt_(const char* position,
+                                const std::string& msg) const{
+    const size_type line = std::count(begin_, position, '\n') + 1;
+    const char* line_begin = position;
+
+    while (line_begin != begin_ && line_begin[-1] != '\n') --line_begin;
+    throw MatrixTextException(
+        filename_ + ":" + std::to_string(line) + ":" +
+        std::to_string(position - line_begin + 1) + ": " + msg
+    );
+}
+
+void MatrixTextFile::Close_(){
+    if (begin_) ::munmap(const_cast<char*>(begin_), end_ - begin_);
+    if (descriptor_ >= 0) ::close(descriptor_);
+    begin_ = end_ = elements_begin_ = nullptr;
+    descriptor_ = -1;
+}
+
+MatrixTextFile::MatrixTextException::MatrixTextException(
+                                                const std::string& msg)
+    : ::s21::Exception(msg) {
+
+}
+
+std::string MatrixTextFile::MatrixTextException::GetMessage() const{
+    return ::s21::Exception::msg_;
+}
+
+}
@@ -0,0 +1,159 @@
+#ifndef MATRIX_TEXT_H
+#error 'matrix_text_impl.h' is not supposed to be included directly. \
+        Include 'matrix_text.h' instead.
+#endif
+
+namespace s21{
+
+template < class T >
+void MatrixTextFile::ParseElements(T* data, size_type leading_dimension,
+                                    bool is_non_negative,
+                                    size_t threads_count) const{
+    const size_type max_chunks = (end_ - elements_begin_) / MIN_CHUNK_SIZE + 1;
+    const size_type expected = static_cast<size_type>(rows_count_) *
+                                static_cast<size_type>(columns_count_);
+    std::vector<Chunk> chunks = SplitChunks_(
+        std::clamp<size_type>(threads_count, 1, max_chunks)
+    );
+    size_type found = 0;
+
+    ForEachChunk_(chunks, [](Chunk& chunk){ CountChunk_(chunk); });
+    for (Chunk& chunk : chunks){
+        chunk.first_element = found;
+        found += chunk.elements;
+    }
+    // Extra elements are reported by ParseChunk_ at their position
+    if (found < expected){
+        const char* last = end_;
+
+        // Pointing right after the last element
+        while (last != elements_begin_ && IsMatrixTextSpace(last[-1])) --last;
+        ThrowAt_(last, "Expected " + std::to_string(expected) +
+                        " elements, found " + std::to_string(found));
+    }
+
+    ForEachChunk_(chunks, [&](Chunk& chunk){
+        ParseChunk_(chunk, data, leading_dimension, is_non_negative);
+    });
+    for (const Chunk& chunk : chunks){
+        if (chunk.error_position) ThrowAt_(chunk.error_position, chunk.error);
+    }
+}
+
+template < class T >
+void MatrixTextFile::ParseChunk_(Chunk& chunk, T* data,
+                                size_type leading_dimension,
+                                bool is_non_negative) const{
+    const size_type columns = columns_count_;
+    const size_type expected = rows_count_ * columns;
+    size_type element = chunk.first_element;
+    size_type column = element % columns;
+    // A chunk past the declared elements fails on its first one,
+    // its row pointer is never written through
+    T* row = data + std::min(element, expected) / columns * leading_dimension;
+    const char* position = chunk.begin;
+    auto set_error = [&chunk](const char* error_position,
+                                const std::string& error){
+        chunk.error_position = error_position;
+        chunk.error = error;
+    };
+
+    while (true){
+        while (position != chunk.end && IsMatrixTextSpace(*position)){
+            ++position;
+        }
+        if (position == chunk.end) return;
+        if (element >= expected){
+            set_error(position, "Expected only " + std::to_string(expected) +
+                                " elements");
+            return;
+        }
+
+        // Streams accept explicit plus sign, std::from_chars doesn't
+        const char* number = position;
+        if (*number == '+' && number + 1 != chunk.end && number[1] != '-'){
+            ++number;
+        }
+
+        T value;
+        const std::from_chars_result result = ParseNumber_(
+            number, chunk.end, value
+        );
+
+        if (result.ec == std::errc::result_out_of_range){
+            set_error(position, "Number is out of range");
+            return;
+        }
+        if (result.ec != std::errc() || (result.ptr != chunk.end &&
+                                        !IsMatrixTextSpace(*result.ptr))){
+            set_error(position, "Invalid number");
+            return;
+        }
+        if constexpr (std::is_signed_v<T>){
+            if (is_non_negative && value < T()){
+                set_error(position, "Value must be non-negative");
+                return;
+            }
+        }
+
+        row[column] = value;
+        position = result.ptr;
+        element++;
+        if (++column == columns){
+            column = 0;
+            row += leading_dimension;
+        }
+    }
+}
+
+template < class T >
+std::from_chars_result MatrixTextFile::ParseNumber_(const char* begin,
+                                                    const char* end,
+                                                    T& value){
+    std::from_chars_result result = std::from_chars(begin, end, value);
+
+    if constexpr (std::is_integral_v<T>){
+        if (result.ec != std::errc() || result.ptr == end ||
+                (*result.ptr != '.' && *result.ptr != 'e' &&
+                    *result.ptr != 'E')){
+            return result;
+        }
+
+        const double lowest = std::numeric_limits<T>::min();
+        const double highest = std::numeric_limits<T>::max();
+        double real;
+
+        result = std::from_chars(begin, end, real);
+        if (result.ec != std::errc()) return result;
+        if (!(real > lowest - 1 && real < highest + 1)){
+            result.ec = std::errc::result_out_of_range;
+            return result;
+        }
+        value = static_cast<T>(real);
+    }
+    return result;
+}
+
+template < class Function >
+void MatrixTextFile::ForEachChunk_(std::vector<Chunk>& chunks,
+                                    Function process){
+    threads_array_type threads_array;
+    size_t chunk_i = 1;
+
+    try{
+        for (; chunk_i < chunks.size(); chunk_i++){
+            threads_array.push_back(
+                std::thread(process, std::ref(chunks[chunk_i]))
+            );
+        }
+    } catch(const std::exception &e){
+        std::string error = "Threads problems: ";
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__, error + e.what());
+    }
+    // Chunks left without a thread are processed here
+    process(chunks.front());
+    for (; chunk_i < chunks.size(); chunk_i++) process(chunks[chunk_i]);
+    JoinThreads(threads_array);
+}
+
+}
@@ -52,7 +52,7 @@ template< class T >
 Graph<T>& Graph<T>::operator=(const Graph<T>& other){
     if (this == &other) return *this;
     parent_type::operator=(other);
-    if (!parent_type::matrix_.size()){
+    if (!parent_type::RowsSize()){
         min_spanning_tree_size_ = other.min_spanning_tree_size_;
         is_directed_ = other.is_directed_;
         is_connected_ = other.is_connected_;
@@ -64,7 +64,7 @@ template< class T >
 Graph<T>& Graph<T>::operator=(Graph<T>&& other){
     if (this == &other) return *this;
     parent_type::operator=(other);
-    if (!parent_type::matrix_.size()){
+    if (!parent_type::RowsSize()){
         min_spanning_tree_size_ = other.min_spanning_tree_size_;
         is_directed_ = other.is_directed_;
         is_connected_ = other.is_connected_;
@@ -94,27 +94,24 @@ bool Graph<T>::IsConnected() const{
 
 template< class T >
 Graph<T> Graph<T>::LoadFromFile(const std::string& filename){
-    // std::ifstream file_stream;
-    int rows_count, columns_count;
-
-    // Open file
-    std::ifstream input_file_stream;
-    input_file_stream.open(filename);
-    if (!input_file_stream.is_open()){
-        throw GraphException("Cannot open file: " + filename);
-    }
-    // Read rows and columns count
-    input_file_stream >> rows_count;
-    input_file_stream >> columns_count;
-    if (rows_count < 1 || columns_count < 1 || rows_count != columns_count){
-        throw GraphException("Columns or rows count cannot be non-positive");
+    try{
+        const MatrixTextFile file(filename);
+        const long long rows_count = file.RowsCount();
+        const long long columns_count = file.ColumnsCount();
+
+        if (rows_count < 1 || columns_count < 1 ||
+                rows_count != columns_count){
+            throw GraphException(
+                "Columns or rows count cannot be non-positive"
+            );
+        }
+        // Edge weights can't be negative
+        return Graph<T>(Matrix<T>::LoadMatrixFromFile_(file, true));
+    } catch(const GraphException&){
+        throw;
+    } catch(const ::s21::Exception& e){
+        throw GraphException(e.GetMessage());
     }
-
-    return Graph<T>(Matrix<T>::LoadMatrixFromFile_(
-                        input_file_stream,
-                        rows_count,
-                        columns_count
-                    ));
 }
 
 template< class T >
@@ -144,9 +141,9 @@ void Graph<T>::ExportGraphToDot(
 
 template< class T >
 bool Graph<T>::IsDirected_() const{
-    for (size_t x = 0; x < parent_type::matrix_.size(); x++){
-    for (size_t y = 0; y < parent_type::matrix_.size(); y++){
-        if (parent_type::matrix_[x][y] != parent_type::matrix_[y][x]){
+    for (size_t x = 0; x < parent_type::RowsSize(); x++){
+    for (size_t y = 0; y < parent_type::RowsSize(); y++){
+        if ((*this)[x][y] != (*this)[y][x]){
             return true;
         }
     }
@@ -156,14 +153,14 @@ bool Graph<T>::IsDirected_() const{
 
 template< class T >
 bool Graph<T>::IsConnected_() const{
-    for (size_t x = 0; x < parent_type::matrix_.size(); x++){
-        for (size_t y = 0; y < parent_type::matrix_.size(); y++){
-            if (parent_type::matrix_[x][y] != 0) break;
-            if (y + 1 == parent_type::matrix_.size()) return false;
+    for (size_t x = 0; x < parent_type::RowsSize(); x++){
+        for (size_t y = 0; y < parent_type::RowsSize(); y++){
+            if ((*this)[x][y] != 0) break;
+            if (y + 1 == parent_type::RowsSize()) return false;
         }
-        for (size_t y = 0; y < parent_type::matrix_.size(); y++){
-            if (parent_type::matrix_[y][x] != 0) break;
-            if (y + 1 == parent_type::matrix_.size()) return false;
+        for (size_t y = 0; y < parent_type::RowsSize(); y++){
+            if ((*this)[y][x] != 0) break;
+            if (y + 1 == parent_type::RowsSize()) return false;
         }
     }
 
@@ -193,13 +190,13 @@ std::string Graph<T>::GraphDotRepresentation_(const Graph<T> graph){
     std::string startline = "\t";
     std::string endline = ";\n";
 
-    for(size_type i = 0; i < ::s21::Matrix<T>::matrix_.size(); i++){
+    for(size_type i = 0; i < graph.RowsSize(); i++){
         graph_dot += startline + std::to_string(i) + endline;
     }
 
-    for(size_type row = 0; row < ::s21::Matrix<T>::matrix_.size(); row++){
-        for(size_type col = 0; col < ::s21::Matrix<T>::matrix_.size(); col++){
-            if (::s21::Matrix<T>::matrix_[row][col] > 0){
+    for(size_type row = 0; row < graph.RowsSize(); row++){
+        for(size_type col = 0; col < graph.RowsSize(); col++){
+            if (graph[row][col] > 0){
                 graph_dot += startline +
                             std::to_string(row) +
                             dash +
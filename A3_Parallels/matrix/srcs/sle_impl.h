@@ -28,14 +28,14 @@ Sle<T>::Sle(matrix_type&& inp_mtrx) : parent_type(std::move(inp_mtrx)) {
 template< class T >
 Sle<T>& Sle<T>::operator=(const Sle& other){
     if (this == &other) return *this;
-    this->matrix_ = other.matrix_;
+    this->CopyStorage_(other);
     return *this;
 }
 
 template< class T >
 Sle<T>& Sle<T>::operator=(Sle&& other){
     if (this == &other) return *this;
-    this->matrix_ = other.matrix_;
+    this->MoveStorage_(std::move(other));
     return *this;
 }
 
@@ -52,29 +52,26 @@ std::string Sle<T>::SleException::GetMessage() const{
 
 template< class T >
 Sle<T> Sle<T>::LoadFromFile(const std::string& filename){
-    // std::ifstream file_stream;
-    int rows_count = 0, columns_count = 0;
-
-    // Open file
-    std::ifstream input_file_stream;
-    input_file_stream.open(filename);
-    if (!input_file_stream.is_open()){
-        throw SleException("Cannot open file: " + filename);
-    }
-
-    // Read rows and columns count
-    input_file_stream >> rows_count;
-    input_file_stream >> columns_count;
-    if (rows_count < 1 || columns_count < 1 ||
-            (rows_count == 1 && columns_count == 1)){
-        throw SleException("Invalid SLE");
+    try{
+        const MatrixTextFile file(filename);
+        const long long rows_count = file.RowsCount();
+        const long long columns_count = file.ColumnsCount();
+
+        if (rows_count < 1 || columns_count < 1 ||
+                (rows_count == 1 && columns_count == 1)){
+            throw SleException("Invalid SLE");
+        }
+        return Sle<T>(Matrix<T>::LoadMatrixFromFile_(file));
+    } catch(const SleException&){
+        throw;
+    } catch(const ::s21::Exception& e){
+        throw SleException(e.GetMessage());
     }
+}
 
-    return Sle<T>(Matrix<T>::LoadMatrixFromFile_(
-                        input_file_stream,
-                        rows_count,
-                        columns_count
-                    ));
+template< class T >
+Sle<T> Sle<T>::MapFromFile(const std::string& filename){
+    return Sle<T>(Matrix<T>::MapFromFile(filename));
 }
 
 template< class T >
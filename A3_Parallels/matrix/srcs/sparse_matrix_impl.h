@@ -0,0 +1,660 @@
+#ifndef SPARSE_MATRIX_H
+#error 'sparse_matrix_impl.h' is not supposed to be included directly. \
+        Include 'sparse_matrix.h' instead.
+#endif
+
+namespace s21{
+
+template< class T >
+SparseMatrix<T>::SparseMatrix() : rows_(0), columns_(0), row_offsets_(1, 0){
+
+}
+
+template< class T >
+SparseMatrix<T>::SparseMatrix(size_type rows, size_type columns)
+    : rows_(rows), columns_(columns), row_offsets_(rows + 1, 0){
+    Validate_();
+}
+
+template< class T >
+SparseMatrix<T>::SparseMatrix(size_type rows, size_type columns,
+                            offsets_type row_offsets,
+                            indices_type column_indices, values_type values)
+    : rows_(rows), columns_(columns),
+        row_offsets_(std::move(row_offsets)),
+        column_indices_(std::move(column_indices)),
+        values_(std::move(values)){
+    Validate_();
+}
+
+template< class T >
+SparseMatrix<T>::SparseMatrix(const SparseMatrix& other)
+    : rows_(other.rows_), columns_(other.columns_){
+    const offsets_span_type offsets = other.RowOffsets();
+    const indices_span_type indices = other.ColumnIndices();
+    const const_values_span_type values = other.Values();
+
+    row_offsets_.assign(offsets.begin(), offsets.end());
+    column_indices_.assign(indices.begin(), indices.end());
+    values_.assign(values.begin(), values.end());
+}
+
+template< class T >
+SparseMatrix<T>::SparseMatrix(SparseMatrix&& other)
+    : rows_(other.rows_), columns_(other.columns_),
+        row_offsets_(std::move(other.row_offsets_)),
+        column_indices_(std::move(other.column_indices_)),
+        values_(std::move(other.values_)),
+        mapping_(std::move(other.mapping_)){
+    other.Clear_();
+}
+
+template< class T >
+SparseMatrix<T>& SparseMatrix<T>::operator=(const SparseMatrix& other){
+    if (this != &other) *this = SparseMatrix(other);
+    return *this;
+}
+
+template< class T >
+SparseMatrix<T>& SparseMatrix<T>::operator=(SparseMatrix&& other){
+    if (this == &other) return *this;
+    rows_ = other.rows_;
+    columns_ = other.columns_;
+    row_offsets_ = std::move(other.row_offsets_);
+    column_indices_ = std::move(other.column_indices_);
+    values_ = std::move(other.values_);
+    mapping_ = std::move(other.mapping_);
+    other.Clear_();
+    return *this;
+}
+
+template< class T >
+SparseMatrix<T> SparseMatrix<T>::FromTriplets(size_type rows,
+                                            size_type columns,
+                                            std::vector<Triplet> triplets){
+    for (const Triplet& triplet : triplets){
+        if (triplet.row >= rows || triplet.column >= columns){
+            throw SparseMatrixException(
+                "Invalid triplet: Coordinates are out of the matrix"
+            );
+        }
+    }
+    std::sort(triplets.begin(), triplets.end(),
+                [](const Triplet& first, const Triplet& second){
+                    return first.row != second.row ?
+                            first.row < second.row
+                            : first.column < second.column;
+                });
+
+    offsets_type row_offsets(rows + 1, 0);
+    indices_type column_indices;
+    values_type values;
+
+    column_indices.reserve(triplets.size());
+    values.reserve(triplets.size());
+    for (size_type triplet_i = 0; triplet_i < triplets.size(); triplet_i++){
+        const Triplet& triplet = triplets[triplet_i];
+
+        if (triplet_i && triplet.row == triplets[triplet_i - 1].row &&
+                triplet.column == triplets[triplet_i - 1].column){
+            values.back() += triplet.value;
+            continue;
+        }
+        column_indices.push_back(static_cast<index_type>(triplet.column));
+        values.push_back(triplet.value);
+        row_offsets[triplet.row + 1]++;
+    }
+    for (size_type row = 0; row < rows; row++){
+        row_offsets[row + 1] += row_offsets[row];
+    }
+    return SparseMatrix<T>(rows, columns, std::move(row_offsets),
+                            std::move(column_indices), std::move(values));
+}
+
+template< class T >
+SparseMatrix<T> SparseMatrix<T>::FromCsc(size_type rows, size_type columns,
+                                        offsets_type column_offsets,
+                                        indices_type row_indices,
+                                        values_type values){
+    return SparseMatrix<T>(columns, rows, std::move(column_offsets),
+                            std::move(row_indices),
+                            std::move(values)).Transpose();
+}
+
+template< class T >
+SparseMatrix<T> SparseMatrix<T>::FromDense(const dense_type& dense,
+                                            ThreadPool& pool){
+    const size_type rows = dense.RowsSize();
+    const size_type columns = dense.ColumnsSize();
+    SparseMatrix<T> sparse;
+
+    if (columns > std::numeric_limits<index_type>::max()){
+        throw SparseMatrixException("Invalid matrix: Too many columns");
+    }
+    sparse.rows_ = rows;
+    sparse.columns_ = columns;
+    sparse.row_offsets_.assign(rows + 1, 0);
+
+    offsets_type& offsets = sparse.row_offsets_;
+
+    // Nonzeros of every row are counted, so rows are copied in parallel
+    // straight to their places
+    pool.ParallelFor(
+        0, rows,
+        [&](size_type row_begin, size_type row_end){
+            for (size_type row = row_begin; row < row_end; row++){
+                const auto dense_row = dense[row];
+
+                offsets[row + 1] = std::count_if(
+                    dense_row.begin(), dense_row.end(),
+                    [](const value_type& value){
+                        return value != value_type();
+                    }
+                );
+            }
+        },
+        ROWS_BLOCK
+    );
+    for (size_type row = 0; row < rows; row++){
+        offsets[row + 1] += offsets[row];
+    }
+    sparse.column_indices_.resize(offsets.back());
+    sparse.values_.resize(offsets.back());
+    pool.ParallelFor(
+        0, rows,
+        [&](size_type row_begin, size_type row_end){
+            for (size_type row = row_begin; row < row_end; row++){
+                const auto dense_row = dense[row];
+                offset_type i = offsets[row];
+
+                for (size_type column = 0; column < columns; column++){
+                    if (dense_row[column] == value_type()) continue;
+                    sparse.column_indices_[i] = static_cast<index_type>(
+                        column
+                    );
+                    sparse.values_[i++] = dense_row[column];
+                }
+            }
+        },
+        ROWS_BLOCK
+    );
+    return sparse;
+}
+
+template< class T >
+SparseMatrix<T> SparseMatrix<T>::LoadFromFile(const std::string& filename){
+    std::ifstream input_file_stream(filename, std::ios::binary);
+
+    if (!input_file_stream.is_open()){
+        throw SparseMatrixException("Cannot open file: " + filename);
+    }
+
+    std::string text;
+
+    input_file_stream.seekg(0, std::ios::end);
+    text.resize(std::max<std::streamoff>(input_file_stream.tellg(), 0));
+    input_file_stream.seekg(0);
+    if (!input_file_stream.read(text.data(), text.size())){
+        throw SparseMatrixException("Cannot read file: " + filename);
+    }
+    return ParseMatrixMarket_(filename, text);
+}
+
+template< class T >
+void SparseMatrix<T>::SaveToFile(const std::string& filename) const{
+    std::ofstream output_file_stream;
+
+    output_file_stream.open(filename);
+    if (!output_file_stream.is_open()){
+        throw SparseMatrixException("Cannot open file: " + filename);
+    }
+
+    const offsets_span_type offsets = RowOffsets();
+    const indices_span_type indices = ColumnIndices();
+    const const_values_span_type values = Values();
+
+    output_file_stream
+        << "%%MatrixMarket matrix coordinate "
+        << (std::is_integral_v<value_type> ? "integer" : "real")
+        << " general\n"
+        << std::setprecision(std::numeric_limits<value_type>::max_digits10)
+        << rows_ << ' ' << columns_ << ' ' << NonZerosCount() << '\n';
+    for (size_type row = 0; row < rows_; row++){
+        for (offset_type i = offsets[row]; i < offsets[row + 1]; i++){
+            output_file_stream << row + 1 << ' ' << indices[i] + 1 << ' '
+                                << values[i] << '\n';
+        }
+    }
+    if (!output_file_stream.flush()){
+        throw SparseMatrixException("Cannot write file: " + filename);
+    }
+}
+
+template< class T >
+SparseMatrix<T> SparseMatrix<T>::MapFromFile(const std::string& filename){
+    try{
+        MappedSparseMatrixFile file = MappedSparseMatrixFile::Open(filename);
+        const SparseMatrixFileHeader& header = file.Header();
+
+        if (header.element_type != MatrixElementTypeOf<value_type>()){
+            throw SparseMatrixException(
+                "Invalid file: Matrix keeps other elements"
+            );
+        }
+
+        SparseMatrix<T> matrix;
+
+        matrix.rows_ = header.rows;
+        matrix.columns_ = header.columns;
+        matrix.row_offsets_.clear();
+        matrix.mapping_ = std::move(file);
+        matrix.Validate_();
+        return matrix;
+    } catch(const SparseMatrixException&){
+        throw;
+    } catch(const ::s21::Exception& e){
+        throw SparseMatrixException(e.GetMessage());
+    }
+}
+
+template< class T >
+void SparseMatrix<T>::SaveToBinaryFile(const std::string& filename) const{
+    try{
+        MappedSparseMatrixFile file = MappedSparseMatrixFile::Create(
+            filename, rows_, columns_, NonZerosCount(),
+            MatrixElementTypeOf<value_type>()
+        );
+        const offsets_span_type offsets = RowOffsets();
+        const indices_span_type indices = ColumnIndices();
+        const const_values_span_type values = Values();
+
+        std::copy(offsets.begin(), offsets.end(), file.RowOffsets());
+        std::copy(indices.begin(), indices.end(), file.ColumnIndices());
+        std::copy(values.begin(), values.end(),
+                    file.template Values<value_type>());
+    } catch(const ::s21::Exception& e){
+        throw SparseMatrixException(e.GetMessage());
+    }
+}
+
+template< class T >
+typename SparseMatrix<T>::size_type SparseMatrix<T>::RowsSize() const{
+    return rows_;
+}
+
+template< class T >
+typename SparseMatrix<T>::size_type SparseMatrix<T>::ColumnsSize() const{
+    return columns_;
+}
+
+template< class T >
+typename SparseMatrix<T>::size_type SparseMatrix<T>::NonZerosCount() const{
+    return IsMapped() ? mapping_.Header().non_zeros : values_.size();
+}
+
+template< class T >
+bool SparseMatrix<T>::IsMapped() const{
+    return mapping_.IsOpen();
+}
+
+template< class T >
+typename SparseMatrix<T>::offsets_span_type
+                                    SparseMatrix<T>::RowOffsets() const{
+    if (IsMapped()) return offsets_span_type(mapping_.RowOffsets(), rows_ + 1);
+    return offsets_span_type(row_offsets_.data(), row_offsets_.size());
+}
+
+template< class T >
+typename SparseMatrix<T>::indices_span_type
+                                    SparseMatrix<T>::ColumnIndices() const{
+    if (IsMapped()){
+        return indices_span_type(mapping_.ColumnIndices(), NonZerosCount());
+    }
+    return indices_span_type(column_indices_.data(), column_indices_.size());
+}
+
+template< class T >
+typename SparseMatrix<T>::const_values_span_type
+                                        SparseMatrix<T>::Values() const{
+    return const_cast<SparseMatrix<T>*>(this)->Values();
+}
+
+template< class T >
+typename SparseMatrix<T>::values_span_type SparseMatrix<T>::Values(){
+    if (IsMapped()){
+        return values_span_type(mapping_.template Values<value_type>(),
+                                NonZerosCount());
+    }
+    return values_span_type(values_.data(), values_.size());
+}
+
+template< class T >
+typename SparseMatrix<T>::value_type SparseMatrix<T>::At(
+                                                    size_type row,
+                                                    size_type column) const{
+    const offsets_span_type offsets = RowOffsets();
+    const indices_span_type indices = ColumnIndices();
+    const index_type* begin = indices.begin() + offsets[row];
+    const index_type* end = indices.begin() + offsets[row + 1];
+    const index_type* found = std::lower_bound(begin, end, column);
+
+    if (found == end || *found != column) return value_type();
+    return Values()[found - indices.begin()];
+}
+
+template< class T >
+typename SparseMatrix<T>::values_type SparseMatrix<T>::Diagonal() const{
+    values_type diagonal(std::min(rows_, columns_), value_type());
+
+    for (size_type row = 0; row < diagonal.size(); row++){
+        diagonal[row] = At(row, row);
+    }
+    return diagonal;
+}
+
+template< class T >
+SparseMatrix<T> SparseMatrix<T>::Transpose() const{
+    if (rows_ > std::numeric_limits<index_type>::max()){
+        throw SparseMatrixException("Invalid matrix: Too many rows "
+                                    "to transpose");
+    }
+
+    const offsets_span_type offsets = RowOffsets();
+    const indices_span_type indices = ColumnIndices();
+    const const_values_span_type values = Values();
+    SparseMatrix<T> transposed;
+    offsets_type& transposed_offsets = transposed.row_offsets_;
+
+    transposed.rows_ = columns_;
+    transposed.columns_ = rows_;
+    transposed_offsets.assign(columns_ + 1, 0);
+    for (index_type column : indices) transposed_offsets[column + 1]++;
+    for (size_type column = 0; column < columns_; column++){
+        transposed_offsets[column + 1] += transposed_offsets[column];
+    }
+    transposed.column_indices_.resize(indices.size());
+    transposed.values_.resize(values.size());
+
+    // Rows are visited in order, so rows of every column stay sorted
+    offsets_type next(transposed_offsets.begin(),
+                        transposed_offsets.end() - 1);
+
+    for (size_type row = 0; row < rows_; row++){
+        for (offset_type i = offsets[row]; i < offsets[row + 1]; i++){
+            const offset_type position = next[indices[i]]++;
+
+            transposed.column_indices_[position] =
+                                            static_cast<index_type>(row);
+            transposed.values_[position] = values[i];
+        }
+    }
+    return transposed;
+}
+
+template< class T >
+typename SparseMatrix<T>::dense_type SparseMatrix<T>::ToDense() const{
+    const offsets_span_type offsets = RowOffsets();
+    const indices_span_type indices = ColumnIndices();
+    const const_values_span_type values = Values();
+    dense_type dense(rows_, columns_);
+
+    for (size_type row = 0; row < rows_; row++){
+        auto dense_row = dense[row];
+
+        for (offset_type i = offsets[row]; i < offsets[row + 1]; i++){
+            dense_row[indices[i]] = values[i];
+        }
+    }
+    return dense;
+}
+
+template< class T >
+void SparseMatrix<T>::Multiply(const value_type* x, value_type* y,
+                                ThreadPool& pool) const{
+    const offsets_span_type offsets = RowOffsets();
+    const indices_span_type indices = ColumnIndices();
+    const const_values_span_type values = Values();
+
+    pool.ParallelFor(
+        0, rows_,
+        [&offsets, &indices, &values, x, y](size_type row_begin,
+                                            size_type row_end){
+            for (size_type row = row_begin; row < row_end; row++){
+                value_type sum = value_type();
+
+                for (offset_type i = offsets[row]; i < offsets[row + 1];
+                        i++){
+                    sum += values[i] * x[indices[i]];
+                }
+                y[row] = sum;
+            }
+        },
+        ROWS_BLOCK
+    );
+}
+
+template< class T >
+typename SparseMatrix<T>::dense_type SparseMatrix<T>::Multiply(
+                                                const dense_type& dense,
+                                                ThreadPool& pool) const{
+    if (dense.RowsSize() != columns_){
+        throw SparseMatrixException("Invalid matrix: Rows count of the "
+                                    "dense matrix differs from columns "
+                                    "count of the sparse one");
+    }
+
+    const offsets_span_type offsets = RowOffsets();
+    const indices_span_type indices = ColumnIndices();
+    const const_values_span_type values = Values();
+    const size_type width = dense.ColumnsSize();
+    dense_type product(rows_, width);
+
+    pool.ParallelFor(
+        0, rows_,
+        [&](size_type row_begin, size_type row_end){
+            for (size_type row = row_begin; row < row_end; row++){
+                value_type* product_row = product[row].data();
+
+                for (offset_type i = offsets[row]; i < offsets[row + 1];
+                        i++){
+                    const value_type value = values[i];
+                    const value_type* dense_row = dense[indices[i]].data();
+
+                    for (size_type column = 0; column < width; column++){
+                        product_row[column] += value * dense_row[column];
+                    }
+                }
+            }
+        },
+        ROWS_BLOCK
+    );
+    return product;
+}
+
+template< class T >
+SparseMatrix<T>::SparseMatrixException::SparseMatrixException(
+                        const std::string& msg) : ::s21::Exception(msg) { }
+
+template< class T >
+std::string SparseMatrix<T>::SparseMatrixException::GetMessage() const{
+    return ::s21::Exception::msg_;
+}
+
+template< class T >
+void SparseMatrix<T>::Clear_(){
+    rows_ = columns_ = 0;
+    row_offsets_.assign(1, 0);
+    column_indices_.clear();
+    values_.clear();
+    mapping_.Close();
+}
+
+template< class T >
+SparseMatrix<T> SparseMatrix<T>::ParseMatrixMarket_(
+                                                const std::string& filename,
+                                                const std::string& text){
+    constexpr char BANNER[] = "%%MatrixMarket";
+    const char* const end = text.data() + text.size();
+    const char* next = text.data();
+    const char* line_begin = next;
+    const char* line_end = next;
+    const char* cursor = next;
+    size_type line = 0;
+    bool is_pattern = false;
+    bool is_symmetric = false;
+    bool is_skew = false;
+
+    auto throw_at = [&filename, &line](const std::string& msg){
+        throw SparseMatrixException(filename + ":" + std::to_string(line) +
+                                    ": " + msg);
+    };
+    auto read_line = [&](){
+        if (next == end) return false;
+        line_begin = next;
+        line_end = static_cast<const char*>(
+            std::memchr(next, '\n', end - next)
+        );
+        if (!line_end) line_end = end;
+        next = line_end == end ? end : line_end + 1;
+        line++;
+        return true;
+    };
+    // Skipping empty and comment lines, cursor is set to the first element
+    auto read_data_line = [&](){
+        while (read_line()){
+            cursor = line_begin;
+            while (cursor != line_end && IsMatrixTextSpace(*cursor)){
+                ++cursor;
+            }
+            if (cursor != line_end && *cursor != '%') return true;
+        }
+        return false;
+    };
+    auto skip_spaces = [&](){
+        while (cursor != line_end && IsMatrixTextSpace(*cursor)) ++cursor;
+    };
+    auto parse = [&](auto& value){
+        skip_spaces();
+        // Streams accept explicit plus sign, std::from_chars doesn't
+        if (cursor != line_end && *cursor == '+') ++cursor;
+
+        const std::from_chars_result result = std::from_chars(
+            cursor, line_end, value
+        );
+
+        if (result.ec != std::errc() || (result.ptr != line_end &&
+                                        !IsMatrixTextSpace(*result.ptr))){
+            throw_at("Invalid number");
+        }
+        cursor = result.ptr;
+    };
+    auto parse_line_end = [&](){
+        skip_spaces();
+        if (cursor != line_end) throw_at("Unexpected data at the line end");
+    };
+
+    if (!text.compare(0, sizeof(BANNER) - 1, BANNER)){
+        read_line();
+
+        std::string tag, object, format, field, symmetry;
+        std::istringstream banner(std::string(line_begin, line_end));
+
+        banner >> tag >> object >> format >> field >> symmetry;
+        for (std::string* word : {&object, &format, &field, &symmetry}){
+            std::transform(word->begin(), word->end(), word->begin(),
+                            [](unsigned char c){ return std::tolower(c); });
+        }
+        if (object != "matrix" || format != "coordinate"){
+            throw_at("Only coordinate matrices are supported");
+        }
+        if (field == "pattern"){
+            is_pattern = true;
+        } else if (field != "real" && field != "double" &&
+                    field != "integer"){
+            throw_at("Unsupported field: " + field);
+        }
+        if (symmetry == "symmetric"){
+            is_symmetric = true;
+        } else if (symmetry == "skew-symmetric"){
+            is_skew = true;
+        } else if (symmetry != "general"){
+            throw_at("Unsupported symmetry: " + symmetry);
+        }
+    }
+
+    unsigned long long rows, columns, entries;
+
+    if (!read_data_line()) throw_at("No matrix size");
+    parse(rows);
+    parse(columns);
+    parse(entries);
+    parse_line_end();
+    if (!rows || !columns) throw_at("Sizes must be positive");
+    if ((is_symmetric || is_skew) && rows != columns){
+        throw_at("Symmetric matrix must be square");
+    }
+
+    std::vector<Triplet> triplets;
+
+    // Every entry takes at least 4 characters, a wrong count doesn't
+    // reserve more than the text can hold
+    triplets.reserve(std::min<unsigned long long>(entries,
+                                                text.size() / 4 + 1) *
+                    (is_symmetric || is_skew ? 2 : 1));
+    for (unsigned long long entry = 0; entry < entries; entry++){
+        unsigned long long row, column;
+        value_type value = 1;
+
+        if (!read_data_line()){
+            throw_at("Expected " + std::to_string(entries) +
+                    " entries, found " + std::to_string(entry));
+        }
+        parse(row);
+        parse(column);
+        if (!is_pattern) parse(value);
+        parse_line_end();
+        if (!row || !column || row > rows || column > columns){
+            throw_at("Entry is out of the matrix");
+        }
+        triplets.push_back(Triplet{row - 1, column - 1, value});
+        if (row != column && (is_symmetric || is_skew)){
+            triplets.push_back(Triplet{column - 1, row - 1,
+                                        is_skew ? -value : value});
+        }
+    }
+    if (read_data_line()){
+        throw_at("Expected only " + std::to_string(entries) + " entries");
+    }
+    return FromTriplets(rows, columns, std::move(triplets));
+}
+
+template< class T >
+void SparseMatrix<T>::Validate_() const{
+    const offsets_span_type offsets = RowOffsets();
+    const indices_span_type indices = ColumnIndices();
+
+    if (columns_ > std::numeric_limits<index_type>::max()){
+        throw SparseMatrixException("Invalid matrix: Too many columns");
+    }
+    if (offsets.size() != rows_ + 1 || offsets.front() ||
+            offsets.back() != indices.size() ||
+            indices.size() != Values().size()){
+        throw SparseMatrixException("Invalid matrix: CSR arrays sizes "
+                                    "are inconsistent");
+    }
+    for (size_type row = 0; row < rows_; row++){
+        if (offsets[row] > offsets[row + 1]){
+            throw SparseMatrixException("Invalid matrix: Row offsets "
+                                        "are decreasing");
+        }
+        for (offset_type i = offsets[row]; i < offsets[row + 1]; i++){
+            if (indices[i] >= columns_ ||
+                    (i > offsets[row] && indices[i] <= indices[i - 1])){
+                throw SparseMatrixException("Invalid matrix: Columns of "
+                                            "a row must be increasing");
+            }
+        }
+    }
+}
+
+}
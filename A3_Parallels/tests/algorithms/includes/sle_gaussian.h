@@ -0,0 +1,42 @@
+#ifndef TEST_SLE_GAUSSIAN_H
+#define TEST_SLE_GAUSSIAN_H
+
+#include <algorithm>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <gtest/gtest.h>
+
+#include "../../test_utils/includes/utils.h"
+#include "../../../algorithms/SLE/includes/sle_gaussian.h"
+#include "../../../algorithms/SLE/includes/sle_cholesky.h"
+#include "../../../algorithms/SLE/includes/sle_krylov.h"
+#include "../../../algorithms/SLE/includes/sle_mixed.h"
+
+#define TEST_SUITE_NAME_GAUSS GAUSSIAN_TEST
+
+namespace s21::test::gaussian{
+
+/**
+ * @return system of [equations] equations with random integer factors
+ * from [-10, 10], diagonally dominant and so having one solution
+ */
+::s21::Matrix<double> RandomSystem(size_t equations);
+
+/**
+ * @return 5-point finite difference matrix of -laplace(u) + [convection]
+ * du/dx on a [side]x[side] grid, symmetric positive definite if
+ * [convection] is 0
+ */
+::s21::SparseMatrix<double> PoissonMatrix(size_t side,
+                                            double convection = 0);
+
+/**
+ * @return max |A x - b| of [system] for [roots]
+ */
+double Residual(const ::s21::Matrix<double>& system,
+                const std::vector<double>& roots);
+
+}
+
+#endif
@@ -3,6 +3,7 @@
 
 #include <string>
 #include <vector>
+#include <random>
 #include <sstream>
 #include <gtest/gtest.h>
 
@@ -21,6 +22,24 @@ struct MultiplicatorInfo{
     std::string C;
     bool mtrx_valid;
 };
+
+/**
+ * @return [rows]x[columns] matrix of random integers from [-100, 100]
+ */
+::s21::Matrix<double> RandomMatrix(size_t rows, size_t columns);
+
+/**
+ * @return [A]x[B] calculated by definition
+ */
+::s21::Matrix<double> NaiveMultiplication(const ::s21::Matrix<double>& A,
+                                        const ::s21::Matrix<double>& B);
+
+/**
+ * @return true if [result] equals to [expected] with DoubleCompare precision
+ */
+bool IsResultEqual(const ::s21::MatrixResult<double>& result,
+                    const ::s21::Matrix<double>& expected);
+
 }
 
 #endif
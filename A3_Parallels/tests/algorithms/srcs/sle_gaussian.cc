@@ -0,0 +1,619 @@
+#include "../includes/sle_gaussian.h"
+
+namespace s21::test::gaussian{
+
+::s21::Matrix<double> RandomSystem(size_t equations){
+    std::mt19937 gen(equations);
+    std::uniform_int_distribution<> distrib(-10, 10);
+    ::s21::Matrix<double> system(equations, equations + 1);
+
+    for (size_t row = 0; row < equations; row++){
+        double row_sum = 0;
+
+        for (size_t column = 0; column <= equations; column++){
+            system[row][column] = distrib(gen);
+            if (column < equations) row_sum += std::abs(system[row][column]);
+        }
+        system[row][row] = row_sum + 1;
+    }
+    return system;
+}
+
+double Residual(const ::s21::Matrix<double>& system,
+                const std::vector<double>& roots){
+    const size_t equations = system.RowsSize();
+    double residual = 0;
+
+    for (size_t row = 0; row < equations; row++){
+        double value = -system[row][equations];
+
+        for (size_t column = 0; column < equations; column++){
+            value += system[row][column] * roots[column];
+        }
+        residual = std::max(residual, std::abs(value));
+    }
+    return residual;
+}
+
+::s21::SparseMatrix<double> PoissonMatrix(size_t side, double convection){
+    std::vector<::s21::SparseMatrix<double>::Triplet> triplets;
+
+    for (size_t y = 0; y < side; y++){
+        for (size_t x = 0; x < side; x++){
+            const size_t cell = y * side + x;
+
+            triplets.push_back({cell, cell, 4});
+            if (x) triplets.push_back({cell, cell - 1, -1 - convection});
+            if (x + 1 < side){
+                triplets.push_back({cell, cell + 1, -1 + convection});
+            }
+            if (y) triplets.push_back({cell, cell - side, -1});
+            if (y + 1 < side) triplets.push_back({cell, cell + side, -1});
+        }
+    }
+    return ::s21::SparseMatrix<double>::FromTriplets(
+        side * side,
+        side * side,
+        std::move(triplets)
+    );
+}
+
+TEST(TEST_SUITE_NAME_GAUSS, TEST_FIXED_SIZE_GAUSSIAN){
+    constexpr ::s21::Matrix<double, 3, 4> system{
+        {0, 2, 1, 7},
+        {1, 1, 1, 6},
+        {2, 1, -1, 1}
+    };
+    constexpr auto result = ::s21::SolveGaussianFixed(system);
+
+    static_assert(result.is_solved);
+    static_assert(result.equation_roots[0] == 1);
+    static_assert(result.equation_roots[1] == 2);
+    static_assert(result.equation_roots[2] == 3);
+
+    constexpr ::s21::Matrix<double, 2, 3> singular{
+        {1, 2, 3},
+        {2, 4, 6}
+    };
+    static_assert(!::s21::SolveGaussianFixed(singular).is_solved);
+
+    const ::s21::Matrix<double> dynamic_system = RandomSystem(6);
+    const auto roots = ::s21::SolveGaussianFixed(
+        ::s21::Matrix<double, 6, 7>(dynamic_system)
+    );
+
+    ASSERT_TRUE(roots.is_solved);
+    ASSERT_LT(
+        Residual(dynamic_system, std::vector<double>(
+            roots.equation_roots.begin(),
+            roots.equation_roots.end()
+        )),
+        1e-9
+    );
+}
+
+TEST(TEST_SUITE_NAME_GAUSS, TEST_PARALLEL_GAUSSIAN){
+    for (size_t equations : {1, 5, 127, 128, 200, 301}){
+        ::s21::Sle<double> system(RandomSystem(equations));
+
+        for (size_t threads_count : {1, 3, 8}){
+            const auto roots = ::s21::SleGaussianParellel(
+                system,
+                threads_count
+            ).GaussianElimination();
+
+            ASSERT_EQ(roots.equation_roots.size(), equations);
+            ASSERT_LT(Residual(system, roots.equation_roots), 1e-9);
+        }
+    }
+
+    // Zero pivots make the barrier completion swap rows
+    ::s21::Sle<double> system(RandomSystem(160));
+
+    for (size_t row = 0; row < 160; row += 2){
+        system.SwapRows(row, row + 1);
+        system[row][row] = 0;
+    }
+    const auto usual = ::s21::SleGaussianUsual(system).GaussianElimination();
+    const auto parallel = ::s21::SleGaussianParellel(
+        system,
+        4
+    ).GaussianElimination();
+
+    ASSERT_EQ(parallel.equation_roots.size(), 160u);
+    ASSERT_LT(Residual(system, parallel.equation_roots), 1e-9);
+    for (size_t root = 0; root < 160; root++){
+        ASSERT_NEAR(parallel.equation_roots[root], usual.equation_roots[root],
+                    1e-9);
+    }
+}
+
+TEST(TEST_SUITE_NAME_GAUSS, TEST_OVERDETERMINED_GAUSSIAN){
+    for (size_t seed = 0; seed < 20; seed++){
+        // The third equation combines the first two, so elimination
+        // leaves only rounding residue in it
+        const ::s21::Matrix<double> square = RandomSystem(2 + seed % 2);
+        const size_t unknowns = square.RowsSize();
+        ::s21::Sle<double> system(::s21::Matrix<double>(unknowns + 1,
+                                                        unknowns + 1));
+
+        for (size_t column = 0; column <= unknowns; column++){
+            for (size_t row = 0; row < unknowns; row++){
+                system[row][column] = square[row][column];
+                system[unknowns][column] += square[row][column] *
+                                            (0.1 + seed) / (row + 3);
+            }
+        }
+
+        const auto usual = ::s21::SleGaussianUsual(system)
+                            .GaussianElimination();
+        const auto parallel = ::s21::SleGaussianParellel(system, 3)
+                                .GaussianElimination();
+
+        ASSERT_EQ(usual.equation_roots.size(), unknowns);
+        for (size_t row = 0; row <= unknowns; row++){
+            double value = -system[row][unknowns];
+
+            for (size_t column = 0; column < unknowns; column++){
+                value += system[row][column] * usual.equation_roots[column];
+            }
+            ASSERT_NEAR(value, 0, 1e-9);
+        }
+        ASSERT_EQ(parallel.equation_roots.size(), unknowns);
+        for (size_t root = 0; root < unknowns; root++){
+            ASSERT_NEAR(parallel.equation_roots[root],
+                        usual.equation_roots[root], 1e-9);
+        }
+
+        system[unknowns][unknowns] += 1;
+        ASSERT_TRUE(::s21::SleGaussianUsual(system).GaussianElimination()
+                    .equation_roots.empty());
+    }
+}
+
+TEST(TEST_SUITE_NAME_GAUSS, TEST_BLOCKED_LU){
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<> distrib(-1, 1);
+
+    for (size_t size : {1, 9, 70, 150}){
+        ::s21::Matrix<double> matrix(size, size);
+
+        for (size_t row = 0; row < size; row++){
+            for (size_t column = 0; column < size; column++){
+                matrix[row][column] = distrib(gen);
+            }
+        }
+
+        ::s21::Matrix<double> factors(matrix);
+        ::s21::BlockedLu::permutation_type permutation;
+
+        ASSERT_TRUE(::s21::BlockedLu(3, 16).Factorize(factors, permutation));
+
+        std::vector<size_t> sorted(permutation);
+
+        std::sort(sorted.begin(), sorted.end());
+        for (size_t row = 0; row < size; row++) ASSERT_EQ(sorted[row], row);
+
+        // Row i of L U must be row permutation[i] of the matrix
+        for (size_t row = 0; row < size; row++){
+            for (size_t column = 0; column < size; column++){
+                double value = 0;
+
+                for (size_t inner = 0; inner <= std::min(row, column);
+                        inner++){
+                    value += (inner == row ? 1 : factors[row][inner]) *
+                                factors[inner][column];
+                }
+                ASSERT_NEAR(value, matrix[permutation[row]][column], 1e-12);
+            }
+            for (size_t column = 0; column < row; column++){
+                ASSERT_LE(std::abs(factors[row][column]), 1);
+            }
+        }
+    }
+
+    ::s21::Matrix<double> singular(3, 3, 1.0);
+    ::s21::BlockedLu::permutation_type permutation;
+
+    ASSERT_FALSE(::s21::BlockedLu().Factorize(singular, permutation));
+}
+
+TEST(TEST_SUITE_NAME_GAUSS, TEST_BLOCKED_GAUSSIAN){
+    for (size_t equations : {1, 2, 65, 200}){
+        ::s21::Sle<double> system(RandomSystem(equations));
+        const auto roots = ::s21::SleGaussianBlocked(
+            system,
+            2
+        ).GaussianElimination();
+
+        ASSERT_EQ(roots.equation_roots.size(), equations);
+        ASSERT_LT(Residual(system, roots.equation_roots), 1e-9);
+    }
+
+    // A zero leading element is fine for partial pivoting
+    ::s21::Sle<double> system(::s21::Matrix<double>(2, 3, 1.0));
+
+    system[0][0] = 0;
+    const auto roots = ::s21::SleGaussianBlocked(system).GaussianElimination();
+
+    ASSERT_EQ(roots.equation_roots.size(), 2u);
+    ASSERT_LT(Residual(system, roots.equation_roots), 1e-12);
+}
+
+TEST(TEST_SUITE_NAME_GAUSS, TEST_LU_SOLVER){
+    constexpr size_t equations = 90;
+    constexpr size_t rhs_count = 37;
+    ::s21::Sle<double> system(RandomSystem(equations));
+    ::s21::LuSolver solver(3);
+    std::mt19937 gen(11);
+    std::uniform_real_distribution<> distrib(-10, 10);
+
+    ASSERT_TRUE(solver.Factorize(system));
+    ASSERT_EQ(solver.Size(), equations);
+
+    std::vector<double> rhs(equations);
+
+    for (size_t row = 0; row < equations; row++){
+        rhs[row] = system[row][equations];
+    }
+
+    const auto roots = solver.Solve(rhs);
+
+    ASSERT_EQ(roots.equation_roots.size(), equations);
+    ASSERT_LT(Residual(system, roots.equation_roots), 1e-9);
+
+    // Every column solved together must match its single solve
+    ::s21::Matrix<double> many_rhs(equations, rhs_count);
+    ::s21::Matrix<double> solutions(0, 0);
+
+    for (size_t row = 0; row < equations; row++){
+        for (size_t column = 0; column < rhs_count; column++){
+            many_rhs[row][column] = distrib(gen);
+        }
+    }
+    ASSERT_TRUE(solver.Solve(many_rhs, solutions));
+    ASSERT_EQ(solutions.RowsSize(), equations);
+    ASSERT_EQ(solutions.ColumnsSize(), rhs_count);
+    for (size_t column = 0; column < rhs_count; column++){
+        for (size_t row = 0; row < equations; row++){
+            rhs[row] = many_rhs[row][column];
+            system[row][equations] = rhs[row];
+        }
+
+        const auto single = solver.Solve(rhs);
+
+        ASSERT_LT(Residual(system, single.equation_roots), 1e-9);
+        for (size_t row = 0; row < equations; row++){
+            ASSERT_NEAR(solutions[row][column], single.equation_roots[row],
+                        1e-9);
+        }
+    }
+
+    // Solutions of the same sizes are reused
+    ASSERT_TRUE(solver.Solve(many_rhs, solutions));
+    ASSERT_FALSE(solver.Solve(::s21::Matrix<double>(equations, 2),
+                                solutions));
+
+    // Factorising again replaces the factors
+    ::s21::Sle<double> other(RandomSystem(5));
+    std::vector<double> other_rhs(5);
+
+    for (size_t row = 0; row < 5; row++) other_rhs[row] = other[row][5];
+    ASSERT_TRUE(solver.Factorize(other));
+    ASSERT_LT(Residual(other, solver.Solve(other_rhs).equation_roots),
+                1e-9);
+
+    ASSERT_TRUE(::s21::LuSolver().Solve(rhs).equation_roots.empty());
+    ASSERT_FALSE(::s21::LuSolver().Solve(many_rhs, solutions));
+    ASSERT_TRUE(solver.Solve(std::vector<double>(3)).equation_roots.empty());
+}
+
+TEST(TEST_SUITE_NAME_GAUSS, TEST_TILED_LU){
+    std::mt19937 gen(5);
+    std::uniform_real_distribution<> distrib(-1, 1);
+    ::s21::ThreadPool inline_pool(0), pool(3);
+
+    for (size_t size : {1, 16, 70, 150}){
+        ::s21::Matrix<double> matrix(size, size);
+
+        for (size_t row = 0; row < size; row++){
+            for (size_t column = 0; column < size; column++){
+                matrix[row][column] = distrib(gen);
+            }
+        }
+
+        // Same pivots are chosen, so tiles must not change the factors
+        ::s21::Matrix<double> blocked(matrix);
+        ::s21::BlockedLu::permutation_type blocked_permutation;
+
+        ASSERT_TRUE(::s21::BlockedLu(1, 16).Factorize(
+            blocked,
+            blocked_permutation
+        ));
+        for (::s21::ThreadPool* tasks_pool : {&inline_pool, &pool}){
+            ::s21::Matrix<double> tiled(matrix);
+            ::s21::TiledLu::permutation_type tiled_permutation;
+
+            ASSERT_TRUE(::s21::TiledLu(16, 2, *tasks_pool).Factorize(
+                tiled,
+                tiled_permutation
+            ));
+            ASSERT_EQ(tiled_permutation, blocked_permutation);
+            for (size_t row = 0; row < size; row++){
+                for (size_t column = 0; column < size; column++){
+                    ASSERT_NEAR(tiled[row][column], blocked[row][column],
+                                1e-10);
+                }
+            }
+        }
+    }
+
+    ::s21::Matrix<double> singular(3, 3, 1.0);
+    ::s21::TiledLu::permutation_type permutation;
+
+    ASSERT_FALSE(::s21::TiledLu().Factorize(singular, permutation));
+}
+
+TEST(TEST_SUITE_NAME_GAUSS, TEST_TILED_GAUSSIAN){
+    for (size_t equations : {1, 2, 65, 200}){
+        ::s21::Sle<double> system(RandomSystem(equations));
+        const auto roots = ::s21::SleGaussianTiled(
+            system,
+            32
+        ).GaussianElimination();
+
+        ASSERT_EQ(roots.equation_roots.size(), equations);
+        ASSERT_LT(Residual(system, roots.equation_roots), 1e-9);
+    }
+}
+
+TEST(TEST_SUITE_NAME_GAUSS, TEST_TILED_CHOLESKY){
+    std::mt19937 gen(3);
+    std::uniform_real_distribution<> distrib(-1, 1);
+    ::s21::ThreadPool inline_pool(0), pool(3);
+
+    for (size_t size : {1, 16, 70}){
+        ::s21::Matrix<double> factor(size, size), spd(size, size);
+
+        for (size_t row = 0; row < size; row++){
+            for (size_t column = 0; column < size; column++){
+                factor[row][column] = distrib(gen);
+            }
+        }
+        // B B^T + n I is symmetric positive definite
+        for (size_t row = 0; row < size; row++){
+            for (size_t column = 0; column < size; column++){
+                double value = row == column ? size : 0;
+
+                for (size_t inner = 0; inner < size; inner++){
+                    value += factor[row][inner] * factor[column][inner];
+                }
+                spd[row][column] = value;
+            }
+        }
+        for (::s21::ThreadPool* tasks_pool : {&inline_pool, &pool}){
+            ::s21::TiledCholesky cholesky(16, 1, *tasks_pool);
+
+            ASSERT_TRUE(cholesky.Factorize(spd));
+            ASSERT_EQ(cholesky.Size(), size);
+            for (size_t row = 0; row < size; row++){
+                for (size_t column = 0; column <= row; column++){
+                    double value = 0;
+
+                    for (size_t inner = 0; inner <= column; inner++){
+                        value += cholesky.At(row, inner) *
+                                    cholesky.At(column, inner);
+                    }
+                    ASSERT_NEAR(value, spd[row][column], 1e-10);
+                }
+                ASSERT_EQ(cholesky.At(row, row + 1), 0);
+            }
+        }
+    }
+
+    ::s21::Matrix<double> indefinite(2, 2, 1.0);
+
+    indefinite[1][1] = -1;
+    ASSERT_FALSE(::s21::TiledCholesky().Factorize(indefinite));
+    ASSERT_TRUE(::s21::TiledCholesky().Solve({1.0, 1.0}).equation_roots
+                                                            .empty());
+}
+
+TEST(TEST_SUITE_NAME_GAUSS, TEST_CHOLESKY_SLE){
+    constexpr size_t equations = 150;
+    ::s21::Sle<double> system(RandomSystem(equations));
+
+    // Symmetric diagonally dominant with positive diagonal: SPD
+    for (size_t row = 0; row < equations; row++){
+        system[row][row] = std::abs(system[row][row]);
+        for (size_t column = 0; column < row; column++){
+            system[row][column] = system[column][row];
+        }
+    }
+    for (size_t row = 0; row < equations; row++){
+        double sum = 0;
+
+        for (size_t column = 0; column < equations; column++){
+            if (column != row) sum += std::abs(system[row][column]);
+        }
+        system[row][row] = sum + 1;
+    }
+    ASSERT_TRUE(::s21::SleCholesky::IsSpdCandidate(system));
+
+    const auto roots = ::s21::SleCholesky(system, 32).Solve();
+
+    ASSERT_EQ(roots.equation_roots.size(), equations);
+    ASSERT_LT(Residual(system, roots.equation_roots), 1e-9);
+
+    system[0][1] += 1;
+    ASSERT_FALSE(::s21::SleCholesky::IsSpdCandidate(system));
+    ASSERT_TRUE(::s21::SleCholesky(system).Solve().equation_roots.empty());
+}
+
+TEST(TEST_SUITE_NAME_GAUSS, TEST_KRYLOV_SOLVERS){
+    using ::s21::KrylovPreconditioner;
+    using ::s21::KrylovSolver;
+    ::s21::ThreadPool pool(3);
+    const auto symmetric = PoissonMatrix(30);
+    const auto general = PoissonMatrix(30, 0.4);
+    const std::vector<double> rhs(symmetric.RowsSize(), 1.0);
+
+    auto residual = [&rhs](const ::s21::SparseMatrix<double>& matrix,
+                            const ::s21::SleResult& result){
+        std::vector<double> product(rhs.size());
+        double norm = 0;
+
+        matrix.Multiply(result.equation_roots.data(), product.data());
+        for (size_t i = 0; i < rhs.size(); i++){
+            norm = std::max(norm, std::abs(product[i] - rhs[i]));
+        }
+        return norm;
+    };
+
+    for (auto preconditioner : {KrylovPreconditioner::NONE,
+                                KrylovPreconditioner::JACOBI,
+                                KrylovPreconditioner::ILU0}){
+        ::s21::KrylovOptions options;
+
+        options.preconditioner = preconditioner;
+        options.tolerance = 1e-10;
+
+        const KrylovSolver spd_solver(symmetric, options, pool);
+        const KrylovSolver solver(general, options, pool);
+        const ::s21::SleResult results[] = {
+            spd_solver.ConjugateGradient(rhs),
+            solver.BiCgStab(rhs),
+            solver.Gmres(rhs)
+        };
+
+        ASSERT_LT(residual(symmetric, results[0]), 1e-8);
+        ASSERT_LT(residual(general, results[1]), 1e-8);
+        ASSERT_LT(residual(general, results[2]), 1e-8);
+        for (const auto& result : results){
+            ASSERT_EQ(result.residual_history.front(), 1);
+            ASSERT_LE(result.residual_history.back(), 1e-10);
+        }
+    }
+
+    // ILU(0) is exact for a tridiagonal matrix
+    ::s21::KrylovOptions options;
+
+    options.preconditioner = KrylovPreconditioner::ILU0;
+
+    const auto line = ::s21::SparseMatrix<double>::FromTriplets(3, 3, {
+        {0, 0, 2}, {0, 1, -1}, {1, 0, -1}, {1, 1, 2}, {1, 2, -1},
+        {2, 1, -1}, {2, 2, 2}
+    });
+    const auto exact = KrylovSolver(line, options).Gmres({1, 0, 1});
+
+    ASSERT_EQ(exact.residual_history.size(), 2u);
+    ASSERT_NEAR(exact.equation_roots[1], 1, 1e-12);
+
+    // Iterations cap
+    options.max_iterations = 2;
+    options.preconditioner = KrylovPreconditioner::NONE;
+
+    const auto capped = KrylovSolver(symmetric, options).ConjugateGradient(
+        rhs
+    );
+
+    ASSERT_EQ(capped.residual_history.size(), 3u);
+    ASSERT_GT(capped.residual_history.back(), 1e-10);
+    ASSERT_TRUE(KrylovSolver(symmetric).Gmres({1.0}).equation_roots.empty());
+}
+
+TEST(TEST_SUITE_NAME_GAUSS, TEST_KRYLOV_SLE){
+    using sparse_type = ::s21::SparseMatrix<double>;
+
+    for (double convection : {0.0, 0.4}){
+        const sparse_type matrix = PoissonMatrix(20, convection);
+        const size_t size = matrix.RowsSize();
+        std::vector<sparse_type::Triplet> triplets;
+        const auto offsets = matrix.RowOffsets();
+
+        // Augmented by the right-hand side of ones as the last column
+        for (size_t row = 0; row < size; row++){
+            for (size_t i = offsets[row]; i < offsets[row + 1]; i++){
+                triplets.push_back({row, matrix.ColumnIndices()[i],
+                                    matrix.Values()[i]});
+            }
+            triplets.push_back({row, size, 1.0});
+        }
+
+        const ::s21::SleResult result = ::s21::SleKrylov(
+            sparse_type::FromTriplets(size, size + 1, std::move(triplets))
+        ).Solve();
+        std::vector<double> product(size);
+
+        ASSERT_EQ(::s21::SleKrylov::IsSpdCandidate(matrix), !convection);
+        ASSERT_EQ(result.equation_roots.size(), size);
+        matrix.Multiply(result.equation_roots.data(), product.data());
+        for (double element : product) ASSERT_NEAR(element, 1, 1e-8);
+    }
+    ASSERT_TRUE(::s21::SleKrylov(PoissonMatrix(3)).Solve()
+                .equation_roots.empty());
+}
+
+TEST(TEST_SUITE_NAME_GAUSS, TEST_MIXED_LU){
+    constexpr size_t equations = 150;
+    ::s21::Sle<double> system(RandomSystem(equations));
+    ::s21::MixedLuSolver solver(
+        ::s21::MixedLuSolver::DEFAULT_MAX_REFINEMENTS, 3, 16
+    );
+    std::vector<double> rhs(equations);
+
+    for (size_t row = 0; row < equations; row++){
+        rhs[row] = system[row][equations];
+    }
+    ASSERT_TRUE(solver.Factorize(system));
+    ASSERT_FALSE(solver.IsFallback());
+
+    // Refinement reaches the accuracy of double factors
+    auto roots = solver.Solve(rhs);
+
+    ASSERT_EQ(roots.equation_roots.size(), equations);
+    ASSERT_FALSE(solver.IsFallback());
+    ASSERT_GT(roots.residual_history.size(), 1);
+    ASSERT_LT(roots.residual_history.back(), 1e-14);
+    ASSERT_LT(Residual(system, roots.equation_roots), 1e-11);
+
+    roots = ::s21::SleMixedLu(system, 0).Solve();
+    ASSERT_LT(Residual(system, roots.equation_roots), 1e-11);
+
+    // Hilbert matrix is too ill-conditioned for float factors
+    constexpr size_t hilbert_size = 12;
+    ::s21::Sle<double> hilbert(::s21::Matrix<double>(hilbert_size,
+                                                    hilbert_size + 1));
+
+    for (size_t row = 0; row < hilbert_size; row++){
+        for (size_t column = 0; column < hilbert_size; column++){
+            hilbert[row][column] = 1.0 / (row + column + 1);
+            hilbert[row][hilbert_size] += hilbert[row][column];
+        }
+    }
+
+    ::s21::SleMixedLu hilbert_solver(hilbert, 3);
+
+    roots = hilbert_solver.Solve();
+    ASSERT_TRUE(hilbert_solver.IsFallback());
+    ASSERT_EQ(roots.equation_roots.size(), hilbert_size);
+    ASSERT_LT(roots.residual_history.back(), 1e-12);
+
+    // Float overflow falls back at once
+    system[0][0] = 1e300;
+    ASSERT_TRUE(solver.Factorize(system));
+    ASSERT_TRUE(solver.IsFallback());
+    roots = solver.Solve(rhs);
+    ASSERT_EQ(roots.residual_history.size(), 1);
+    ASSERT_LT(Residual(system, roots.equation_roots), 1e-9);
+
+    ::s21::Matrix<double> singular(3, 3);
+
+    ASSERT_FALSE(solver.Factorize(singular));
+    ASSERT_TRUE(solver.Solve(std::vector<double>(3)).equation_roots.empty());
+    ASSERT_TRUE(::s21::MixedLuSolver().Solve(rhs).equation_roots.empty());
+    ASSERT_TRUE(solver.Factorize(system));
+    ASSERT_TRUE(solver.Solve(std::vector<double>(3)).equation_roots.empty());
+}
+
+}
@@ -2,6 +2,52 @@
 
 namespace s21::test::winograd{
 
+::s21::Matrix<double> RandomMatrix(size_t rows, size_t columns){
+    std::mt19937 gen(rows * 1000 + columns);
+    std::uniform_int_distribution<> distrib(-100, 100);
+    ::s21::Matrix<double> mtrx(rows, columns);
+
+    for (size_t row = 0; row < rows; row++){
+        for (double& elem : mtrx[row]){
+            elem = distrib(gen);
+        }
+    }
+    return mtrx;
+}
+
+::s21::Matrix<double> NaiveMultiplication(const ::s21::Matrix<double>& A,
+                                        const ::s21::Matrix<double>& B){
+    ::s21::Matrix<double> C(A.RowsSize(), B.ColumnsSize());
+
+    for (size_t i = 0; i < A.RowsSize(); i++){
+    for (size_t j = 0; j < B.ColumnsSize(); j++){
+        for (size_t k = 0; k < A.ColumnsSize(); k++){
+            C[i][j] += A[i][k] * B[k][j];
+        }
+    }
+    }
+    return C;
+}
+
+bool IsResultEqual(const ::s21::MatrixResult<double>& result,
+                    const ::s21::Matrix<double>& expected){
+    if (result.matrix_array.size() != expected.RowsSize()) return false;
+    for (size_t i = 0; i < expected.RowsSize(); i++){
+        if (result.matrix_array[i].size() != expected.ColumnsSize()){
+            return false;
+        }
+        for (size_t j = 0; j < expected.ColumnsSize(); j++){
+            if (!::s21::DoubleCompare(
+                    result.matrix_array[i][j],
+                    expected[i][j])
+            ){
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 TEST(TEST_SUITE_NAME_WIN, TEST_MULTIPLICATION){
     std::vector<MultiplicatorInfo> info{
         { 
@@ -122,4 +168,475 @@ TEST(TEST_SUITE_NAME_WIN, TEST_MULTIPLICATION){
     }
 }
 
-}
\ No newline at end of file
+TEST(TEST_SUITE_NAME_WIN, TEST_MULTIPLICATION_RANDOM){
+    // Odd and even common dimensions, single row and single column cases
+    const std::vector<std::vector<size_t>> sizes{
+        {1, 1, 1}, {1, 7, 1}, {7, 1, 5}, {13, 8, 21}, {33, 17, 9},
+        {64, 64, 64}, {65, 63, 67}
+    };
+
+    ::s21::WinogradUsual usual;
+    ::s21::WinogradParallel parallel(3);
+    ::s21::WinograPipelineParallel pipeline;
+    ::s21::WinogradBlocked blocked;
+    // Tiny tiles to get partial tiles on every level
+    ::s21::WinogradBlocked blocked_tiny(2, ::s21::winograd::BlockingParams{
+        4, 8, 3
+    });
+    // Small cutoffs to get several recursion levels with padding
+    ::s21::WinogradStrassen strassen(1, 4);
+    ::s21::WinogradStrassen strassen_parallel(3, 7);
+
+    for (const std::vector<size_t>& size : sizes){
+        ::s21::Matrix<double> A = RandomMatrix(size[0], size[1]);
+        ::s21::Matrix<double> B = RandomMatrix(size[1], size[2]);
+        ::s21::Matrix<double> C = NaiveMultiplication(A, B);
+
+        ASSERT_TRUE(IsResultEqual(usual.WinogradMultiplication(A, B), C));
+        ASSERT_TRUE(IsResultEqual(parallel.WinogradMultiplication(A, B), C));
+        ASSERT_TRUE(IsResultEqual(pipeline.WinogradMultiplication(A, B), C));
+        ASSERT_TRUE(IsResultEqual(blocked.WinogradMultiplication(A, B), C));
+        ASSERT_TRUE(IsResultEqual(
+            blocked_tiny.WinogradMultiplication(A, B), C
+        ));
+        ASSERT_TRUE(IsResultEqual(strassen.WinogradMultiplication(A, B), C));
+        ASSERT_TRUE(IsResultEqual(
+            strassen_parallel.WinogradMultiplication(A, B), C
+        ));
+    }
+}
+
+TEST(TEST_SUITE_NAME_WIN, TEST_PIPELINE_CONFIGURATIONS){
+    // {compute stages, rows block, queue capacity}
+    const std::vector<std::vector<size_t>> configurations{
+        {1, 1, 1}, {3, 2, 1}, {4, 5, 3}, {2, 64, 2}
+    };
+    ::s21::Matrix<double> A = RandomMatrix(45, 31);
+    ::s21::Matrix<double> B = RandomMatrix(31, 26);
+    ::s21::Matrix<double> C = NaiveMultiplication(A, B);
+
+    for (const std::vector<size_t>& config : configurations){
+        ::s21::WinograPipelineParallel pipeline(
+            config[0], config[1], config[2]
+        );
+        const size_t blocks = (A.RowsSize() + config[1] - 1) / config[1];
+
+        for (int repeat = 0; repeat < 2; repeat++){
+            ASSERT_TRUE(IsResultEqual(
+                pipeline.WinogradMultiplication(A, B), C
+            ));
+
+            const auto& stats = pipeline.Stats();
+            size_t computed_blocks = 0;
+
+            // Factor stage, compute stages and write-back stage
+            ASSERT_EQ(stats.size(), config[0] + 2);
+            ASSERT_EQ(stats.front().blocks, blocks);
+            ASSERT_EQ(stats.back().blocks, blocks);
+            for (size_t stage_i = 1; stage_i + 1 < stats.size(); stage_i++){
+                computed_blocks += stats[stage_i].blocks;
+                ASSERT_LE(stats[stage_i].input_occupancy, config[2]);
+            }
+            ASSERT_EQ(computed_blocks, blocks);
+        }
+    }
+}
+
+TEST(TEST_SUITE_NAME_WIN, TEST_INVALID_AFTER_VALID){
+    ::s21::WinogradUsual usual;
+    ::s21::Matrix<double> A = RandomMatrix(3, 4);
+    ::s21::Matrix<double> B = RandomMatrix(4, 5);
+
+    ASSERT_TRUE(IsResultEqual(
+        usual.WinogradMultiplication(A, B), NaiveMultiplication(A, B)
+    ));
+    ASSERT_TRUE(usual.WinogradMultiplication(A, A).matrix_array.empty());
+}
+
+TEST(TEST_SUITE_NAME_WIN, TEST_PREPARED_MULTIPLICATION){
+    ::s21::Matrix<double> B = RandomMatrix(37, 29);
+
+    for (size_t threads : {1, 3}){
+        ::s21::WinogradPrepared prepared(threads);
+        ::s21::Matrix<double> A_wrong = RandomMatrix(5, 36);
+        ::s21::Matrix<double> result(64, 29);
+
+        ASSERT_FALSE(prepared.IsPrepared());
+        ASSERT_FALSE(prepared.Multiply(A_wrong, result));
+        ASSERT_TRUE(prepared.Prepare(B));
+        ASSERT_EQ(prepared.PreparedRowsSize(), 37);
+        ASSERT_EQ(prepared.PreparedColumnsSize(), 29);
+        ASSERT_FALSE(prepared.Multiply(A_wrong, result));
+
+        for (size_t rows : {64, 1, 17, 64}){
+            ::s21::Matrix<double> A = RandomMatrix(rows, 37);
+            ::s21::Matrix<double> C(rows, 29);
+            ::s21::Matrix<double> expected = NaiveMultiplication(A, B);
+
+            ASSERT_TRUE(prepared.Multiply(A, C));
+            ASSERT_TRUE(IsResultEqual(::s21::MatrixResult<double>{
+                C.ToVector()
+            }, expected));
+        }
+
+        // Buffers are grown by the first 64 rows multiplication already
+        ::s21::Matrix<double> A = RandomMatrix(64, 37);
+        const auto buffers = prepared.KeptBuffers();
+
+        ASSERT_GE(buffers.row_factors_capacity, 64);
+        ASSERT_GE(buffers.result_rows_capacity, 64);
+        for (int repeat = 0; repeat < 3; repeat++){
+            ASSERT_TRUE(prepared.Multiply(A, result));
+
+            const auto kept = prepared.KeptBuffers();
+
+            ASSERT_EQ(kept.row_factors, buffers.row_factors);
+            ASSERT_EQ(kept.row_factors_capacity,
+                        buffers.row_factors_capacity);
+            ASSERT_EQ(kept.result_rows, buffers.result_rows);
+            ASSERT_EQ(kept.result_rows_capacity,
+                        buffers.result_rows_capacity);
+        }
+    }
+}
+
+TEST(TEST_SUITE_NAME_WIN, TEST_BATCHED_MULTIPLICATION){
+    using ::s21::winograd::BatchView;
+
+    // {rows, inner, columns}: fixed-size kernels and the generic one
+    const std::vector<std::vector<size_t>> sizes{
+        {8, 8, 8}, {16, 16, 16}, {64, 64, 64}, {5, 7, 3}, {12, 12, 12}
+    };
+    const size_t count = 37;
+
+    for (const std::vector<size_t>& size : sizes){
+        // Padded rows and gaps between matrices to check strides
+        const size_t a_ld = size[1] + 1, b_ld = size[2] + 3;
+        const size_t c_ld = size[2];
+        const size_t a_stride = size[0] * a_ld + 5;
+        const size_t b_stride = size[1] * b_ld;
+        const size_t c_stride = size[0] * c_ld + 2;
+        std::vector<double> a(count * a_stride), b(count * b_stride);
+        std::vector<double> c(count * c_stride);
+        std::vector<::s21::Matrix<double>> A, B;
+
+        for (size_t m = 0; m < count; m++){
+            // Bigger random matrices just to get different seeds
+            A.push_back(RandomMatrix(size[0] + m, size[1]));
+            B.push_back(RandomMatrix(size[1] + m, size[2]));
+            for (size_t i = 0; i < size[0]; i++){
+            for (size_t k = 0; k < size[1]; k++){
+                a[m * a_stride + i * a_ld + k] = A[m][i][k];
+            }
+            }
+            for (size_t k = 0; k < size[1]; k++){
+            for (size_t j = 0; j < size[2]; j++){
+                b[m * b_stride + k * b_ld + j] = B[m][k][j];
+            }
+            }
+        }
+
+        for (size_t threads : {1, 3}){
+            std::fill(c.begin(), c.end(), 0);
+            ASSERT_TRUE(::s21::winograd::MultiplyBatch(
+                BatchView<const double>{
+                    a.data(), count, size[0], size[1], a_ld, a_stride
+                },
+                BatchView<const double>{
+                    b.data(), count, size[1], size[2], b_ld, b_stride
+                },
+                BatchView<double>{
+                    c.data(), count, size[0], size[2], c_ld, c_stride
+                },
+                threads
+            ));
+
+            for (size_t m = 0; m < count; m++){
+                ::s21::Matrix<double> A_m(size[0], size[1]);
+                ::s21::Matrix<double> B_m(size[1], size[2]);
+
+                for (size_t i = 0; i < size[0]; i++){
+                for (size_t k = 0; k < size[1]; k++){
+                    A_m[i][k] = A[m][i][k];
+                }
+                }
+                for (size_t k = 0; k < size[1]; k++){
+                for (size_t j = 0; j < size[2]; j++){
+                    B_m[k][j] = B[m][k][j];
+                }
+                }
+
+                ::s21::Matrix<double> expected = NaiveMultiplication(A_m,
+                                                                    B_m);
+                for (size_t i = 0; i < size[0]; i++){
+                for (size_t j = 0; j < size[2]; j++){
+                    ASSERT_TRUE(::s21::DoubleCompare(
+                        c[m * c_stride + i * c_ld + j],
+                        expected[i][j]
+                    ));
+                }
+                }
+            }
+        }
+    }
+
+    std::vector<double> buffer(64);
+    ASSERT_FALSE(::s21::winograd::MultiplyBatch(
+        BatchView<const double>{buffer.data(), 1, 2, 3, 3, 6},
+        BatchView<const double>{buffer.data(), 1, 2, 3, 3, 6},
+        BatchView<double>{buffer.data(), 1, 2, 3, 3, 6}
+    ));
+}
+
+TEST(TEST_SUITE_NAME_WIN, TEST_SIMD_KERNELS){
+    using ::s21::winograd::SimdLevel;
+
+    const size_t rows = 37, inner = 301, columns = 29;
+    ::s21::Matrix<double> A_int = RandomMatrix(rows, inner);
+    ::s21::Matrix<double> B_int = RandomMatrix(inner, columns);
+    ::s21::Matrix<double> A_real(rows, inner);
+    ::s21::Matrix<double> B_real(inner, columns);
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<> distrib(-1, 1);
+
+    for (size_t i = 0; i < rows; i++){
+        for (double& elem : A_real[i]) elem = distrib(gen);
+    }
+    for (size_t i = 0; i < inner; i++){
+        for (double& elem : B_real[i]) elem = distrib(gen);
+    }
+
+    ::s21::WinogradBlocked scalar(1, ::s21::winograd::BlockingParams{
+        8, 16, 32
+    }, SimdLevel::SCALAR);
+    ::s21::MatrixResult<double> scalar_int =
+                                scalar.WinogradMultiplication(A_int, B_int);
+    ::s21::MatrixResult<double> scalar_real =
+                                scalar.WinogradMultiplication(A_real, B_real);
+
+    for (SimdLevel level : {SimdLevel::SSE2, SimdLevel::AVX2,
+                            SimdLevel::AVX512}){
+        if (!::s21::winograd::IsSimdLevelSupported(level)) continue;
+
+        ::s21::WinogradBlocked simd(1, ::s21::winograd::BlockingParams{
+            8, 16, 32
+        }, level);
+
+        // Integer products and sums are exact with and without FMA
+        ASSERT_TRUE(simd.WinogradMultiplication(A_int, B_int).matrix_array ==
+                    scalar_int.matrix_array);
+
+        ::s21::MatrixResult<double> simd_real =
+                                simd.WinogradMultiplication(A_real, B_real);
+        for (size_t i = 0; i < rows; i++){
+        for (size_t j = 0; j < columns; j++){
+            double terms_sum = 0;
+
+            for (size_t k = 0; k + 1 < inner; k += 2){
+                terms_sum += std::abs(
+                    (A_real[i][k] + B_real[k + 1][j]) *
+                    (A_real[i][k + 1] + B_real[k][j])
+                );
+            }
+            ASSERT_LE(
+                std::abs(simd_real.matrix_array[i][j] -
+                        scalar_real.matrix_array[i][j]),
+                ::s21::winograd::SIMD_RELATIVE_TOLERANCE * terms_sum
+            ) << ::s21::winograd::SimdLevelName(level);
+        }
+        }
+    }
+}
+
+TEST(TEST_SUITE_NAME_WIN, TEST_FIXED_SIZE_MULTIPLICATION){
+    constexpr ::s21::Matrix<double, 2, 3> A{{1, 2, 3}, {4, 5, 6}};
+    constexpr ::s21::Matrix<double, 3, 2> B{{7, 8}, {9, 10}, {11, 12}};
+    constexpr ::s21::Matrix<double, 2, 2> C = ::s21::winograd::MultiplyFixed(
+        A, B
+    );
+
+    static_assert(C == ::s21::Matrix<double, 2, 2>{{58, 64}, {139, 154}});
+
+    const ::s21::Matrix<double> A_dynamic = RandomMatrix(5, 7);
+    const ::s21::Matrix<double> B_dynamic = RandomMatrix(7, 4);
+    const ::s21::Matrix<double, 5, 4> product =
+        ::s21::winograd::MultiplyFixed(
+            ::s21::Matrix<double, 5, 7>(A_dynamic),
+            ::s21::Matrix<double, 7, 4>(B_dynamic)
+        );
+
+    ASSERT_EQ(::s21::Matrix<double>(product).ToVector(),
+                NaiveMultiplication(A_dynamic, B_dynamic).ToVector());
+}
+
+TEST(TEST_SUITE_NAME_WIN, TEST_GEMM){
+    using Operation = ::s21::WinogradGemm::Operation;
+
+    auto transposed = [](const ::s21::Matrix<double>& mtrx){
+        ::s21::Matrix<double> result(mtrx.ColumnsSize(), mtrx.RowsSize());
+
+        for (size_t i = 0; i < mtrx.RowsSize(); i++){
+        for (size_t j = 0; j < mtrx.ColumnsSize(); j++){
+            result[j][i] = mtrx[i][j];
+        }
+        }
+        return result;
+    };
+    const size_t M = 37, K = 19, N = 23;
+    const ::s21::Matrix<double> A = RandomMatrix(M, K);
+    const ::s21::Matrix<double> B = RandomMatrix(K, N);
+    const ::s21::Matrix<double> C = RandomMatrix(M, N);
+    const ::s21::Matrix<double> AB = NaiveMultiplication(A, B);
+    const double alpha = 2, beta = -0.5;
+
+    for (size_t threads_count : {1, 3}){
+        ::s21::WinogradGemm gemm(threads_count);
+
+        for (bool first_transposed : {false, true}){
+        for (bool second_transposed : {false, true}){
+            ::s21::Matrix<double> result(C);
+
+            ASSERT_TRUE(gemm.Multiply(
+                alpha,
+                first_transposed ? transposed(A) : A,
+                first_transposed ? Operation::TRANSPOSED : Operation::NORMAL,
+                second_transposed ? transposed(B) : B,
+                second_transposed ? Operation::TRANSPOSED : Operation::NORMAL,
+                beta,
+                result
+            ));
+            for (size_t i = 0; i < M; i++){
+            for (size_t j = 0; j < N; j++){
+                ASSERT_DOUBLE_EQ(result[i][j],
+                                alpha * AB[i][j] + beta * C[i][j]);
+            }
+            }
+        }
+        }
+
+        // Zero beta ignores previous content, NaN included
+        ::s21::Matrix<double> result(M, N);
+
+        result[0][0] = std::numeric_limits<double>::quiet_NaN();
+        ASSERT_TRUE(gemm.Multiply(1, A, B, 0, result));
+        ASSERT_EQ(result.ToVector(), AB.ToVector());
+
+        // Accumulating C += A x B
+        ASSERT_TRUE(gemm.Multiply(1, A, B, 1, result));
+        for (size_t i = 0; i < M; i++){
+        for (size_t j = 0; j < N; j++){
+            ASSERT_EQ(result[i][j], 2 * AB[i][j]);
+        }
+        }
+
+        // Invalid sizes leave result untouched
+        ASSERT_FALSE(gemm.Multiply(1, A, Operation::TRANSPOSED, B,
+                                    Operation::NORMAL, 0, result));
+        ASSERT_EQ(result[0][0], 2 * AB[0][0]);
+    }
+}
+
+TEST(TEST_SUITE_NAME_WIN, TEST_SKINNY_MULTIPLICATION){
+    using ::s21::winograd::SimdLevel;
+
+    // Inner sizes cover SIMD tails of every width, both parities
+    for (size_t inner : {1, 2, 3, 6, 9, 17, 64, 301}){
+    for (size_t columns = 1; columns <= ::s21::winograd::SKINNY_MAX_COLUMNS;
+            columns++){
+        ::s21::Matrix<double> A = RandomMatrix(13, inner);
+        ::s21::Matrix<double> B = RandomMatrix(inner, columns);
+        ::s21::Matrix<double> C = NaiveMultiplication(A, B);
+        ::s21::winograd::SkinnyColumns packed;
+
+        ::s21::winograd::PackSkinnyMatrix(B, packed);
+        for (SimdLevel level : {SimdLevel::SCALAR, SimdLevel::SSE2,
+                                SimdLevel::AVX2, SimdLevel::AVX512}){
+            ::s21::Matrix<double> result(A.RowsSize(), columns);
+            std::vector<double*> result_rows;
+
+            for (size_t i = 0; i < A.RowsSize(); i++){
+                result_rows.push_back(result[i].data());
+            }
+            ::s21::winograd::MultiplySkinny(
+                A.Data(), A.LeadingDimension(), packed, 0, A.RowsSize(),
+                result_rows.data(),
+                ::s21::winograd::GetSkinnyKernel(level, columns)
+            );
+            // Integer products and sums are exact with and without FMA
+            ASSERT_EQ(result.ToVector(), C.ToVector())
+                << ::s21::winograd::SimdLevelName(level);
+        }
+    }
+    }
+
+    // Large enough to split rows between threads
+    ::s21::Matrix<double> A = RandomMatrix(600, 301);
+    ::s21::Matrix<double> B = RandomMatrix(301, 3);
+    ::s21::Matrix<double> C = NaiveMultiplication(A, B);
+    ::s21::WinogradParallel parallel(3);
+    ::s21::WinograPipelineParallel pipeline;
+    ::s21::WinogradStrassen strassen(2, 4);
+
+    ASSERT_TRUE(IsResultEqual(parallel.WinogradMultiplication(A, B), C));
+    ASSERT_TRUE(IsResultEqual(strassen.WinogradMultiplication(A, B), C));
+    ASSERT_TRUE(IsResultEqual(pipeline.WinogradMultiplication(A, B), C));
+    ASSERT_TRUE(pipeline.Stats().empty());
+}
+
+TEST(TEST_SUITE_NAME_WIN, TEST_OUT_OF_CORE_MULTIPLICATION){
+    const fs::path dir = fs::temp_directory_path();
+    const std::string A_file = dir / "s21_out_of_core_A.bin";
+    const std::string B_file = dir / "s21_out_of_core_B.bin";
+    const std::string C_file = dir / "s21_out_of_core_C.bin";
+    auto write_matrix = [](const std::string& filename,
+                            const ::s21::Matrix<double>& mtrx){
+        ::s21::MappedMatrixFile file = ::s21::MappedMatrixFile::Create(
+            filename, mtrx.RowsSize(), mtrx.ColumnsSize(),
+            ::s21::MatrixElementType::FLOAT64
+        );
+
+        for (size_t i = 0; i < mtrx.RowsSize(); i++){
+            std::copy(mtrx[i].begin(), mtrx[i].end(), file.Row<double>(i));
+        }
+    };
+    const ::s21::Matrix<double> A = RandomMatrix(37, 29);
+    const ::s21::Matrix<double> B = RandomMatrix(29, 41);
+    const ::s21::Matrix<double> C = NaiveMultiplication(A, B);
+
+    write_matrix(A_file, A);
+    write_matrix(B_file, B);
+
+    // {tile size, threads, prefetch depth}: partial tiles on every side
+    for (const std::vector<size_t>& config : std::vector<std::vector<size_t>>{
+            {16, 1, 1}, {8, 3, 3}, {64, 2, 2}}){
+        ::s21::WinogradOutOfCore out_of_core(config[0], config[1], config[2]);
+
+        ASSERT_TRUE(out_of_core.Multiply(A_file, B_file, C_file));
+
+        const ::s21::MappedMatrixFile result =
+                                ::s21::MappedMatrixFile::Open(C_file);
+        const size_t tiles_side = (37 + config[0] - 1) / config[0];
+
+        ASSERT_EQ(result.RowsSize(), C.RowsSize());
+        ASSERT_EQ(result.ColumnsSize(), C.ColumnsSize());
+        ASSERT_EQ(out_of_core.LastStats().tiles,
+                    tiles_side * ((29 + config[0] - 1) / config[0]) *
+                    ((41 + config[0] - 1) / config[0]));
+        for (size_t i = 0; i < C.RowsSize(); i++){
+            for (size_t j = 0; j < C.ColumnsSize(); j++){
+                ASSERT_EQ(result.Row<double>(i)[j], C[i][j]);
+            }
+        }
+    }
+
+    ::s21::WinogradOutOfCore out_of_core(16);
+
+    ASSERT_FALSE(out_of_core.Multiply(B_file, B_file, C_file));
+    ASSERT_FALSE(out_of_core.Multiply(A_file, dir / "s21_missing.bin",
+                                        C_file));
+    fs::remove(A_file);
+    fs::remove(B_file);
+    fs::remove(C_file);
+}
+
+}
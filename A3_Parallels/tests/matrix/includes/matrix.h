@@ -1,10 +1,15 @@
 #ifndef TEST_MATRIX_H
 #define TEST_MATRIX_H
 
+#include <filesystem>
+#include <fstream>
+#include <cstddef>
+#include <utility>
 #include <gtest/gtest.h>
 
 #include "../../test_utils/includes/utils.h"
 #include "../../../matrix/includes/matrix.h"
+#include "../../../matrix/includes/s21_graph.h"
 
 #define TEST_SUITE_NAME_MTRX MATRIX_TEST
 
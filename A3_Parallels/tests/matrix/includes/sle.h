@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 #include <sstream>
+#include <filesystem>
 #include <gtest/gtest.h>
 
 #include "../../test_utils/includes/utils.h"
@@ -0,0 +1,13 @@
+#ifndef TEST_SPARSE_MATRIX_H
+#define TEST_SPARSE_MATRIX_H
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "../../../matrix/includes/sparse_matrix.h"
+
+#define TEST_SUITE_NAME_SPARSE SPARSE_MATRIX_TEST
+
+#endif
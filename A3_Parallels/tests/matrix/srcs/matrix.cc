@@ -66,4 +66,253 @@ TEST(TEST_SUITE_NAME_MTRX, TEST_MOVE_CONSTRUCTOR){
     }
 }
 
+TEST(TEST_SUITE_NAME_MTRX, TEST_ALIGNED_STORAGE){
+    for (const std::string& file : ::s21::test::valid_graph_files){
+        ::s21::Matrix<double> mtrx = ::s21::Matrix<double>::LoadFromFile(file);
+
+        ASSERT_GE(mtrx.LeadingDimension(), mtrx.ColumnsSize());
+        ASSERT_EQ(
+            mtrx.LeadingDimension() * sizeof(double) % ::s21::MATRIX_ALIGNMENT,
+            0
+        );
+        for (size_t i = 0; i < mtrx.RowsSize(); i++){
+            ::s21::RowSpan<double> row = mtrx.Row(i);
+
+            ASSERT_EQ(row.size(), mtrx.ColumnsSize());
+            ASSERT_EQ(row.data(), mtrx.Data() + i * mtrx.LeadingDimension());
+            ASSERT_EQ(
+                reinterpret_cast<uintptr_t>(row.data()) %
+                    ::s21::MATRIX_ALIGNMENT,
+                0
+            );
+            for (size_t j = 0; j < mtrx.ColumnsSize(); j++){
+                ASSERT_EQ(row[j], mtrx.At(i, j));
+                ASSERT_EQ(&row[j], &mtrx[i][j]);
+            }
+        }
+    }
+}
+
+TEST(TEST_SUITE_NAME_MTRX, TEST_ROWS_MODIFICATION){
+    ::s21::Matrix<int> mtrx({{1, 2, 3}, {4, 5, 6}, {7, 8, 9}});
+
+    mtrx.SwapRows(0, 2);
+    ASSERT_EQ(mtrx.ToVector(),
+        std::vector<std::vector<int>>({{7, 8, 9}, {4, 5, 6}, {1, 2, 3}}));
+
+    mtrx.EraseColumn(1);
+    ASSERT_EQ(mtrx.ColumnsSize(), 2);
+    ASSERT_EQ(mtrx.ToVector(),
+        std::vector<std::vector<int>>({{7, 9}, {4, 6}, {1, 3}}));
+
+    int sum = 0;
+    for (auto row_it = mtrx.Rbegin(); row_it != mtrx.Rend(); ++row_it){
+        sum = sum * 10 + row_it->front();
+    }
+    ASSERT_EQ(sum, 147);
+
+    ASSERT_THROW(
+        ::s21::Matrix<int>({{1, 2}, {3}}),
+        ::s21::Exception
+    );
+}
+
+TEST(TEST_SUITE_NAME_MTRX, TEST_FIXED_SIZE_MATRIX){
+    constexpr ::s21::Matrix<int, 2, 3> fixed{{1, 2, 3}, {4, 5, 6}};
+
+    static_assert(fixed[1][2] == 6);
+    static_assert(fixed.RowsSize() == 2 && fixed.ColumnsSize() == 3);
+    static_assert(fixed == ::s21::Matrix<int, 2, 3>{{1, 2, 3}, {4, 5, 6}});
+    static_assert(::s21::Matrix<int, 2, 2>()[1][1] == 0);
+
+    ::s21::Matrix<int> dynamic(fixed);
+
+    ASSERT_EQ(dynamic.ToVector(),
+        std::vector<std::vector<int>>({{1, 2, 3}, {4, 5, 6}}));
+
+    dynamic[0][0] = 7;
+    ::s21::Matrix<int, 2, 3> converted(dynamic);
+
+    ASSERT_EQ(converted[0][0], 7);
+    ASSERT_NE(converted, fixed);
+    converted[0][0] = 1;
+    ASSERT_EQ(converted, fixed);
+
+    ASSERT_THROW(
+        (::s21::Matrix<int, 3, 2>(dynamic)),
+        ::s21::Exception
+    );
+    ASSERT_THROW(
+        (::s21::Matrix<int, 2, 2>({{1, 2}, {3}})),
+        ::s21::Exception
+    );
+}
+
+TEST(TEST_SUITE_NAME_MTRX, TEST_BINARY_FILE){
+    const std::filesystem::path dir = std::filesystem::temp_directory_path();
+    const std::string binary_file = dir / "s21_matrix_binary.bin";
+    const std::string text_file = dir / "s21_matrix_text";
+
+    for (const std::string& file : ::s21::test::valid_graph_files){
+        const ::s21::Matrix<int> mtrx = ::s21::Matrix<int>::LoadFromFile(file);
+
+        mtrx.SaveToBinaryFile(binary_file);
+
+        ::s21::Matrix<int> mapped = ::s21::Matrix<int>::MapFromFile(
+                                                                binary_file);
+
+        ASSERT_TRUE(mapped.IsMapped());
+        ASSERT_EQ(mapped.ToVector(), mtrx.ToVector());
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(mapped.Data()) %
+                    ::s21::MATRIX_ALIGNMENT, 0);
+
+        // Copies own their rows, changes never reach the file
+        ::s21::Matrix<int> copy(mapped);
+
+        ASSERT_FALSE(copy.IsMapped());
+        mapped[0][0] += 1;
+        ASSERT_NE(mapped[0][0], copy[0][0]);
+        ASSERT_EQ(::s21::Matrix<int>::MapFromFile(binary_file).ToVector(),
+                    mtrx.ToVector());
+
+        ::s21::Matrix<int> moved(std::move(mapped));
+
+        ASSERT_TRUE(moved.IsMapped());
+        ASSERT_EQ(moved[0][0], copy[0][0] + 1);
+
+        moved.SaveToFile(text_file);
+        moved[0][0] -= 1;
+        ASSERT_EQ(::s21::Matrix<int>::LoadFromFile(text_file)[0][0],
+                    moved[0][0] + 1);
+    }
+
+    const ::s21::Matrix<double> doubles({{0.1, -2.5e-300}, {1.0 / 3, 7}});
+
+    doubles.SaveToFile(text_file);
+    ASSERT_EQ(::s21::Matrix<double>::LoadFromFile(text_file).ToVector(),
+                doubles.ToVector());
+
+    ASSERT_THROW(
+        ::s21::Matrix<double>::MapFromFile(binary_file),
+        ::s21::Exception
+    );
+    ASSERT_THROW(
+        ::s21::Matrix<int>::MapFromFile(text_file),
+        ::s21::Exception
+    );
+
+    // Headers pointing outside the file are rejected: {field, value}
+    const std::pair<size_t, uint64_t> corruptions[] = {
+        {offsetof(::s21::MatrixFileHeader, data_offset), uint64_t(1) << 40},
+        {offsetof(::s21::MatrixFileHeader, data_offset), 4096 + 8},
+        {offsetof(::s21::MatrixFileHeader, rows), uint64_t(1) << 61},
+        {offsetof(::s21::MatrixFileHeader, leading_dimension),
+            uint64_t(1) << 63},
+    };
+
+    doubles.SaveToBinaryFile(binary_file);
+    ASSERT_EQ(::s21::Matrix<double>::MapFromFile(binary_file).ToVector(),
+                doubles.ToVector());
+    for (const auto& [field, value] : corruptions){
+        doubles.SaveToBinaryFile(binary_file);
+        {
+            std::fstream file(binary_file, std::ios::in | std::ios::out |
+                                            std::ios::binary);
+
+            file.seekp(field);
+            file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        }
+        ASSERT_THROW(
+            ::s21::Matrix<double>::MapFromFile(binary_file),
+            ::s21::Exception
+        );
+    }
+    std::filesystem::remove(binary_file);
+    std::filesystem::remove(text_file);
+}
+
+TEST(TEST_SUITE_NAME_MTRX, TEST_PARALLEL_TEXT_PARSING){
+    const std::string text_file = std::filesystem::temp_directory_path() /
+                                    "s21_matrix_parsing";
+    const size_t rows = 300, columns = 500;
+    ::s21::Matrix<double> mtrx(rows, columns);
+
+    for (size_t i = 0; i < rows; i++){
+        for (size_t j = 0; j < columns; j++){
+            mtrx[i][j] = (i * columns + j) * 0.25 - 1000;
+        }
+    }
+    mtrx.SaveToFile(text_file);
+
+    // Chunks smaller than MIN_CHUNK_SIZE are still split between threads
+    // when the file is big enough
+    const ::s21::MatrixTextFile file(text_file);
+
+    ASSERT_EQ(file.RowsCount(), rows);
+    ASSERT_EQ(file.ColumnsCount(), columns);
+    for (size_t threads_count : {1, 2, 7}){
+        ::s21::Matrix<double> parsed(rows, columns);
+
+        file.ParseElements(parsed.Data(), parsed.LeadingDimension(),
+                            false, threads_count);
+        ASSERT_EQ(parsed.ToVector(), mtrx.ToVector());
+    }
+    ASSERT_EQ(::s21::Matrix<double>::LoadFromFile(text_file).ToVector(),
+                mtrx.ToVector());
+    ASSERT_THROW(
+        ::s21::Graph<double>::LoadFromFile(text_file),
+        ::s21::Exception
+    );
+
+    // {file content, expected error location}
+    const std::vector<std::pair<std::string, std::string>> invalid_files{
+        {"2 2\n1 2\n3 x\n", ":3:3:"},
+        {"2 2\n1 2\n3\n", ":3:2:"},
+        {"2 2\n1 2\n3 4 5\n", ":3:5:"},
+        {"2 2\n1 2e\n3 4\n", ":2:3:"},
+        {"2 x\n1 2\n", ":1:3:"},
+        {"3 3\n0 1 2\n1 0 -3\n2 3 0\n", ":3:5:"},
+        {"", ""}
+    };
+
+    for (const auto& [content, location] : invalid_files){
+        std::ofstream(text_file) << content;
+        try {
+            ::s21::Graph<int>::LoadFromFile(text_file);
+            ASSERT_TRUE(false);
+        } catch (::s21::Exception& e){
+            ASSERT_NE(e.GetMessage().find(location), std::string::npos)
+                << e.GetMessage();
+        }
+    }
+
+    // Extra elements spread over several chunks are reported at the first
+    // one without being written past the matrix
+    {
+        std::ofstream extra_elements(text_file);
+
+        extra_elements << "2 2\n";
+        for (size_t i = 0; i < 200000; i++){
+            extra_elements << "1 2 3 4 5 6 7 8\n";
+        }
+    }
+    try {
+        const ::s21::MatrixTextFile extra_file(text_file);
+        ::s21::Matrix<double> parsed(2, 2);
+
+        extra_file.ParseElements(parsed.Data(), parsed.LeadingDimension(),
+                                    false, 4);
+        ASSERT_TRUE(false);
+    } catch (::s21::Exception& e){
+        ASSERT_NE(e.GetMessage().find(":2:9:"), std::string::npos)
+            << e.GetMessage();
+    }
+
+    // Integer matrices drop fractions of numbers
+    std::ofstream(text_file) << "1 3\n+1 2.75 -3e1";
+    ASSERT_EQ(::s21::Matrix<int>::LoadFromFile(text_file).ToVector(),
+                std::vector<std::vector<int>>({{1, 2, -30}}));
+    std::filesystem::remove(text_file);
+}
+
 }
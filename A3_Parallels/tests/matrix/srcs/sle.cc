@@ -66,4 +66,32 @@ TEST(TEST_SUITE_NAME_SLE, TEST_MOVE_CONSTRUCTOR){
     }
 }
 
+TEST(TEST_SUITE_NAME_SLE, TEST_MAP_FROM_FILE){
+    const std::string binary_file = std::filesystem::temp_directory_path() /
+                                    "s21_sle_binary.bin";
+
+    for (const std::string& file : ::s21::test::valid_sle_files){
+        ::s21::Sle<double> sle = ::s21::Sle<double>::LoadFromFile(file);
+
+        sle.SaveToBinaryFile(binary_file);
+
+        ::s21::Sle<double> mapped = ::s21::Sle<double>::MapFromFile(
+                                                                binary_file);
+
+        ASSERT_TRUE(mapped.IsMapped());
+        ASSERT_EQ(mapped.ToVector(), sle.ToVector());
+        ASSERT_EQ(::s21::SleGaussianUsual(mapped).GaussianElimination()
+                                                        .equation_roots,
+                    ::s21::SleGaussianUsual(sle).GaussianElimination()
+                                                        .equation_roots);
+    }
+
+    ::s21::Matrix<double>(1, 1, 1.0).SaveToBinaryFile(binary_file);
+    ASSERT_THROW(
+        ::s21::Sle<double>::MapFromFile(binary_file),
+        ::s21::Exception
+    );
+    std::filesystem::remove(binary_file);
+}
+
 }
@@ -0,0 +1,179 @@
+#include "../includes/sparse_matrix.h"
+
+namespace s21::test::sparse_matrix{
+
+TEST(TEST_SUITE_NAME_SPARSE, TEST_FROM_TRIPLETS){
+    using sparse_type = ::s21::SparseMatrix<double>;
+
+    // Unordered with a repeated cell
+    const sparse_type matrix = sparse_type::FromTriplets(3, 4, {
+        {2, 3, 5.0}, {0, 1, 2.0}, {2, 0, 1.0}, {0, 1, 3.0}, {1, 1, -4.0}
+    });
+
+    ASSERT_EQ(matrix.RowsSize(), 3u);
+    ASSERT_EQ(matrix.ColumnsSize(), 4u);
+    ASSERT_EQ(matrix.NonZerosCount(), 4u);
+    ASSERT_EQ(sparse_type::offsets_type(matrix.RowOffsets().begin(),
+                                        matrix.RowOffsets().end()),
+                sparse_type::offsets_type({0, 1, 2, 4}));
+    ASSERT_EQ(matrix.At(0, 1), 5.0);
+    ASSERT_EQ(matrix.At(2, 3), 5.0);
+    ASSERT_EQ(matrix.At(2, 2), 0.0);
+    ASSERT_EQ(matrix.Diagonal(), sparse_type::values_type({0, -4, 0}));
+
+    const std::vector<double> x{1, 2, 3, 4};
+    std::vector<double> y(3);
+
+    for (size_t workers_count : {0, 3}){
+        ::s21::ThreadPool pool(workers_count);
+
+        matrix.Multiply(x.data(), y.data(), pool);
+        ASSERT_EQ(y, std::vector<double>({10, -8, 21}));
+    }
+
+    EXPECT_THROW(sparse_type::FromTriplets(2, 2, {{2, 0, 1.0}}),
+                ::s21::Exception);
+    // Columns of a row aren't increasing
+    EXPECT_THROW(sparse_type(1, 3, {0, 2}, {2, 1}, {1.0, 1.0}),
+                ::s21::Exception);
+    EXPECT_THROW(sparse_type(2, 3, {0, 1}, {0}, {1.0}), ::s21::Exception);
+}
+
+TEST(TEST_SUITE_NAME_SPARSE, TEST_DENSE_CONVERSION){
+    using sparse_type = ::s21::SparseMatrix<double>;
+
+    const ::s21::Matrix<double> dense({
+        {0, 1, 0, 0, 2},
+        {0, 0, 0, 0, 0},
+        {3, 0, 0, 4, 0},
+        {0, 5, 6, 0, 7}
+    });
+    const ::s21::Matrix<double> other({
+        {1, 2}, {3, 4}, {5, 6}, {7, 8}, {9, 10}
+    });
+
+    for (size_t workers_count : {0, 3}){
+        ::s21::ThreadPool pool(workers_count);
+        const sparse_type sparse = sparse_type::FromDense(dense, pool);
+
+        ASSERT_EQ(sparse.NonZerosCount(), 7u);
+        ASSERT_EQ(sparse.ToDense().ToVector(), dense.ToVector());
+        ASSERT_EQ(sparse.Multiply(other, pool).ToVector(),
+                    std::vector<std::vector<double>>({
+                        {21, 24}, {0, 0}, {31, 38}, {108, 126}
+                    }));
+    }
+
+    const sparse_type sparse = sparse_type::FromDense(dense);
+    const sparse_type transposed = sparse.Transpose();
+
+    ASSERT_EQ(transposed.RowsSize(), 5u);
+    for (size_t row = 0; row < dense.RowsSize(); row++){
+        for (size_t column = 0; column < dense.ColumnsSize(); column++){
+            ASSERT_EQ(transposed.At(column, row), dense[row][column]);
+        }
+    }
+
+    // CSR arrays of the transposed matrix are CSC ones of the matrix
+    const sparse_type from_csc = sparse_type::FromCsc(
+        4, 5,
+        {transposed.RowOffsets().begin(), transposed.RowOffsets().end()},
+        {transposed.ColumnIndices().begin(),
+            transposed.ColumnIndices().end()},
+        {transposed.Values().begin(), transposed.Values().end()}
+    );
+
+    ASSERT_EQ(from_csc.ToDense().ToVector(), dense.ToVector());
+    EXPECT_THROW(sparse.Multiply(dense), ::s21::Exception);
+}
+
+TEST(TEST_SUITE_NAME_SPARSE, TEST_FILES){
+    using sparse_type = ::s21::SparseMatrix<double>;
+
+    const std::filesystem::path dir = std::filesystem::temp_directory_path();
+    const std::string text_file = dir / "s21_sparse_matrix.mtx";
+    const std::string binary_file = dir / "s21_sparse_matrix.bin";
+
+    // Lower triangle of a symmetric matrix with comments and empty lines
+    std::ofstream(text_file)
+        << "%%MatrixMarket matrix coordinate real symmetric\n"
+        << "% comment\n\n"
+        << "3 3 4\n"
+        << "1 1 4.5\n"
+        << "3 1 -1\n"
+        << "2 2 +2e-3\n"
+        << "3 3 1\r\n";
+
+    const sparse_type loaded = sparse_type::LoadFromFile(text_file);
+
+    ASSERT_EQ(loaded.ToDense().ToVector(),
+                std::vector<std::vector<double>>({
+                    {4.5, 0, -1}, {0, 2e-3, 0}, {-1, 0, 1}
+                }));
+
+    // Full-precision round trips
+    sparse_type matrix = sparse_type::FromTriplets(2, 3, {
+        {0, 2, 1.0 / 3}, {1, 0, -2.5e-300}
+    });
+
+    matrix.SaveToFile(text_file);
+    ASSERT_EQ(sparse_type::LoadFromFile(text_file).ToDense().ToVector(),
+                matrix.ToDense().ToVector());
+    matrix.SaveToBinaryFile(binary_file);
+
+    sparse_type mapped = sparse_type::MapFromFile(binary_file);
+
+    ASSERT_TRUE(mapped.IsMapped());
+    ASSERT_EQ(mapped.ToDense().ToVector(), matrix.ToDense().ToVector());
+
+    // Copies own their arrays, changes never reach the file
+    const sparse_type copy(mapped);
+
+    ASSERT_FALSE(copy.IsMapped());
+    mapped.Values()[0] = 7;
+    ASSERT_EQ(copy.At(0, 2), 1.0 / 3);
+    ASSERT_EQ(sparse_type::MapFromFile(binary_file).At(0, 2), 1.0 / 3);
+
+    const sparse_type moved(std::move(mapped));
+
+    ASSERT_TRUE(moved.IsMapped());
+    ASSERT_EQ(moved.At(0, 2), 7);
+    ASSERT_EQ(mapped.RowsSize(), 0u);
+
+    EXPECT_THROW(::s21::SparseMatrix<int>::MapFromFile(binary_file),
+                ::s21::Exception);
+    EXPECT_THROW(sparse_type::MapFromFile(text_file), ::s21::Exception);
+
+    // {file content, expected error location}
+    const std::vector<std::pair<std::string, std::string>> invalid_files{
+        {"%%MatrixMarket matrix array real general\n1 1\n1\n", ":1:"},
+        {"%%MatrixMarket matrix coordinate complex general\n", ":1:"},
+        {"2 2 1\n3 1 1\n", ":2:"},
+        {"2 2 2\n1 1 1\n", ":2:"},
+        {"2 2 1\n1 1 x\n", ":2:"},
+        {"2 2 1\n1 1 1\n2 2 1\n", ":3:"},
+        {"%%MatrixMarket matrix coordinate real symmetric\n2 3 0\n", ":2:"}
+    };
+
+    for (const auto& [content, location] : invalid_files){
+        std::ofstream(text_file) << content;
+        try {
+            sparse_type::LoadFromFile(text_file);
+            ASSERT_TRUE(false) << content;
+        } catch (::s21::Exception& e){
+            ASSERT_NE(e.GetMessage().find(text_file + location),
+                        std::string::npos) << e.GetMessage();
+        }
+    }
+
+    // Pattern matrices have ones in the listed cells
+    std::ofstream(text_file)
+        << "%%MatrixMarket matrix coordinate pattern general\n"
+        << "2 2 2\n1 2\n2 1\n";
+    ASSERT_EQ(sparse_type::LoadFromFile(text_file).ToDense().ToVector(),
+                std::vector<std::vector<double>>({{0, 1}, {1, 0}}));
+    std::filesystem::remove(text_file);
+    std::filesystem::remove(binary_file);
+}
+
+}
@@ -0,0 +1,16 @@
+#ifndef TEST_THREAD_POOL_H
+#define TEST_THREAD_POOL_H
+
+#include <stdexcept>
+#include <algorithm>
+#include <numeric>
+#include <atomic>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "../../../utils/includes/thread_pool.h"
+#include "../../../utils/includes/task_graph.h"
+
+#define TEST_SUITE_NAME_POOL THREAD_POOL_TEST
+
+#endif
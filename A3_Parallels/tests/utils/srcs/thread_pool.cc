@@ -0,0 +1,109 @@
+#include "../includes/thread_pool.h"
+
+namespace s21::test::thread_pool{
+
+TEST(TEST_SUITE_NAME_POOL, TEST_PARALLEL_FOR){
+    for (size_t workers_count : {0, 1, 3}){
+        ::s21::ThreadPool pool(workers_count);
+
+        for (size_t grain : {1, 7, 1000, 5000}){
+            std::vector<int> visits(1000, 0);
+
+            pool.ParallelFor(
+                0, visits.size(),
+                [&visits](size_t begin, size_t end){
+                    for (size_t i = begin; i < end; i++) visits[i]++;
+                },
+                grain
+            );
+            EXPECT_EQ(std::count(visits.begin(), visits.end(), 1), 1000);
+        }
+        pool.ParallelFor(5, 5, [](size_t, size_t){ FAIL(); });
+    }
+}
+
+TEST(TEST_SUITE_NAME_POOL, TEST_NESTED_TASKS){
+    ::s21::ThreadPool pool(3);
+    std::atomic<size_t> sum(0);
+
+    // Every outer task waits for inner ones, so waiting threads have to
+    // run queued tasks themselves
+    pool.ParallelFor(0, 16, [&](size_t begin, size_t end){
+        for (size_t i = begin; i < end; i++){
+            ::s21::TaskGroup group(pool);
+
+            for (size_t j = 0; j < 8; j++){
+                group.Run([&sum, j](){ sum += j; });
+            }
+            group.Wait();
+        }
+    });
+    EXPECT_EQ(sum.load(), 16 * 28);
+}
+
+TEST(TEST_SUITE_NAME_POOL, TEST_TASK_EXCEPTION){
+    for (size_t workers_count : {0, 2}){
+        ::s21::ThreadPool pool(workers_count);
+        ::s21::TaskGroup group(pool);
+        std::atomic<int> finished(0);
+
+        for (int task_i = 0; task_i < 10; task_i++){
+            group.Run([&finished, task_i](){
+                if (task_i == 3) throw std::runtime_error("task failed");
+                finished++;
+            });
+        }
+        EXPECT_THROW(group.Wait(), std::runtime_error);
+        EXPECT_EQ(finished.load(), 9);
+        EXPECT_NO_THROW(group.Wait());
+    }
+}
+
+TEST(TEST_SUITE_NAME_POOL, TEST_TASK_GRAPH){
+    for (size_t workers_count : {0, 3}){
+        ::s21::ThreadPool pool(workers_count);
+        ::s21::TaskGraph graph(pool);
+        constexpr size_t layers = 20, width = 8;
+        std::vector<std::atomic<size_t>> finished(layers);
+        std::atomic<bool> is_order_broken(false);
+        std::vector<::s21::TaskGraph::task_id_type> previous, current;
+
+        // Every task of a layer depends on two tasks of the previous one
+        for (size_t layer = 0; layer < layers; layer++){
+            current.clear();
+            for (size_t task_i = 0; task_i < width; task_i++){
+                current.push_back(graph.Add([&, layer](){
+                    if (layer && finished[layer - 1] < 2) {
+                        is_order_broken = true;
+                    }
+                    finished[layer]++;
+                }, static_cast<int>(task_i)));
+                if (layer){
+                    graph.Precede(previous[task_i], current.back());
+                    graph.Precede(previous[(task_i + 1) % width],
+                                    current.back());
+                }
+            }
+            previous.swap(current);
+        }
+        ASSERT_EQ(graph.Size(), layers * width);
+        graph.Run();
+        EXPECT_FALSE(is_order_broken);
+        for (size_t layer = 0; layer < layers; layer++){
+            EXPECT_EQ(finished[layer], width);
+        }
+    }
+
+    ::s21::ThreadPool pool(3);
+    ::s21::TaskGraph graph(pool);
+    std::atomic<bool> is_skipped_run(false);
+    const auto failed = graph.Add([](){
+        throw std::runtime_error("task failed");
+    });
+
+    graph.Precede(failed, graph.Add([&](){ is_skipped_run = true; }));
+    EXPECT_THROW(graph.Run(), std::runtime_error);
+    EXPECT_FALSE(is_skipped_run);
+}
+
+}
@@ -0,0 +1,46 @@
+#ifndef BARRIER_H
+#define BARRIER_H
+
+#include <cstddef>
+#include <atomic>
+#include <thread>
+
+namespace s21{
+
+/**
+ * Reusable barrier of a fixed count of threads. Threads spin for a while
+ * and then yield, so short phases don't pay for sleeping and waking up.
+ * The last thread to arrive runs the completion step before releasing
+ * the others, which makes it a place for work that must be done by one
+ * thread between two phases
+ */
+class Barrier{
+public:
+    // Checks of the generation before a waiting thread starts yielding
+    static constexpr size_t SPINS_BEFORE_YIELD = 1024;
+
+    explicit Barrier(size_t threads_count);
+    Barrier(const Barrier&) = delete;
+
+    Barrier& operator=(const Barrier&) = delete;
+
+    /**
+     * Waiting for all threads, the last one calls [completion] first
+     */
+    template < class Function >
+    void ArriveAndWait(Function completion);
+
+    void ArriveAndWait();
+
+private:
+    const size_t threads_count_;
+    alignas(64) std::atomic<size_t> arrived_;
+    // Count of completed phases
+    alignas(64) std::atomic<size_t> generation_;
+};
+
+}
+
+#include "../srcs/barrier_impl.h"
+
+#endif
@@ -0,0 +1,96 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <atomic>
+#include <vector>
+#include <mutex>
+
+namespace s21{
+
+/**
+ * Counters of one ring. Every counter is written by one side only and
+ * is supposed to be read after both sides are finished
+ */
+struct RingStats{
+    size_t pushes = 0;
+    // Pushes which had to wait for a free slot
+    size_t push_stalls = 0;
+    // Pops which had to wait for an element
+    size_t pop_stalls = 0;
+    // Sum of elements count right after every push
+    size_t occupancy_sum = 0;
+
+    /**
+     * @return average count of elements in the ring seen by the producer
+     */
+    double AverageOccupancy() const;
+};
+
+/**
+ * Bounded single-producer single-consumer ring buffer. Fast path is
+ * lock-free, a side sleeps on a condition variable only when the ring
+ * is full (producer) or empty (consumer)
+ */
+template < class T >
+class SpscRing{
+public:
+    using value_type    = T;
+    using size_type     = size_t;
+
+    explicit SpscRing(size_type capacity);
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    /**
+     * Putting [value] into the ring, waiting while it is full
+     */
+    void Push(const value_type& value);
+
+    /**
+     * Taking the oldest element into [value], waiting while the ring is
+     * empty and not closed
+     * @return false if the ring is closed and empty
+     */
+    bool Pop(value_type& value);
+
+    /**
+     * Waking the consumer: no more elements will be pushed
+     */
+    void Close();
+
+    /**
+     * Emptying the ring, reopening it and clearing stats. Both sides
+     * must be stopped
+     */
+    void Reset();
+
+    size_type Capacity() const;
+    const RingStats& Stats() const;
+
+private:
+    std::vector<value_type> buffer_;
+    // Next element to pop, written by the consumer only
+    alignas(64) std::atomic<size_type> head_;
+    // Next slot to push, written by the producer only
+    alignas(64) std::atomic<size_type> tail_;
+    std::atomic<bool> closed_;
+    std::atomic<bool> producer_waits_;
+    std::atomic<bool> consumer_waits_;
+    std::mutex mutex_;
+    std::condition_variable not_full_;
+    std::condition_variable not_empty_;
+    RingStats stats_;
+
+    /**
+     * Waking the other side if it sleeps on [condition]
+     */
+    void Notify_(std::atomic<bool>& waits, std::condition_variable& condition);
+};
+
+}
+
+#include "../srcs/spsc_ring_impl.h"
+
+#endif
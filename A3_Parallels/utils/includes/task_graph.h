@@ -0,0 +1,88 @@
+#ifndef TASK_GRAPH_H
+#define TASK_GRAPH_H
+
+#include <functional>
+#include <algorithm>
+#include <cstddef>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <queue>
+
+#include "thread_pool.h"
+
+namespace s21{
+
+/**
+ * Acyclic graph of tasks with data dependencies run by a pool. A task is
+ * submitted as soon as the last task preceding it is finished, so there
+ * are no barriers between phases of an algorithm: independent work of a
+ * later phase fills the threads left idle by the current one. Tasks
+ * becoming ready together are submitted by ascending priority, so the
+ * thread releasing them takes the most urgent one first
+ */
+class TaskGraph{
+public:
+    using task_type         = std::function<void()>;
+    using task_id_type      = size_t;
+    using priority_type     = int;
+
+    explicit TaskGraph(ThreadPool& pool = ThreadPool::Instance());
+    TaskGraph(const TaskGraph&) = delete;
+
+    TaskGraph& operator=(const TaskGraph&) = delete;
+
+    /**
+     * Adding [task] run with [priority] among tasks ready together
+     * @return id of the task
+     */
+    task_id_type Add(task_type task, priority_type priority = 0);
+
+    /**
+     * Making [after] task wait for [before] task to finish
+     */
+    void Precede(task_id_type before, task_id_type after);
+
+    size_t Size() const;
+
+    /**
+     * Running every task after all tasks preceding it. Tasks depending on
+     * a failed one aren't run
+     * @throw the first exception thrown by the tasks
+     */
+    void Run();
+
+private:
+    struct Node{
+        task_type task;
+        priority_type priority;
+        size_t predecessors_count;
+        std::vector<task_id_type> successors;
+    };
+
+    ThreadPool& pool_;
+    std::vector<Node> nodes_;
+    // Unfinished predecessors of every task during Run()
+    std::unique_ptr<std::atomic<size_t>[]> waiting_;
+
+    /**
+     * Running tasks one by one in the calling thread starting from
+     * [sources], the most urgent ready task first
+     */
+    void RunSerial_(const std::vector<task_id_type>& sources);
+
+    /**
+     * Submitting [ready] tasks to [group] by ascending priority
+     */
+    void Release_(TaskGroup& group, std::vector<task_id_type>& ready);
+
+    /**
+     * Running [task_id] task and releasing its successors which have no
+     * unfinished predecessors left
+     */
+    void RunNode_(TaskGroup& group, task_id_type task_id);
+};
+
+}
+
+#endif
@@ -0,0 +1,168 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <condition_variable>
+#include <functional>
+#include <exception>
+#include <algorithm>
+#include <cstddef>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <deque>
+#include <mutex>
+
+namespace s21{
+
+/**
+ * Persistent pool of worker threads shared by the parallel algorithms, so
+ * a multiplication or an elimination step doesn't pay for creating its
+ * threads. Every worker owns a deque of tasks: it takes its own tasks from
+ * the back and, when it runs out of them, steals the oldest ones from the
+ * front of other deques. The thread waiting for tasks helps to run them,
+ * so nested parallel loops don't deadlock
+ */
+class ThreadPool{
+public:
+    using task_type         = std::function<void()>;
+
+    /**
+     * Pool of [workers_count] workers. The thread submitting tasks takes
+     * part in running them, so 0 workers means everything runs inline.
+     * If a worker can't be created, the pool keeps the ones created before
+     */
+    explicit ThreadPool(size_t workers_count);
+    ThreadPool(const ThreadPool&) = delete;
+    ~ThreadPool();
+
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @return process-wide pool of hardware_concurrency() - 1 workers
+     */
+    static ThreadPool& Instance();
+
+    size_t WorkersCount() const;
+
+    /**
+     * @return count of threads running a parallel loop: the workers and
+     * the caller
+     */
+    size_t ThreadsCount() const;
+
+    /**
+     * Queueing [task]. A worker puts it into its own deque, other threads
+     * spread tasks between workers' deques
+     */
+    void Submit(task_type task);
+
+    /**
+     * Running one queued task in the calling thread
+     * @return false if there are no queued tasks
+     */
+    bool RunPendingTask();
+
+    /**
+     * Calling [body](block_begin, block_end) for blocks of [grain]
+     * indices of [begin, end) by up to [max_threads] (0 - all) threads
+     * including the caller. Blocks are claimed one by one, so faster
+     * threads take over the tail
+     * @throw the first exception thrown by [body]
+     */
+    template < class Function >
+    void ParallelFor(size_t begin, size_t end, Function body,
+                    size_t grain = 1, size_t max_threads = 0);
+
+private:
+    struct Worker{
+        std::mutex mutex;
+        std::deque<task_type> tasks;
+        std::thread thread;
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    // Guards sleeping of workers
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    // Tasks submitted and not taken yet
+    std::atomic<size_t> queued_;
+    // Deque for the next task submitted from outside of the pool
+    std::atomic<size_t> next_worker_;
+    bool is_stopped_;
+
+    /**
+     * Worker thread body: running own and stolen tasks, sleeping while
+     * there are no ones
+     */
+    void WorkerLoop_(size_t worker_i);
+
+    /**
+     * Taking a task from the back of [worker_i] deque or from the front
+     * of any other one
+     * @return false if all deques are empty
+     */
+    bool PopTask_(size_t worker_i, task_type& task);
+
+    /**
+     * @return index of the calling thread's worker in this pool or
+     * workers count if it isn't a worker of this pool
+     */
+    size_t CurrentWorker_() const;
+};
+
+/**
+ * Tasks run by a pool which can be waited for together
+ */
+class TaskGroup{
+public:
+    explicit TaskGroup(ThreadPool& pool = ThreadPool::Instance());
+    TaskGroup(const TaskGroup&) = delete;
+    /**
+     * Waiting for unfinished tasks, their exceptions are dropped
+     */
+    ~TaskGroup();
+
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    /**
+     * Submitting [task] to the pool, running it inline if the pool has no
+     * workers
+     */
+    template < class Function >
+    void Run(Function task);
+
+    /**
+     * Running queued tasks until all tasks of the group are finished
+     * @throw the first exception thrown by the group's tasks
+     */
+    void Wait();
+
+private:
+    // Time to sleep before looking for a task to help with again
+    static constexpr std::chrono::milliseconds HELP_PERIOD{1};
+
+    ThreadPool& pool_;
+    std::atomic<size_t> pending_;
+    std::mutex mutex_;
+    std::condition_variable finished_;
+    std::exception_ptr exception_;
+
+    /**
+     * Running [task] keeping its exception and counting it finished
+     */
+    template < class Function >
+    void RunTask_(Function& task);
+
+    /**
+     * Waiting for the tasks without rethrowing their exceptions
+     */
+    void WaitTasks_();
+};
+
+}
+
+#include "../srcs/thread_pool_impl.h"
+
+#endif
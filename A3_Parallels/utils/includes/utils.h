@@ -43,6 +43,16 @@ struct SleResult {
     using sle_type  = std::vector<double>;
 
     sle_type equation_roots;
+    // ||b - Ax|| / ||b|| before the first iteration and after every one
+    // of iterative solvers or after every refinement step of the mixed
+    // precision one, empty for other direct ones
+    sle_type residual_history;
+};
+
+struct CacheSizes {
+    size_t l1_data;     // per core L1 data cache in bytes
+    size_t l2;          // per core L2 cache in bytes
+    size_t l3;          // shared L3 cache in bytes
 };
 
 template < class T >
@@ -70,6 +80,12 @@ void ReadOnlyPermissions(std::string& filepath);
  */
 void JoinThreads(threads_array_type& threads_array);
 
+/**
+ * Detect sizes of CPU data caches. Missing levels are replaced
+ * with common defaults (32K L1, 256K L2, 8M L3)
+ */
+CacheSizes DetectCacheSizes();
+
 /**
  * Compare two doubles [a] and [b] with allowable error(precision) 1e-10
  * @return true if [a] and [b] are equal
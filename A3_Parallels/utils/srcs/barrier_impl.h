@@ -0,0 +1,36 @@
+#ifndef BARRIER_H
+#error 'barrier_impl.h' is not supposed to be included directly. \
+        Include 'barrier.h' instead.
+#endif
+
+namespace s21{
+
+inline Barrier::Barrier(size_t threads_count)
+                    : threads_count_(threads_count ? threads_count : 1),
+                        arrived_(0),
+                        generation_(0) { }
+
+template < class Function >
+void Barrier::ArriveAndWait(Function completion){
+    const size_t generation = generation_.load(std::memory_order_acquire);
+
+    if (arrived_.fetch_add(1, std::memory_order_acq_rel) + 1 ==
+            threads_count_){
+        completion();
+        // Nobody can arrive at the next phase until the generation changes
+        arrived_.store(0, std::memory_order_relaxed);
+        generation_.fetch_add(1, std::memory_order_release);
+        return;
+    }
+    for (size_t spin = 0;
+            generation_.load(std::memory_order_acquire) == generation;
+            spin++){
+        if (spin >= SPINS_BEFORE_YIELD) std::this_thread::yield();
+    }
+}
+
+inline void Barrier::ArriveAndWait(){
+    ArriveAndWait([](){});
+}
+
+}
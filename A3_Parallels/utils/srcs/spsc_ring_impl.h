@@ -0,0 +1,104 @@
+#ifndef SPSC_RING_H
+#error 'spsc_ring_impl.h' is not supposed to be included directly. \
+        Include 'spsc_ring.h' instead.
+#endif
+
+namespace s21{
+
+inline double RingStats::AverageOccupancy() const{
+    return pushes ? static_cast<double>(occupancy_sum) / pushes : 0;
+}
+
+template < class T >
+SpscRing<T>::SpscRing(size_type capacity)
+                            : buffer_(capacity ? capacity : 1),
+                                head_(0),
+                                tail_(0),
+                                closed_(false),
+                                producer_waits_(false),
+                                consumer_waits_(false) { }
+
+template < class T >
+void SpscRing<T>::Push(const value_type& value){
+    const size_type tail = tail_.load(std::memory_order_relaxed);
+
+    if (tail - head_.load(std::memory_order_acquire) == buffer_.size()){
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        stats_.push_stalls++;
+        producer_waits_.store(true);
+        not_full_.wait(lock, [this, tail](){
+            return tail - head_.load() < buffer_.size();
+        });
+        producer_waits_.store(false);
+    }
+
+    buffer_[tail % buffer_.size()] = value;
+    tail_.store(tail + 1, std::memory_order_seq_cst);
+    stats_.pushes++;
+    stats_.occupancy_sum += tail + 1 - head_.load(std::memory_order_relaxed);
+    Notify_(consumer_waits_, not_empty_);
+}
+
+template < class T >
+bool SpscRing<T>::Pop(value_type& value){
+    const size_type head = head_.load(std::memory_order_relaxed);
+
+    if (tail_.load(std::memory_order_acquire) == head){
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        if (closed_.load() && tail_.load() == head) return false;
+        stats_.pop_stalls++;
+        consumer_waits_.store(true);
+        not_empty_.wait(lock, [this, head](){
+            return tail_.load() != head || closed_.load();
+        });
+        consumer_waits_.store(false);
+        if (tail_.load() == head) return false;
+    }
+
+    value = buffer_[head % buffer_.size()];
+    head_.store(head + 1, std::memory_order_seq_cst);
+    Notify_(producer_waits_, not_full_);
+    return true;
+}
+
+template < class T >
+void SpscRing<T>::Close(){
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    closed_.store(true);
+    not_empty_.notify_one();
+}
+
+template < class T >
+void SpscRing<T>::Reset(){
+    head_ = 0;
+    tail_ = 0;
+    closed_ = false;
+    stats_ = RingStats();
+}
+
+template < class T >
+typename SpscRing<T>::size_type SpscRing<T>::Capacity() const{
+    return buffer_.size();
+}
+
+template < class T >
+const RingStats& SpscRing<T>::Stats() const{
+    return stats_;
+}
+
+template < class T >
+void SpscRing<T>::Notify_(std::atomic<bool>& waits,
+                        std::condition_variable& condition){
+    // Pairs with the flag store before the predicate check of the waiting
+    // side: either it sees the new index or we see it waiting
+    if (waits.load()){
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        condition.notify_one();
+    }
+}
+
+}
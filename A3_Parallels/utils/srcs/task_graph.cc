@@ -0,0 +1,101 @@
+#include "../includes/task_graph.h"
+
+namespace s21{
+
+TaskGraph::TaskGraph(ThreadPool& pool) : pool_(pool) { }
+
+TaskGraph::task_id_type TaskGraph::Add(task_type task,
+                                    priority_type priority){
+    nodes_.push_back({std::move(task), priority, 0, {}});
+    return nodes_.size() - 1;
+}
+
+void TaskGraph::Precede(task_id_type before, task_id_type after){
+    nodes_[before].successors.push_back(after);
+    nodes_[after].predecessors_count++;
+}
+
+size_t TaskGraph::Size() const{
+    return nodes_.size();
+}
+
+void TaskGraph::Run(){
+    const size_t size = nodes_.size();
+    std::vector<task_id_type> ready;
+
+    waiting_ = std::make_unique<std::atomic<size_t>[]>(size);
+    for (task_id_type task_id = 0; task_id < size; task_id++){
+        waiting_[task_id].store(nodes_[task_id].predecessors_count,
+                                std::memory_order_relaxed);
+        if (!nodes_[task_id].predecessors_count) ready.push_back(task_id);
+    }
+
+    // Without workers tasks released by a task would run inside it, so
+    // a long chain of dependencies would become deep recursion
+    if (!pool_.WorkersCount()){
+        RunSerial_(ready);
+        return;
+    }
+
+    TaskGroup group(pool_);
+
+    Release_(group, ready);
+    group.Wait();
+}
+
+void TaskGraph::RunSerial_(const std::vector<task_id_type>& sources){
+    auto is_less_urgent = [this](task_id_type first, task_id_type second){
+        if (nodes_[first].priority != nodes_[second].priority){
+            return nodes_[first].priority < nodes_[second].priority;
+        }
+        return first > second;
+    };
+    std::priority_queue<
+        task_id_type,
+        std::vector<task_id_type>,
+        decltype(is_less_urgent)
+    > ready(is_less_urgent, sources);
+
+    while (!ready.empty()){
+        const task_id_type task_id = ready.top();
+
+        ready.pop();
+        nodes_[task_id].task();
+        for (task_id_type successor : nodes_[task_id].successors){
+            if (!--waiting_[successor]) ready.push(successor);
+        }
+    }
+}
+
+void TaskGraph::Release_(TaskGroup& group,
+                        std::vector<task_id_type>& ready){
+    // A worker takes its own tasks from the back of its deque, so the
+    // most urgent task goes last
+    std::sort(ready.begin(), ready.end(),
+                [this](task_id_type first, task_id_type second){
+                    if (nodes_[first].priority != nodes_[second].priority){
+                        return nodes_[first].priority <
+                                nodes_[second].priority;
+                    }
+                    return first > second;
+                });
+    for (task_id_type task_id : ready){
+        group.Run([this, &group, task_id](){ RunNode_(group, task_id); });
+    }
+}
+
+void TaskGraph::RunNode_(TaskGroup& group, task_id_type task_id){
+    nodes_[task_id].task();
+
+    std::vector<task_id_type> ready;
+
+    for (task_id_type successor : nodes_[task_id].successors){
+        if (waiting_[successor].fetch_sub(1, std::memory_order_acq_rel) ==
+                1){
+            ready.push_back(successor);
+        }
+    }
+    if (!ready.empty()) Release_(group, ready);
+}
+
+}
@@ -0,0 +1,195 @@
+#include "../includes/thread_pool.h"
+#include "../includes/utils.h"
+
+namespace s21{
+
+namespace {
+
+// Pool and worker index of the calling thread, if it is a pool worker
+thread_local const ThreadPool* current_pool = nullptr;
+thread_local size_t current_worker = 0;
+
+}
+
+ThreadPool::ThreadPool(size_t workers_count)
+                    : queued_(0),
+                        next_worker_(0),
+                        is_stopped_(false){
+    workers_.reserve(workers_count);
+    for (size_t worker_i = 0; worker_i < workers_count; worker_i++){
+        workers_.push_back(std::make_unique<Worker>());
+    }
+
+    // Workers lock mutex_ before touching workers_, so it can be shrunk
+    // to the started ones if creating a worker fails
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t worker_i = 0;
+
+    try{
+        for (; worker_i < workers_count; worker_i++){
+            workers_[worker_i]->thread = std::thread(
+                &ThreadPool::WorkerLoop_,
+                this,
+                worker_i
+            );
+        }
+    } catch(const std::exception &e){
+        std::string error = "Threads problems: ";
+        PRINT_ERROR(__FILE__, __FUNCTION__, __LINE__, error + e.what());
+        workers_.resize(worker_i);
+    }
+}
+
+ThreadPool::~ThreadPool(){
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        is_stopped_ = true;
+    }
+    wake_.notify_all();
+    for (auto& worker : workers_){
+        if (worker->thread.joinable()) worker->thread.join();
+    }
+}
+
+ThreadPool& ThreadPool::Instance(){
+    static ThreadPool pool(
+        std::max<size_t>(std::thread::hardware_concurrency(), 1) - 1
+    );
+
+    return pool;
+}
+
+size_t ThreadPool::WorkersCount() const{
+    return workers_.size();
+}
+
+size_t ThreadPool::ThreadsCount() const{
+    return workers_.size() + 1;
+}
+
+void ThreadPool::Submit(task_type task){
+    if (workers_.empty()){
+        task();
+        return;
+    }
+
+    size_t worker_i = CurrentWorker_();
+
+    if (worker_i == workers_.size()){
+        worker_i = next_worker_.fetch_add(1, std::memory_order_relaxed) %
+                    workers_.size();
+    }
+    // Counting the task before pushing keeps queued_ from going below
+    // the real count when the task is taken right away
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        queued_.fetch_add(1, std::memory_order_relaxed);
+    }
+    try{
+        std::lock_guard<std::mutex> lock(workers_[worker_i]->mutex);
+
+        workers_[worker_i]->tasks.push_back(std::move(task));
+    } catch(...){
+        queued_.fetch_sub(1, std::memory_order_relaxed);
+        throw;
+    }
+    wake_.notify_one();
+}
+
+bool ThreadPool::RunPendingTask(){
+    task_type task;
+
+    if (!PopTask_(CurrentWorker_(), task)) return false;
+    task();
+    return true;
+}
+
+void ThreadPool::WorkerLoop_(size_t worker_i){
+    current_pool = this;
+    current_worker = worker_i;
+    // Waiting for the constructor to finish workers_
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+    }
+    while (true){
+        task_type task;
+
+        if (PopTask_(worker_i, task)){
+            task();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        wake_.wait(lock, [this](){
+            return is_stopped_ || queued_.load(std::memory_order_relaxed);
+        });
+        if (is_stopped_ && !queued_.load(std::memory_order_relaxed)) return;
+    }
+}
+
+bool ThreadPool::PopTask_(size_t worker_i, task_type& task){
+    const size_t workers_count = workers_.size();
+
+    if (!queued_.load(std::memory_order_relaxed)) return false;
+    if (worker_i < workers_count){
+        Worker& worker = *workers_[worker_i];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+
+        if (!worker.tasks.empty()){
+            task = std::move(worker.tasks.back());
+            worker.tasks.pop_back();
+            queued_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    for (size_t shift = 1; shift <= workers_count; shift++){
+        Worker& victim = *workers_[(worker_i + shift) % workers_count];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+
+        if (!victim.tasks.empty()){
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            queued_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t ThreadPool::CurrentWorker_() const{
+    return current_pool == this ? current_worker : workers_.size();
+}
+
+
+TaskGroup::TaskGroup(ThreadPool& pool) : pool_(pool), pending_(0) { }
+
+TaskGroup::~TaskGroup(){
+    WaitTasks_();
+}
+
+void TaskGroup::Wait(){
+    WaitTasks_();
+
+    std::exception_ptr exception;
+
+    std::swap(exception, exception_);
+    if (exception) std::rethrow_exception(exception);
+}
+
+void TaskGroup::WaitTasks_(){
+    while (pending_.load(std::memory_order_acquire)){
+        if (pool_.RunPendingTask()) continue;
+
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        finished_.wait_for(lock, HELP_PERIOD, [this](){
+            return !pending_.load(std::memory_order_acquire);
+        });
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+}
+
+}
@@ -0,0 +1,80 @@
+#ifndef THREAD_POOL_H
+#error 'thread_pool_impl.h' is not supposed to be included directly. \
+        Include 'thread_pool.h' instead.
+#endif
+
+namespace s21{
+
+template < class Function >
+void ThreadPool::ParallelFor(size_t begin, size_t end, Function body,
+                            size_t grain, size_t max_threads){
+    if (begin >= end) return;
+    grain = std::max<size_t>(grain, 1);
+
+    const size_t blocks = (end - begin + grain - 1) / grain;
+    size_t threads_count = std::min(ThreadsCount(), blocks);
+
+    if (max_threads) threads_count = std::min(threads_count, max_threads);
+    if (threads_count <= 1){
+        body(begin, end);
+        return;
+    }
+
+    std::atomic<size_t> next_block(0);
+    auto claim_blocks = [&](){
+        while (true){
+            size_t block_i = next_block.fetch_add(
+                1,
+                std::memory_order_relaxed
+            );
+            if (block_i >= blocks) break;
+
+            size_t block_begin = begin + block_i * grain;
+
+            body(block_begin, std::min(block_begin + grain, end));
+        }
+    };
+    TaskGroup group(*this);
+
+    for (size_t thread_i = 1; thread_i < threads_count; thread_i++){
+        group.Run(claim_blocks);
+    }
+    claim_blocks();
+    group.Wait();
+}
+
+template < class Function >
+void TaskGroup::Run(Function task){
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    if (!pool_.WorkersCount()){
+        RunTask_(task);
+        return;
+    }
+    try{
+        pool_.Submit([this, task]() mutable { RunTask_(task); });
+    } catch(...){
+        pending_.fetch_sub(1, std::memory_order_relaxed);
+        throw;
+    }
+}
+
+template < class Function >
+void TaskGroup::RunTask_(Function& task){
+    try{
+        task();
+    } catch(...){
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (!exception_) exception_ = std::current_exception();
+    }
+
+    // The waiting thread takes the mutex after seeing zero, so the group
+    // isn't destroyed until this task stops touching it
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1){
+        finished_.notify_all();
+    }
+}
+
+}
@@ -1,7 +1,60 @@
 #include "../includes/utils.h"
 
+#include <unistd.h>
+#include <fstream>
+#include <algorithm>
+
 namespace s21{
 
+namespace {
+
+const CacheSizes DEFAULT_CACHE_SIZES{32 * 1024, 256 * 1024, 8 * 1024 * 1024};
+
+/**
+ * Read size of [level] cache of [type] ("Data" or "Unified") of cpu0
+ * from sysfs
+ * @return size in bytes or 0 if it isn't available
+ */
+size_t ReadSysfsCacheSize(int level, bool is_data){
+    for (int index = 0; index < 8; index++){
+        const std::string dir = "/sys/devices/system/cpu/cpu0/cache/index" +
+                                std::to_string(index) + "/";
+        std::ifstream level_file(dir + "level");
+        std::ifstream type_file(dir + "type");
+        std::ifstream size_file(dir + "size");
+        int cache_level = 0;
+        std::string type, size;
+
+        if (!(level_file >> cache_level) || !(type_file >> type) ||
+                !(size_file >> size) || cache_level != level){
+            continue;
+        }
+        if (type == "Instruction" || (is_data && type != "Data" &&
+                                        type != "Unified")){
+            continue;
+        }
+
+        size_t multiplier = 1;
+        if (size.back() == 'K') multiplier = 1024;
+        if (size.back() == 'M') multiplier = 1024 * 1024;
+        try {
+            return std::stoul(size) * multiplier;
+        } catch (const std::exception&) {
+            return 0;
+        }
+    }
+    return 0;
+}
+
+size_t DetectCacheSize(int sysconf_name, int level, bool is_data){
+    long size = sysconf_name >= 0 ? sysconf(sysconf_name) : 0;
+
+    if (size > 0) return static_cast<size_t>(size);
+    return ReadSysfsCacheSize(level, is_data);
+}
+
+}
+
 void PrintError(const std::string& filename,
         const std::string& funcname, int line, const std::string& msg){
     std::cerr << filename << ": "
@@ -29,6 +82,27 @@ void JoinThreads(threads_array_type& threads_array){
     }
 }
 
+CacheSizes DetectCacheSizes(){
+#ifdef _SC_LEVEL1_DCACHE_SIZE
+    CacheSizes sizes{
+        DetectCacheSize(_SC_LEVEL1_DCACHE_SIZE, 1, true),
+        DetectCacheSize(_SC_LEVEL2_CACHE_SIZE, 2, false),
+        DetectCacheSize(_SC_LEVEL3_CACHE_SIZE, 3, false)
+    };
+#else
+    CacheSizes sizes{
+        DetectCacheSize(-1, 1, true),
+        DetectCacheSize(-1, 2, false),
+        DetectCacheSize(-1, 3, false)
+    };
+#endif
+
+    if (!sizes.l1_data) sizes.l1_data = DEFAULT_CACHE_SIZES.l1_data;
+    if (!sizes.l2) sizes.l2 = DEFAULT_CACHE_SIZES.l2;
+    if (!sizes.l3) sizes.l3 = std::max(sizes.l2, DEFAULT_CACHE_SIZES.l3);
+    return sizes;
+}
+
 bool DoubleCompare(double a, double b){
     const double val = 1e-10;
     return std::abs(a - b) < val;